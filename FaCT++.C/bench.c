@@ -0,0 +1,121 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+/* load the same ABox through the per-call API and through a binary axiom buffer.
+ * Build with: gcc -O2 -I. -I../Kernel bench.c -Lobj -lfact */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "fact.h"
+
+#define NS "http://example.org/ontologies/2026/people#"
+#define DATA "http://data.example.org/resource/individuals/"
+
+static double seconds ( clock_t start )
+{
+	return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+/* class assertions for N individuals plus a chain of N-1 role assertions */
+static int load_per_call ( fact_reasoning_kernel* k, int n )
+{
+	char cname[128], iname[128], jname[128];
+	int i;
+	fact_o_role_expression* r = fact_object_role(k,NS "knows");
+	for ( i = 0; i < n; ++i )
+	{
+		sprintf ( cname, NS "Class%d", i%50 );
+		sprintf ( iname, DATA "person_%07d", i );
+		fact_instance_of ( k, fact_individual(k,iname), fact_concept(k,cname) );
+		if ( i > 0 )
+		{
+			sprintf ( jname, DATA "person_%07d", i-1 );
+			fact_related_to ( k, fact_individual(k,iname), r, fact_individual(k,jname) );
+		}
+	}
+	return 2*n-1;
+}
+
+/* the same axioms in a binary buffer */
+static void encode ( fact_axiom_buffer* b, int n )
+{
+	char cname[128], iname[128], jname[128];
+	int i;
+	unsigned int r = fact_axiom_buffer_name(b,NS "knows");
+	for ( i = 0; i < n; ++i )
+	{
+		sprintf ( cname, NS "Class%d", i%50 );
+		sprintf ( iname, DATA "person_%07d", i );
+		fact_axiom_buffer_tag ( b, fact_ab_class_assertion );
+		fact_axiom_buffer_tag ( b, fact_ab_individual );
+		fact_axiom_buffer_num ( b, fact_axiom_buffer_name(b,iname) );
+		fact_axiom_buffer_tag ( b, fact_ab_concept );
+		fact_axiom_buffer_num ( b, fact_axiom_buffer_name(b,cname) );
+		if ( i > 0 )
+		{
+			sprintf ( jname, DATA "person_%07d", i-1 );
+			fact_axiom_buffer_tag ( b, fact_ab_object_assertion );
+			fact_axiom_buffer_tag ( b, fact_ab_individual );
+			fact_axiom_buffer_num ( b, fact_axiom_buffer_name(b,iname) );
+			fact_axiom_buffer_tag ( b, fact_ab_o_role );
+			fact_axiom_buffer_num ( b, r );
+			fact_axiom_buffer_tag ( b, fact_ab_individual );
+			fact_axiom_buffer_num ( b, fact_axiom_buffer_name(b,jname) );
+		}
+	}
+}
+
+int main ( int argc, char* argv[] )
+{
+	int n = argc > 1 ? atoi(argv[1]) : 500000;
+	clock_t start;
+	double tCall, tEncode, tLoad;
+	size_t size;
+	const void* data;
+	int nAxioms;
+
+	/* per-call API */
+	fact_reasoning_kernel* k = fact_reasoning_kernel_new();
+	start = clock();
+	nAxioms = load_per_call ( k, n );
+	tCall = seconds(start);
+	fact_reasoning_kernel_free(k);
+
+	/* binary buffer */
+	fact_axiom_buffer* b = fact_axiom_buffer_new();
+	start = clock();
+	encode ( b, n );
+	data = fact_axiom_buffer_data ( b, &size );
+	tEncode = seconds(start);
+
+	k = fact_reasoning_kernel_new();
+	start = clock();
+	if ( fact_load_axiom_buffer ( k, data, size ) != nAxioms )
+		puts("Wrong number of axioms loaded from the buffer");
+	tLoad = seconds(start);
+
+	printf ( "%d axioms\n", nAxioms );
+	printf ( "per-call API:  %.2f s (%.2f M axioms/s)\n", tCall, nAxioms/tCall/1e6 );
+	printf ( "axiom buffer:  %.2f s to encode, %.2f s to load (%.2f M axioms/s), %.1f bytes per axiom\n",
+		tEncode, tLoad, nAxioms/tLoad/1e6, (double)size/nAxioms );
+
+	fact_axiom_buffer_free(b);
+	fact_reasoning_kernel_free(k);
+	return 0;
+}
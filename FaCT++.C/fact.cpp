@@ -16,13 +16,25 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <cstring>
+#include <fstream>
+
 #include "fact.h"
 #include "Kernel.h"
 #include "Actor.h"
+#include "tOWLFunctionalParser.h"
+#include "eFPPSyntaxError.h"
+#include "tAxiomBuffer.h"
 
 /// class for acting with a taxonomy at a C level
 class CActor: public Actor
 {
+protected:	// members
+		/// IDs of the found entries
+	IdVector Ids;
+		/// start of every synonym group in Ids
+	IdVector Offsets;
+
 protected:	// methods
 		/// build the NULL-terminated array of names of entries
 	const char** buildArray ( const Array1D& vec ) const
@@ -68,6 +80,12 @@ public:		// interface
 		getFoundData(vec);
 		return buildArray(vec);
 	}
+		/// gather IDs of all required elements of the taxonomy
+	void buildIds ( void ) { getFoundIds ( Ids, Offsets ); }
+		/// get IDs gathered by buildIds()
+	const IdVector& getIds ( void ) const { return Ids; }
+		/// get the start of every synonym group (and the total number of IDs) gathered by buildIds()
+	const IdVector& getOffsets ( void ) const { return Offsets; }
 }; // Actor
 
 // type declarations
@@ -104,6 +122,8 @@ DECLARE_STRUCT(fact_data_value_expression,ReasoningKernel::TDataValueExpr);
 DECLARE_STRUCT(fact_facet_expression,ReasoningKernel::TFacetExpr);
 // actor to traverse taxonomy
 DECLARE_STRUCT(fact_actor,CActor);
+// encoder of binary axiom buffers
+DECLARE_STRUCT(fact_axiom_buffer,TAxiomBufferWriter);
 
 const char *fact_get_version ()
 {
@@ -178,6 +198,76 @@ int fact_clear_kb (fact_reasoning_kernel *k)
 	return k->p->clearKB();
 }
 
+void fact_push_context (fact_reasoning_kernel *k)
+{
+	k->p->pushContext();
+}
+void fact_pop_context (fact_reasoning_kernel *k)
+{
+	k->p->popContext();
+}
+
+int fact_load_owl_functional (fact_reasoning_kernel *k, const char *filename, size_t *n_axioms)
+{
+	std::ifstream in(filename);
+	if ( !in.good() )
+		return -1;
+	TOWLFunctionalParser parser ( *k->p, in );
+	int ret = 0;
+	try { parser.Parse(); }
+	catch ( const EFPPSyntaxError& ) { ret = -2; }
+	catch ( const std::exception& ) { ret = -3; }
+	if ( n_axioms != NULL )
+		*n_axioms = parser.getAxiomNumber();
+	return ret;
+}
+
+fact_axiom_buffer *fact_axiom_buffer_new (void)
+{
+	return new fact_axiom_buffer_st(new TAxiomBufferWriter());
+}
+void fact_axiom_buffer_free (fact_axiom_buffer *b)
+{
+	delete b->p;
+	delete b;
+}
+unsigned int fact_axiom_buffer_name (fact_axiom_buffer *b, const char *name)
+{
+	return b->p->name(name);
+}
+// the tags of fact.h should be the same as the kernel ones
+#define CHECK_TAG(c,k) typedef char check_ ## c [ (int)c == (int)k ? 1 : -1 ]
+CHECK_TAG(fact_ab_data_exact,abDataExact);
+CHECK_TAG(fact_ab_max_exclusive,abMaxExclusive);
+CHECK_TAG(fact_ab_negative_data_assertion,abNegativeDataAssertion);
+#undef CHECK_TAG
+
+void fact_axiom_buffer_tag (fact_axiom_buffer *b, enum fact_axiom_buffer_tag tag)
+{
+	b->p->tag(static_cast<AxiomBufferTag>(tag));
+}
+void fact_axiom_buffer_num (fact_axiom_buffer *b, unsigned long n)
+{
+	b->p->num(n);
+}
+void fact_axiom_buffer_literal (fact_axiom_buffer *b, const char *value)
+{
+	b->p->literal(value);
+}
+const void *fact_axiom_buffer_data (fact_axiom_buffer *b, size_t *size)
+{
+	const std::vector<unsigned char>& buf = b->p->getBuffer();
+	*size = buf.size();
+	return &buf[0];
+}
+
+int fact_load_axiom_buffer (fact_reasoning_kernel *k, const void *data, size_t size)
+{
+	TAxiomBufferLoader loader ( *k->p, data, size );
+	try { return loader.Load(); }
+	catch ( const EFaCTPlusPlus& ) { return -1; }
+}
+
 fact_axiom *fact_declare (fact_reasoning_kernel *k, fact_expression *c)
 {
 	return new fact_axiom_st(k->p->declare(c->p));
@@ -458,6 +548,43 @@ int fact_is_equivalent (fact_reasoning_kernel *k, fact_concept_expression *c,
 	return k->p->isEquivalent(c->p,d->p);
 }
 
+/// find the justifications of C [= D (of the unsatisfiability of C if D is NULL)
+size_t fact_get_justifications (fact_reasoning_kernel *k, fact_concept_expression *c,
+		fact_concept_expression *d, unsigned int max_count, unsigned long time_limit,
+		size_t* n_ids, int* complete)
+{
+	*complete = k->p->computeJustifications ( c->p, d == NULL ? NULL : d->p, max_count, time_limit );
+	const std::vector<AxiomVec>& J = k->p->getJustifications();
+	*n_ids = 0;
+	for ( std::vector<AxiomVec>::const_iterator p = J.begin(), p_end = J.end(); p != p_end; ++p )
+		*n_ids += p->size();
+	return J.size();
+}
+/// write IDs of the axioms of the last found justifications to IDS, and the start of every justification to OFFSETS
+int fact_get_justification_ids (fact_reasoning_kernel *k, unsigned int* ids, size_t ids_size, unsigned int* offsets, size_t offsets_size)
+{
+	const std::vector<AxiomVec>& J = k->p->getJustifications();
+	size_t n = 0;
+	for ( std::vector<AxiomVec>::const_iterator p = J.begin(), p_end = J.end(); p != p_end; ++p )
+		n += p->size();
+	if ( n > ids_size || J.size()+1 > offsets_size )
+		return -1;
+	n = 0;
+	for ( std::vector<AxiomVec>::const_iterator p = J.begin(), p_end = J.end(); p != p_end; ++p )
+	{
+		*offsets++ = n;
+		for ( AxiomVec::const_iterator q = p->begin(), q_end = p->end(); q != q_end; ++q, ++n )
+			*ids++ = (*q)->getId();
+	}
+	*offsets = n;
+	return 0;
+}
+/// @return the ID of the AXIOM
+unsigned int fact_get_axiom_id (fact_axiom *axiom)
+{
+	return axiom->p->getId();
+}
+
 void fact_get_sup_concepts (fact_reasoning_kernel *k, fact_concept_expression *c,
 		int direct, fact_actor **actor)
 {
@@ -480,6 +607,20 @@ void fact_get_disjoint_concepts (fact_reasoning_kernel *k,
 {
 	k->p->getDisjointConcepts(c->p,*(*actor)->p);
 }
+void fact_get_concept_positions (fact_reasoning_kernel *k,
+		fact_concept_expression **c, unsigned int n,
+		fact_actor **parents, fact_actor **equivalents)
+{
+	ReasoningKernel::ConceptExprVec Cs(n);
+	std::vector<CActor*> Parents(n), Equivalents(n);
+	for ( unsigned int i = 0; i < n; ++i )
+	{
+		Cs[i] = c[i]->p;
+		Parents[i] = parents[i]->p;
+		Equivalents[i] = equivalents[i]->p;
+	}
+	k->p->getConceptPositions(Cs,Parents,Equivalents);
+}
 
 void fact_get_sup_roles (fact_reasoning_kernel *k, fact_role_expression *r,
 		int direct,
@@ -596,6 +737,35 @@ const char** fact_get_elements_1d ( fact_actor* actor )
 {
 	return actor->p->getElements1D();
 }
+/// get the number of IDs and the number of synonym groups in the result
+void fact_get_result_size ( fact_actor* actor, size_t* n_ids, size_t* n_groups )
+{
+	actor->p->buildIds();
+	*n_ids = actor->p->getIds().size();
+	*n_groups = actor->p->getOffsets().size()-1;
+}
+/// write IDs of all required elements of the taxonomy to IDS, and the start of every synonym group to OFFSETS
+int fact_get_element_ids ( fact_actor* actor, unsigned int* ids, size_t ids_size, unsigned int* offsets, size_t offsets_size )
+{
+	actor->p->buildIds();
+	const CActor::IdVector& vec = actor->p->getIds();
+	const CActor::IdVector& off = actor->p->getOffsets();
+	if ( vec.size() > ids_size || off.size() > offsets_size )
+		return -1;
+	if ( !vec.empty() )
+		memcpy ( ids, &vec[0], vec.size()*sizeof(unsigned int) );
+	memcpy ( offsets, &off[0], off.size()*sizeof(unsigned int) );
+	return 0;
+}
+/// write the names of all entities of the actor's kind to NAMES, indexed by ID
+size_t fact_get_entity_names ( fact_reasoning_kernel *k, fact_actor* actor, const char** names, size_t size )
+{
+	std::vector<const char*> vec;
+	k->p->getEntityNames ( *actor->p, vec );
+	if ( !vec.empty() && vec.size() <= size )
+		memcpy ( names, &vec[0], vec.size()*sizeof(const char*) );
+	return vec.size();
+}
 
 /// opens new argument list
 void fact_new_arg_list ( fact_reasoning_kernel *k )
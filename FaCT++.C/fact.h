@@ -19,6 +19,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef __FACT_H__
 #define __FACT_H__
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -56,6 +58,8 @@ DECLARE_STRUCT(fact_data_value_expression);
 DECLARE_STRUCT(fact_facet_expression);
 /* actor to traverse taxonomy */
 DECLARE_STRUCT(fact_actor);
+/* encoder of binary axiom buffers */
+DECLARE_STRUCT(fact_axiom_buffer);
 
 #undef DECLARE_STRUCT
 
@@ -89,6 +93,140 @@ int fact_new_kb (fact_reasoning_kernel *);
 int fact_release_kb (fact_reasoning_kernel *);
 int fact_clear_kb (fact_reasoning_kernel *);
 
+/* hypothetical contexts; axioms told inside a context are retracted when it is popped, their handles stay valid */
+void fact_push_context (fact_reasoning_kernel *);
+void fact_pop_context (fact_reasoning_kernel *);
+
+/* load axioms from a file in the OWL 2 functional syntax; axioms with unsupported datatypes are skipped.
+ * Put the number of axioms read into N_AXIOMS (if not NULL); return 0 on success,
+ * -1 if the file can not be opened, -2 if it is malformed, or -3 if the reasoner rejects it
+ * (the axioms before the failed one stay loaded) */
+int fact_load_owl_functional (fact_reasoning_kernel *, const char *filename, size_t *n_axioms);
+
+/*
+ * Binary axiom buffer format (the tags are the same as the ones the kernel uses).
+ *
+ * All the numbers are unsigned LEB128 varints. The buffer is
+ *
+ *   'F' 'P' 'A' 'B' <version byte = 1>
+ *   <number of names N> N x ( <length of the prefix shared with the previous name> <suffix length> <suffix bytes> )
+ *   axiom* (till the end of the buffer)
+ *
+ * Names get IDs 0..N-1 in their order. Every axiom and every expression is written in
+ * prefix form: the tag byte, then the arguments. An argument is
+ *   C  -- class expression,   R -- object role expression,  A -- data role expression,
+ *   I  -- individual (fact_ab_individual <name id>),  D -- data range,  V -- literal,
+ *   n  -- a number,  C* (etc.) -- <number of elements> followed by the elements.
+ */
+enum fact_axiom_buffer_tag
+{
+	/* class expressions */
+	fact_ab_top = 1,
+	fact_ab_bottom,
+	fact_ab_concept,	/* <name id> */
+	fact_ab_and,	/* C* */
+	fact_ab_or,	/* C* */
+	fact_ab_not,	/* C */
+	fact_ab_one_of,	/* I* */
+	fact_ab_object_some,	/* R C */
+	fact_ab_object_all,	/* R C */
+	fact_ab_object_value,	/* R I */
+	fact_ab_object_self,	/* R */
+	fact_ab_object_min,	/* n R C */
+	fact_ab_object_max,	/* n R C */
+	fact_ab_object_exact,	/* n R C */
+	fact_ab_data_some,	/* A D */
+	fact_ab_data_all,	/* A D */
+	fact_ab_data_value,	/* A V */
+	fact_ab_data_min,	/* n A D */
+	fact_ab_data_max,	/* n A D */
+	fact_ab_data_exact,	/* n A D */
+
+	/* individuals */
+	fact_ab_individual,	/* <name id> */
+
+	/* object roles */
+	fact_ab_o_role_top,
+	fact_ab_o_role_bottom,
+	fact_ab_o_role,	/* <name id> */
+	fact_ab_inverse,	/* R */
+	fact_ab_chain,	/* R* (only as the sub-role of fact_ab_sub_object_property) */
+
+	/* data roles */
+	fact_ab_d_role_top,
+	fact_ab_d_role_bottom,
+	fact_ab_d_role,	/* <name id> */
+
+	/* data ranges and literals */
+	fact_ab_data_top,
+	fact_ab_data_bottom,
+	fact_ab_data_type,	/* <name id of a standard datatype IRI> */
+	fact_ab_data_not,	/* D */
+	fact_ab_data_and,	/* D* */
+	fact_ab_data_or,	/* D* */
+	fact_ab_data_one_of,	/* V* */
+	fact_ab_data_restriction,	/* D (a datatype) <number of facets> ( <facet tag> V )* */
+	fact_ab_literal,	/* <length> <lexical form bytes> D (a datatype) */
+	fact_ab_min_inclusive,	/* facet tags */
+	fact_ab_min_exclusive,
+	fact_ab_max_inclusive,
+	fact_ab_max_exclusive,
+
+	/* axioms */
+	fact_ab_declaration = 64,	/* C (a name) | I | R (a name) | A (a name) */
+	fact_ab_sub_class_of,	/* C C */
+	fact_ab_equivalent_classes,	/* C* */
+	fact_ab_disjoint_classes,	/* C* */
+	fact_ab_disjoint_union,	/* C C* */
+	fact_ab_sub_object_property,	/* R (or a chain) R */
+	fact_ab_equivalent_object_properties,	/* R* */
+	fact_ab_disjoint_object_properties,	/* R* */
+	fact_ab_inverse_object_properties,	/* R R */
+	fact_ab_object_domain,	/* R C */
+	fact_ab_object_range,	/* R C */
+	fact_ab_functional_object,	/* R */
+	fact_ab_inverse_functional,	/* R */
+	fact_ab_reflexive,	/* R */
+	fact_ab_irreflexive,	/* R */
+	fact_ab_symmetric,	/* R */
+	fact_ab_asymmetric,	/* R */
+	fact_ab_transitive,	/* R */
+	fact_ab_sub_data_property,	/* A A */
+	fact_ab_equivalent_data_properties,	/* A* */
+	fact_ab_disjoint_data_properties,	/* A* */
+	fact_ab_data_domain,	/* A C */
+	fact_ab_data_range,	/* A D */
+	fact_ab_functional_data,	/* A */
+	fact_ab_same_individuals,	/* I* */
+	fact_ab_different_individuals,	/* I* */
+	fact_ab_class_assertion,	/* I C */
+	fact_ab_object_assertion,	/* I R I */
+	fact_ab_negative_object_assertion,	/* I R I */
+	fact_ab_data_assertion,	/* I A V */
+	fact_ab_negative_data_assertion	/* I A V */
+};
+
+/* binary axiom buffers (see above for the format and the tags).
+ * An axiom is written as its tag followed by its arguments in prefix form, e.g.
+ * SubClassOf(A, some R B) is
+ *   tag(fact_ab_sub_class_of) tag(fact_ab_concept) num(name("A"))
+ *   tag(fact_ab_object_some) tag(fact_ab_o_role) num(name("R")) tag(fact_ab_concept) num(name("B")) */
+fact_axiom_buffer *fact_axiom_buffer_new (void);
+void fact_axiom_buffer_free (fact_axiom_buffer *);
+/* return ID of a name, adding it to the name table of the buffer if necessary */
+unsigned int fact_axiom_buffer_name (fact_axiom_buffer *, const char *name);
+void fact_axiom_buffer_tag (fact_axiom_buffer *, enum fact_axiom_buffer_tag tag);
+void fact_axiom_buffer_num (fact_axiom_buffer *, unsigned long n);
+/* write fact_ab_literal with a lexical form VALUE; the datatype should follow */
+void fact_axiom_buffer_literal (fact_axiom_buffer *, const char *value);
+/* return the encoded buffer and its size; valid until the next change of the buffer */
+const void *fact_axiom_buffer_data (fact_axiom_buffer *, size_t *size);
+
+/* load all the axioms from an encoded buffer;
+ * return the number of axioms, or -1 if the buffer is malformed
+ * (the axioms before the malformed one stay loaded) */
+int fact_load_axiom_buffer (fact_reasoning_kernel *, const void *data, size_t size);
+
 fact_axiom *fact_declare (fact_reasoning_kernel *, fact_expression *c);
 fact_axiom *fact_implies_concepts (fact_reasoning_kernel *,
 		fact_concept_expression *c,
@@ -204,6 +342,18 @@ int fact_is_disjoint (fact_reasoning_kernel *, fact_concept_expression *c,
 int fact_is_equivalent (fact_reasoning_kernel *, fact_concept_expression *c,
 		fact_concept_expression *d);
 
+/* justifications of C [= D (of the unsatisfiability of C if D is NULL) are minimal sets of axioms entailing it; */
+/* find at most MAX_COUNT (0 for all) of them in TIME_LIMIT ms (0 for no limit) and write the total number of their */
+/* axiom IDs to N_IDS. @return the number of the found justifications; COMPLETE is set to 1 iff all of them were found */
+size_t fact_get_justifications (fact_reasoning_kernel *, fact_concept_expression *c,
+		fact_concept_expression *d, unsigned int max_count, unsigned long time_limit,
+		size_t* n_ids, int* complete);
+/* write IDs of the axioms of the justifications found by the last fact_get_justifications() to IDS, and the start of */
+/* every justification to OFFSETS; OFFSETS gets n+1 elements, the last one being n_ids. @return 0, or -1 if a buffer is too small */
+int fact_get_justification_ids (fact_reasoning_kernel *, unsigned int* ids, size_t ids_size, unsigned int* offsets, size_t offsets_size);
+/* @return the ID of the AXIOM: the axioms are numbered from 1 in the order they were added to the KB */
+unsigned int fact_get_axiom_id (fact_axiom *axiom);
+
 void fact_get_sup_concepts (fact_reasoning_kernel *, fact_concept_expression *c,
 		int direct, fact_actor **actor);
 void fact_get_sub_concepts (fact_reasoning_kernel *, fact_concept_expression *c,
@@ -214,6 +364,11 @@ void fact_get_equivalent_concepts (fact_reasoning_kernel *,
 void fact_get_disjoint_concepts (fact_reasoning_kernel *,
 		fact_concept_expression *c,
 		fact_actor **actor);
+/* classify N concept expressions C[0..n-1] together; */
+/* fill PARENTS[i] with direct super-concepts and EQUIVALENTS[i] with synonyms of C[i] */
+void fact_get_concept_positions (fact_reasoning_kernel *,
+		fact_concept_expression **c, unsigned int n,
+		fact_actor **parents, fact_actor **equivalents);
 
 void fact_get_sup_roles (fact_reasoning_kernel *, fact_role_expression *r,
 		int direct, fact_actor **actor);
@@ -269,6 +424,16 @@ const char*** fact_get_elements_2d ( fact_actor* );
 /* get NULL-terminated 1D array of all required elements of the taxonomy */
 const char** fact_get_elements_1d ( fact_actor* );
 
+/* ID-based results: every entity of the actor's kind has a dense ID, see fact_get_entity_names() */
+/* get the number of IDs and the number of synonym groups in the result */
+void fact_get_result_size ( fact_actor*, size_t* n_ids, size_t* n_groups );
+/* write IDs of all required elements of the taxonomy to IDS, and the start of every synonym group to OFFSETS; */
+/* OFFSETS gets n_groups+1 elements, the last one being n_ids. @return 0, or -1 if a buffer is too small (nothing is written then) */
+int fact_get_element_ids ( fact_actor*, unsigned int* ids, size_t ids_size, unsigned int* offsets, size_t offsets_size );
+/* write the names of all entities of the actor's kind to NAMES, indexed by ID (NULL for unused IDs); */
+/* @return the number of IDs; nothing is written if it is greater than SIZE. The names are valid until the KB changes */
+size_t fact_get_entity_names ( fact_reasoning_kernel *k, fact_actor*, const char** names, size_t size );
+
 /* opens new argument list */
 void fact_new_arg_list ( fact_reasoning_kernel *k );
 /* add argument _a_rG to the current argument list */
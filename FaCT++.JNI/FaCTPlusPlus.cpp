@@ -16,12 +16,16 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <fstream>
+
 #include "uk_ac_manchester_cs_factplusplus_FaCTPlusPlus.h"
 #include "Kernel.h"
 #include "tJNICache.h"
 #include "JNIMonitor.h"
 #include "configure.h"
 #include "MemoryStat.h"
+#include "tOWLFunctionalParser.h"
+#include "tAxiomBuffer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -90,6 +94,10 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_initKe
 	Kernel->setDumpOntology(Kernel->getOptions()->getBool("dumpOntology"));
 	// init incremental reasoning
 	Kernel->setUseIncrementalReasoning(Kernel->getOptions()->getBool("useIncrementalReasoning"));
+	// init modular classification
+	Kernel->setUseModularClassification(Kernel->getOptions()->getBool("useModularClassification"));
+	// init lazy classification
+	Kernel->setUseLazyClassification(Kernel->getOptions()->getBool("useLazyClassification"));
 
 	// setup JNI cache
 	TJNICache* J = new TJNICache(env);
@@ -213,6 +221,52 @@ JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_endCha
 	// do nothing for now
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    loadOWLFunctionalFile
+ * Signature: (Ljava/lang/String;)I
+ */
+JNIEXPORT jint JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_loadOWLFunctionalFile
+  (JNIEnv * env, jobject obj, jstring str)
+{
+	TRACE_JNI("loadOWLFunctionalFile");
+	TRACE_STR(env,str);
+	JString name(env,str);
+	std::ifstream in(name());
+	if ( !in.good() )
+	{
+		Throw ( env, "FaCT++ Kernel: cannot open ontology file" );
+		return 0;
+	}
+	TOWLFunctionalParser parser ( *getK(env,obj), in );
+	try { return parser.Parse(); }
+	catch ( const EFaCTPlusPlus& fpp )
+	{ Throw ( env, fpp.what() ); }
+	return 0;
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    loadAxiomBuffer
+ * Signature: (Ljava/nio/ByteBuffer;I)I
+ */
+JNIEXPORT jint JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_loadAxiomBuffer
+  (JNIEnv * env, jobject obj, jobject buffer, jint size)
+{
+	TRACE_JNI("loadAxiomBuffer");
+	const void* data = env->GetDirectBufferAddress(buffer);
+	if ( data == NULL || size < 0 || size > env->GetDirectBufferCapacity(buffer) )
+	{
+		Throw ( env, "FaCT++ Kernel: axiom buffer should be a direct buffer" );
+		return 0;
+	}
+	TAxiomBufferLoader loader ( *getK(env,obj), data, size );
+	try { return loader.Load(); }
+	catch ( const EFaCTPlusPlus& fpp )
+	{ Throw ( env, fpp.what() ); }
+	return 0;
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    needTracing
@@ -79,12 +79,14 @@ public:		// interface
 		/// taxonomy walking method.
 		/// @return true if node was processed, and there is no need to go further
 		/// @return false if node can not be processed in current settings
-	bool apply ( const TaxonomyVertex& v )
+	bool apply ( const TaxonomyVertex& v ) { return apply ( v.getPrimer(), v.begin_syn(), v.end_syn() ); }
+		/// taxonomy walking method for an ENTRY with synonyms [BEGIN,END) that is kept outside of the graph
+	bool apply ( const ClassifiableEntry* entry, TaxonomyVertex::syn_iterator begin, TaxonomyVertex::syn_iterator end )
 	{
 		syn.clear();
-		tryEntry(v.getPrimer());
+		tryEntry(entry);
 
-		for ( TaxonomyVertex::syn_iterator p = v.begin_syn(), p_end=v.end_syn(); p != p_end; ++p )
+		for ( TaxonomyVertex::syn_iterator p = begin; p != end; ++p )
 			tryEntry(*p);
 
 		/// no applicable elements were found
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "Kernel.h"
 #include "tJNICache.h"
 #include "JNIActor.h"
+#include "Actor.h"
 #include "eFPPTimeout.h"
 #include "MemoryStat.h"
 
@@ -169,6 +170,40 @@ JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_is
 	return ret;
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askJustifications
+ * Signature: (Luk/ac/manchester/cs/factplusplus/ClassPointer;Luk/ac/manchester/cs/factplusplus/ClassPointer;IJ)[[Luk/ac/manchester/cs/factplusplus/AxiomPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askJustifications
+  (JNIEnv * env, jobject obj, jobject arg1, jobject arg2, jint maxCount, jlong timeLimit)
+{
+	MemoryStatistics MS("askJustifications");
+	TRACE_JNI("askJustifications");
+	TRACE_ARG(env,obj,arg1);
+	jobjectArray ret = NULL;
+	PROCESS_SIMPLE_QUERY (
+		J->K->computeJustifications ( getROConceptExpr(env,arg1), arg2 == NULL ? NULL : getROConceptExpr(env,arg2), maxCount, timeLimit );
+		const std::vector<AxiomVec>& Just = J->K->getJustifications();
+		ret = env->NewObjectArray ( Just.size(), J->AxiomPointer.ArrayClassID, NULL );
+		for ( unsigned int i = 0; i < Just.size(); ++i )
+			env->SetObjectArrayElement ( ret, i, J->buildArray ( Just[i], J->AxiomPointer ) );
+	);
+	return ret;
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    areJustificationsComplete
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_areJustificationsComplete
+  (JNIEnv * env, jobject obj)
+{
+	TRACE_JNI("areJustificationsComplete");
+	return getK(env,obj)->areJustificationsComplete();
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    askSubClasses
@@ -238,6 +273,47 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 	return actor.getElements();
 }
 
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askClassPositions
+ * Signature: ([Luk/ac/manchester/cs/factplusplus/ClassPointer;)[[[Luk/ac/manchester/cs/factplusplus/ClassPointer;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askClassPositions
+  (JNIEnv * env, jobject obj, jobjectArray args)
+{
+	MemoryStatistics MS("getClassPositions");
+	TRACE_JNI("askClassPositions");
+	TJNICache* J = getJ(env,obj);
+	typedef JTaxonomyActor<ClassPolicy> ClassActor;
+	const jsize n = env->GetArrayLength(args);
+	ReasoningKernel::ConceptExprVec Cs(n);
+	for ( jsize i = 0; i < n; ++i )
+		Cs[i] = getROConceptExpr ( env, env->GetObjectArrayElement ( args, i ) );
+	// actors for parents and equivalents of every argument
+	std::vector<ClassActor> Actors ( 2*n, ClassActor(J) );
+	std::vector<ClassActor*> Parents(n), Equivalents(n);
+	for ( jsize i = 0; i < n; ++i )
+	{
+		Parents[i] = &Actors[2*i];
+		Equivalents[i] = &Actors[2*i+1];
+	}
+	PROCESS_QUERY ( J->K->getConceptPositions(Cs,Parents,Equivalents) );
+
+	// every position is an array of synonyms followed by the arrays of direct parents
+	jobjectArray ret = env->NewObjectArray ( n, env->FindClass("[[Luk/ac/manchester/cs/factplusplus/ClassPointer;"), NULL );
+	for ( jsize i = 0; i < n; ++i )
+	{
+		jobjectArray parents = Parents[i]->getElements();
+		const jsize nParents = env->GetArrayLength(parents);
+		jobjectArray pos = env->NewObjectArray ( nParents+1, J->ClassPointer.ArrayClassID, NULL );
+		env->SetObjectArrayElement ( pos, 0, Equivalents[i]->getSynonyms() );
+		for ( jsize j = 0; j < nParents; ++j )
+			env->SetObjectArrayElement ( pos, j+1, env->GetObjectArrayElement ( parents, j ) );
+		env->SetObjectArrayElement ( ret, i, pos );
+	}
+	return ret;
+}
+
 /*
  * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
  * Method:    askSuperObjectProperties
@@ -837,6 +913,136 @@ JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlu
 
 }
 
+//-------------------------------------------------------------
+// ID-based queries
+//-------------------------------------------------------------
+
+/// @return int array FIELD of an object OBJ of a class CLS with at least SIZE elements; replace it if necessary
+static jintArray getIntArray ( JNIEnv * env, jobject obj, jclass cls, const char* field, size_t size )
+{
+	jfieldID id = env->GetFieldID ( cls, field, "[I" );
+	jintArray ret = (jintArray) env->GetObjectField ( obj, id );
+	if ( ret == NULL || (size_t)env->GetArrayLength(ret) < size )
+	{
+		ret = env->NewIntArray ( size < 16 ? 16 : 2*size );
+		env->SetObjectField ( obj, id, ret );
+	}
+	return ret;
+}
+
+/// write the IDs found by an ACTOR into an EntityIds object RESULT
+static void setEntityIds ( JNIEnv * env, jobject result, const Actor& actor )
+{
+	Actor::IdVector ids, offsets;
+	actor.getFoundIds ( ids, offsets );
+	jclass cls = env->GetObjectClass(result);
+	if ( !ids.empty() )
+		env->SetIntArrayRegion ( getIntArray ( env, result, cls, "ids", ids.size() ), 0, ids.size(), (const jint*)&ids[0] );
+	env->SetIntArrayRegion ( getIntArray ( env, result, cls, "offsets", offsets.size() ), 0, offsets.size(), (const jint*)&offsets[0] );
+	env->SetIntField ( result, env->GetFieldID ( cls, "groups", "I" ), offsets.size()-1 );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askSubClassIds
+ * Signature: (Luk/ac/manchester/cs/factplusplus/ClassPointer;ZLuk/ac/manchester/cs/factplusplus/EntityIds;)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askSubClassIds
+  (JNIEnv * env, jobject obj, jobject arg, jboolean direct, jobject result)
+{
+	TRACE_JNI("askSubClassIds");
+	TRACE_ARG(env,obj,arg);
+	Actor actor;
+	actor.needConcepts();
+	const TConceptExpr* p = getROConceptExpr(env,arg);
+	PROCESS_SIMPLE_QUERY ( J->K->getSubConcepts(p,direct,actor) );
+	setEntityIds ( env, result, actor );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askSuperClassIds
+ * Signature: (Luk/ac/manchester/cs/factplusplus/ClassPointer;ZLuk/ac/manchester/cs/factplusplus/EntityIds;)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askSuperClassIds
+  (JNIEnv * env, jobject obj, jobject arg, jboolean direct, jobject result)
+{
+	TRACE_JNI("askSuperClassIds");
+	TRACE_ARG(env,obj,arg);
+	Actor actor;
+	actor.needConcepts();
+	const TConceptExpr* p = getROConceptExpr(env,arg);
+	PROCESS_SIMPLE_QUERY ( J->K->getSupConcepts(p,direct,actor) );
+	setEntityIds ( env, result, actor );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askIndividualTypeIds
+ * Signature: (Luk/ac/manchester/cs/factplusplus/IndividualPointer;ZLuk/ac/manchester/cs/factplusplus/EntityIds;)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askIndividualTypeIds
+  (JNIEnv * env, jobject obj, jobject arg, jboolean direct, jobject result)
+{
+	TRACE_JNI("askIndividualTypeIds");
+	TRACE_ARG(env,obj,arg);
+	Actor actor;
+	actor.needConcepts();
+	const TIndividualExpr* p = getROIndividualExpr(env,arg);
+	PROCESS_SIMPLE_QUERY ( J->K->getTypes(p,direct,actor) );
+	setEntityIds ( env, result, actor );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    askInstanceIds
+ * Signature: (Luk/ac/manchester/cs/factplusplus/ClassPointer;ZLuk/ac/manchester/cs/factplusplus/EntityIds;)V
+ */
+JNIEXPORT void JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_askInstanceIds
+  (JNIEnv * env, jobject obj, jobject arg, jboolean direct, jobject result)
+{
+	TRACE_JNI("askInstanceIds");
+	TRACE_ARG(env,obj,arg);
+	Actor actor;
+	actor.needIndividuals();
+	const TConceptExpr* p = getROConceptExpr(env,arg);
+	PROCESS_SIMPLE_QUERY ( direct ? J->K->getDirectInstances(p,actor) : J->K->getInstances(p,actor) );
+	setEntityIds ( env, result, actor );
+}
+
+/*
+ * Class:     uk_ac_manchester_cs_factplusplus_FaCTPlusPlus
+ * Method:    getEntityNames
+ * Signature: (I)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_uk_ac_manchester_cs_factplusplus_FaCTPlusPlus_getEntityNames
+  (JNIEnv * env, jobject obj, jint kind)
+{
+	TRACE_JNI("getEntityNames");
+	Actor actor;
+	switch ( kind )
+	{
+	case 0: actor.needConcepts(); break;
+	case 1: actor.needIndividuals(); break;
+	case 2: actor.needObjectRoles(); break;
+	case 3: actor.needDataRoles(); break;
+	default:
+		Throw ( env, "FaCT++ Kernel: unknown kind of entities" );
+		return NULL;
+	}
+	std::vector<const char*> names;
+	PROCESS_SIMPLE_QUERY ( J->K->getEntityNames(actor,names) );
+	jobjectArray ret = env->NewObjectArray ( names.size(), env->FindClass("java/lang/String"), NULL );
+	for ( size_t i = 0; i < names.size(); ++i )
+		if ( names[i] != NULL )
+		{
+			jstring name = env->NewStringUTF(names[i]);
+			env->SetObjectArrayElement ( ret, i, name );
+			env->DeleteLocalRef(name);
+		}
+	return ret;
+}
+
 
 #undef PROCESS_QUERY
 #undef PROCESS_SIMPLE_QUERY
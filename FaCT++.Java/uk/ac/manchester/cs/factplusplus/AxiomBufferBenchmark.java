@@ -0,0 +1,92 @@
+package uk.ac.manchester.cs.factplusplus;
+
+/*
+ * Copyright (C) 2026 by Dmitry Tsarkov
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * Loads the same ABox through the per-axiom JNI calls and through a single
+ * axiom buffer, and prints the load times. Usage:
+ * <pre>
+ * java -Dfactpp.jni.path=.../libFaCTPlusPlusJNI.so uk.ac.manchester.cs.factplusplus.AxiomBufferBenchmark [individuals]
+ * </pre>
+ */
+public class AxiomBufferBenchmark {
+	private static final String NS = "http://example.org/ontologies/2026/people#";
+	private static final String DATA = "http://data.example.org/resource/individuals/";
+
+	private static String individual(int i) {
+		return String.format("%sperson_%07d", DATA, i);
+	}
+
+	/** class assertions for N individuals plus a chain of N-1 role assertions */
+	private static int loadPerCall(FaCTPlusPlus k, int n) throws FaCTPlusPlusException {
+		ObjectPropertyPointer r = k.getObjectProperty(NS + "knows");
+		for (int i = 0; i < n; i++) {
+			k.tellIndividualType(k.getIndividual(individual(i)), k.getNamedClass(NS + "Class" + i % 50));
+			if (i > 0) {
+				k.tellRelatedIndividuals(k.getIndividual(individual(i)), r, k.getIndividual(individual(i - 1)));
+			}
+		}
+		return 2 * n - 1;
+	}
+
+	/** the same axioms in a buffer */
+	private static void encode(AxiomBufferWriter w, int n) {
+		for (int i = 0; i < n; i++) {
+			w.tag(AxiomBufferWriter.CLASS_ASSERTION);
+			w.individual(individual(i));
+			w.concept(NS + "Class" + i % 50);
+			if (i > 0) {
+				w.tag(AxiomBufferWriter.OBJECT_ASSERTION);
+				w.individual(individual(i));
+				w.oRole(NS + "knows");
+				w.individual(individual(i - 1));
+			}
+		}
+	}
+
+	public static void main(String[] args) throws Exception {
+		int n = args.length > 0 ? Integer.parseInt(args[0]) : 500000;
+
+		FaCTPlusPlus k = new FaCTPlusPlus();
+		long start = System.nanoTime();
+		int nAxioms = loadPerCall(k, n);
+		double tCall = (System.nanoTime() - start) / 1e9;
+		k.dispose();
+
+		AxiomBufferWriter w = new AxiomBufferWriter();
+		start = System.nanoTime();
+		encode(w, n);
+		int size = w.getBuffer().limit();
+		double tEncode = (System.nanoTime() - start) / 1e9;
+
+		k = new FaCTPlusPlus();
+		start = System.nanoTime();
+		int loaded = k.loadAxioms(w);
+		double tLoad = (System.nanoTime() - start) / 1e9;
+		k.dispose();
+
+		if (loaded != nAxioms) {
+			System.out.println("Wrong number of axioms loaded from the buffer: " + loaded);
+		}
+		System.out.println(nAxioms + " axioms");
+		System.out.printf("per-call JNI:  %.2f s (%.2f M axioms/s)%n", tCall, nAxioms / tCall / 1e6);
+		System.out.printf("axiom buffer:  %.2f s to encode, %.2f s to load (%.2f M axioms/s), %.1f bytes per axiom%n",
+				tEncode, tLoad, nAxioms / (tEncode + tLoad) / 1e6, (double) size / nAxioms);
+	}
+}
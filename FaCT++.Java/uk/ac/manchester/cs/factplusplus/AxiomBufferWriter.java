@@ -0,0 +1,287 @@
+package uk.ac.manchester.cs.factplusplus;
+
+/*
+ * Copyright (C) 2026 by Dmitry Tsarkov
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+import java.nio.ByteBuffer;
+import java.nio.charset.Charset;
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * Encoder of binary axiom buffers, to be loaded into the reasoner by
+ * {@link FaCTPlusPlus#loadAxioms(AxiomBufferWriter)} in a single native call.
+ * The format and the tags are the same as in Kernel/tAxiomBufferTags.h:
+ * every axiom is its tag followed by its arguments in prefix form, and the
+ * entities are referenced by the IDs of their names. For example,
+ * SubClassOf(A, ObjectSomeValuesFrom(R, B)) is written as
+ *
+ * <pre>
+ * w.tag(SUB_CLASS_OF); w.concept("A");
+ * w.tag(OBJECT_SOME); w.oRole("R"); w.concept("B");
+ * </pre>
+ */
+public class AxiomBufferWriter {
+
+	// class expressions
+	public static final int TOP = 1;
+	public static final int BOTTOM = 2;
+	public static final int CONCEPT = 3;	// <name id>
+	public static final int AND = 4;	// C*
+	public static final int OR = 5;	// C*
+	public static final int NOT = 6;	// C
+	public static final int ONE_OF = 7;	// I*
+	public static final int OBJECT_SOME = 8;	// R C
+	public static final int OBJECT_ALL = 9;	// R C
+	public static final int OBJECT_VALUE = 10;	// R I
+	public static final int OBJECT_SELF = 11;	// R
+	public static final int OBJECT_MIN = 12;	// n R C
+	public static final int OBJECT_MAX = 13;	// n R C
+	public static final int OBJECT_EXACT = 14;	// n R C
+	public static final int DATA_SOME = 15;	// A D
+	public static final int DATA_ALL = 16;	// A D
+	public static final int DATA_VALUE = 17;	// A V
+	public static final int DATA_MIN = 18;	// n A D
+	public static final int DATA_MAX = 19;	// n A D
+	public static final int DATA_EXACT = 20;	// n A D
+
+	// individuals
+	public static final int INDIVIDUAL = 21;	// <name id>
+
+	// object roles
+	public static final int O_ROLE_TOP = 22;
+	public static final int O_ROLE_BOTTOM = 23;
+	public static final int O_ROLE = 24;	// <name id>
+	public static final int INVERSE = 25;	// R
+	public static final int CHAIN = 26;	// R* (only as the sub-role of SUB_OBJECT_PROPERTY)
+
+	// data roles
+	public static final int D_ROLE_TOP = 27;
+	public static final int D_ROLE_BOTTOM = 28;
+	public static final int D_ROLE = 29;	// <name id>
+
+	// data ranges and literals
+	public static final int DATA_TOP = 30;
+	public static final int DATA_BOTTOM = 31;
+	public static final int DATA_TYPE = 32;	// <name id of a standard datatype IRI>
+	public static final int DATA_NOT = 33;	// D
+	public static final int DATA_AND = 34;	// D*
+	public static final int DATA_OR = 35;	// D*
+	public static final int DATA_ONE_OF = 36;	// V*
+	public static final int DATA_RESTRICTION = 37;	// D (a datatype) <number of facets> ( <facet tag> V )*
+	public static final int LITERAL = 38;	// <length> <lexical form bytes> D (a datatype)
+	public static final int MIN_INCLUSIVE = 39;	// facet tags
+	public static final int MIN_EXCLUSIVE = 40;
+	public static final int MAX_INCLUSIVE = 41;
+	public static final int MAX_EXCLUSIVE = 42;
+
+	// axioms
+	public static final int DECLARATION = 64;	// C (a name) | I | R (a name) | A (a name)
+	public static final int SUB_CLASS_OF = 65;	// C C
+	public static final int EQUIVALENT_CLASSES = 66;	// C*
+	public static final int DISJOINT_CLASSES = 67;	// C*
+	public static final int DISJOINT_UNION = 68;	// C C*
+	public static final int SUB_OBJECT_PROPERTY = 69;	// R (or a chain) R
+	public static final int EQUIVALENT_OBJECT_PROPERTIES = 70;	// R*
+	public static final int DISJOINT_OBJECT_PROPERTIES = 71;	// R*
+	public static final int INVERSE_OBJECT_PROPERTIES = 72;	// R R
+	public static final int OBJECT_DOMAIN = 73;	// R C
+	public static final int OBJECT_RANGE = 74;	// R C
+	public static final int FUNCTIONAL_OBJECT = 75;	// R
+	public static final int INVERSE_FUNCTIONAL = 76;	// R
+	public static final int REFLEXIVE = 77;	// R
+	public static final int IRREFLEXIVE = 78;	// R
+	public static final int SYMMETRIC = 79;	// R
+	public static final int ASYMMETRIC = 80;	// R
+	public static final int TRANSITIVE = 81;	// R
+	public static final int SUB_DATA_PROPERTY = 82;	// A A
+	public static final int EQUIVALENT_DATA_PROPERTIES = 83;	// A*
+	public static final int DISJOINT_DATA_PROPERTIES = 84;	// A*
+	public static final int DATA_DOMAIN = 85;	// A C
+	public static final int DATA_RANGE = 86;	// A D
+	public static final int FUNCTIONAL_DATA = 87;	// A
+	public static final int SAME_INDIVIDUALS = 88;	// I*
+	public static final int DIFFERENT_INDIVIDUALS = 89;	// I*
+	public static final int CLASS_ASSERTION = 90;	// I C
+	public static final int OBJECT_ASSERTION = 91;	// I R I
+	public static final int NEGATIVE_OBJECT_ASSERTION = 92;	// I R I
+	public static final int DATA_ASSERTION = 93;	// I A V
+	public static final int NEGATIVE_DATA_ASSERTION = 94;	// I A V
+
+	/** version of the format */
+	public static final int VERSION = 1;
+
+	private static final Charset UTF8 = Charset.forName("UTF-8");
+
+	/** IDs of the names used so far */
+	private final Map<String, Integer> nameIds = new HashMap<String, Integer>();
+	/** encoded name table */
+	private final Bytes names = new Bytes();
+	/** encoded axioms */
+	private final Bytes axioms = new Bytes();
+	/** the last name in the table (the next one is encoded w.r.t. it) */
+	private byte[] lastName = new byte[0];
+	/** the whole buffer; reused between the batches */
+	private ByteBuffer buffer = null;
+	/** number of the axioms written */
+	private int nAxioms = 0;
+
+	/** growable byte array */
+	private static final class Bytes {
+		byte[] data = new byte[4096];
+		int size = 0;
+
+		void ensure(int n) {
+			if (size + n > data.length) {
+				byte[] d = new byte[Math.max(2 * data.length, size + n)];
+				System.arraycopy(data, 0, d, 0, size);
+				data = d;
+			}
+		}
+
+		void put(int b) {
+			ensure(1);
+			data[size++] = (byte) b;
+		}
+
+		void put(byte[] b, int from, int len) {
+			ensure(len);
+			System.arraycopy(b, from, data, size, len);
+			size += len;
+		}
+
+		void putNum(long n) {
+			while (n >= 0x80) {
+				put((int) (n & 0x7F) | 0x80);
+				n >>>= 7;
+			}
+			put((int) n);
+		}
+	}
+
+	/** @return ID of a name; add it to the name table if necessary */
+	public int name(String name) {
+		Integer id = nameIds.get(name);
+		if (id != null) {
+			return id;
+		}
+		id = nameIds.size();
+		nameIds.put(name, id);
+		// store only the part that differs from the previous name
+		byte[] b = name.getBytes(UTF8);
+		int common = 0;
+		int max = Math.min(b.length, lastName.length);
+		while (common < max && b[common] == lastName[common]) {
+			common++;
+		}
+		names.putNum(common);
+		names.putNum(b.length - common);
+		names.put(b, common, b.length - common);
+		lastName = b;
+		return id;
+	}
+
+	/** write a tag */
+	public void tag(int t) {
+		if (t >= DECLARATION) {
+			nAxioms++;
+		}
+		axioms.put(t);
+	}
+
+	/** write a number (cardinality, size of a list, name ID) */
+	public void num(long n) {
+		axioms.putNum(n);
+	}
+
+	/** write a named class */
+	public void concept(String name) {
+		tag(CONCEPT);
+		num(name(name));
+	}
+
+	/** write an individual */
+	public void individual(String name) {
+		tag(INDIVIDUAL);
+		num(name(name));
+	}
+
+	/** write a named object property */
+	public void oRole(String name) {
+		tag(O_ROLE);
+		num(name(name));
+	}
+
+	/** write a named data property */
+	public void dRole(String name) {
+		tag(D_ROLE);
+		num(name(name));
+	}
+
+	/** write a standard datatype by its IRI */
+	public void dataType(String iri) {
+		tag(DATA_TYPE);
+		num(name(iri));
+	}
+
+	/** write the lexical form of a literal; the datatype should follow */
+	public void literal(String value) {
+		tag(LITERAL);
+		byte[] b = value.getBytes(UTF8);
+		num(b.length);
+		axioms.put(b, 0, b.length);
+	}
+
+	/** @return the number of the axioms written */
+	public int size() {
+		return nAxioms;
+	}
+
+	/**
+	 * @return direct buffer with the encoded axioms, positioned at 0 with the
+	 *         limit at the end of the data; valid until the next change
+	 */
+	public ByteBuffer getBuffer() {
+		Bytes header = new Bytes();
+		header.put('F');
+		header.put('P');
+		header.put('A');
+		header.put('B');
+		header.put(VERSION);
+		header.putNum(nameIds.size());
+		int size = header.size + names.size + axioms.size;
+		if (buffer == null || buffer.capacity() < size) {
+			buffer = ByteBuffer.allocateDirect(Math.max(size, 2 * (buffer == null ? 0 : buffer.capacity())));
+		}
+		buffer.clear();
+		buffer.put(header.data, 0, header.size);
+		buffer.put(names.data, 0, names.size);
+		buffer.put(axioms.data, 0, axioms.size);
+		buffer.flip();
+		return buffer;
+	}
+
+	/** forget all the names and axioms; the native buffer is kept for the next batch */
+	public void clear() {
+		nameIds.clear();
+		names.size = 0;
+		axioms.size = 0;
+		lastName = new byte[0];
+		nAxioms = 0;
+	}
+}
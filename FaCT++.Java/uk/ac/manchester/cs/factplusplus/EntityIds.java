@@ -0,0 +1,57 @@
+package uk.ac.manchester.cs.factplusplus;
+
+/*
+ * Copyright (C) 2026 by Dmitry Tsarkov
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * Result of an ID-based query: IDs of the entities grouped by synonyms. The
+ * group i consists of ids[offsets[i]] .. ids[offsets[i+1]-1]. The arrays are
+ * reused by the next query, and replaced only when they are too small, so a
+ * single object should be kept for many queries. Every kind of entities has
+ * its own IDs; the names are given by {@link FaCTPlusPlus#getEntityNames(int)}:
+ * <ul>
+ * <li>classes: 0 is owl:Thing, 1 is owl:Nothing, then the named classes;</li>
+ * <li>individuals: from 0;</li>
+ * <li>properties: 0 is the bottom property, 1 is the top property, then every
+ * property is followed by its inverse.</li>
+ * </ul>
+ */
+public class EntityIds {
+	/** kinds of entities for {@link FaCTPlusPlus#getEntityNames(int)} */
+	public static final int CLASSES = 0;
+	public static final int INDIVIDUALS = 1;
+	public static final int OBJECT_PROPERTIES = 2;
+	public static final int DATA_PROPERTIES = 3;
+
+	/** IDs of the entities; only the first getIdCount() are valid */
+	public int[] ids = new int[0];
+	/** start of every group in ids; only the first getGroupCount()+1 are valid */
+	public int[] offsets = new int[1];
+	/** number of the groups */
+	public int groups = 0;
+
+	/** @return the number of the groups */
+	public int getGroupCount() {
+		return groups;
+	}
+
+	/** @return the number of the IDs in all the groups */
+	public int getIdCount() {
+		return offsets[groups];
+	}
+}
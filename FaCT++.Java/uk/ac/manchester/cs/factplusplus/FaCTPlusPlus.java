@@ -1,5 +1,6 @@
 package uk.ac.manchester.cs.factplusplus;
 
+import java.nio.ByteBuffer;
 import java.util.concurrent.atomic.AtomicBoolean;
 
 /**
@@ -443,6 +444,20 @@ public class FaCTPlusPlus {
 
 	public native boolean isClassDisjointWith(ClassPointer c, ClassPointer d) throws FaCTPlusPlusException;
 
+	/**
+	 * Find justifications (minimal sets of axioms entailing it) of c [= d, or of the
+	 * unsatisfiability of c if d is null.
+	 * @param maxCount the maximal number of justifications to find; 0 for all
+	 * @param timeLimit the time limit of the search in milliseconds; 0 for none
+	 * @return the found justifications
+	 */
+	public native AxiomPointer[][] askJustifications(ClassPointer c, ClassPointer d, int maxCount, long timeLimit) throws FaCTPlusPlusException;
+
+	/**
+	 * @return true iff the last askJustifications() found all the justifications
+	 */
+	public native boolean areJustificationsComplete();
+
 	public native ClassPointer[][] askSubClasses(ClassPointer c, boolean direct) throws FaCTPlusPlusException;
 
 	public native ClassPointer[][] askSuperClasses(ClassPointer c, boolean direct) throws FaCTPlusPlusException;
@@ -451,6 +466,13 @@ public class FaCTPlusPlus {
 
 	public native ClassPointer[][] askDisjointClasses(ClassPointer c) throws FaCTPlusPlusException;
 
+	/**
+	 * Classify all the given class expressions together. For every class
+	 * expression the result contains an array of its synonyms followed by
+	 * the arrays of its direct super-classes.
+	 */
+	public native ClassPointer[][][] askClassPositions(ClassPointer[] c) throws FaCTPlusPlusException;
+
 	public native ObjectPropertyPointer[][] askSuperObjectProperties(ObjectPropertyPointer r, boolean direct)
 			throws FaCTPlusPlusException;
 
@@ -551,6 +573,29 @@ public class FaCTPlusPlus {
 	public native IndividualPointer[] getDataRelatedIndividuals(DataPropertyPointer r, DataPropertyPointer s, int op)
 			throws FaCTPlusPlusException;
 
+	// ------------------------------------------------------------------------
+	// ID-based queries: the results are written to an EntityIds object, that
+	// can be reused between the queries; see EntityIds for the meaning of IDs
+	// ------------------------------------------------------------------------
+
+	public native void askSubClassIds(ClassPointer c, boolean direct, EntityIds result) throws FaCTPlusPlusException;
+
+	public native void askSuperClassIds(ClassPointer c, boolean direct, EntityIds result) throws FaCTPlusPlusException;
+
+	public native void askIndividualTypeIds(IndividualPointer i, boolean direct, EntityIds result)
+			throws FaCTPlusPlusException;
+
+	// instances grouped by the SameAs relation
+	public native void askInstanceIds(ClassPointer c, boolean direct, EntityIds result) throws FaCTPlusPlusException;
+
+	/**
+	 * @return names of all the entities of a KIND (one of EntityIds.CLASSES,
+	 *         INDIVIDUALS, OBJECT_PROPERTIES, DATA_PROPERTIES), indexed by
+	 *         their IDs; null for unused IDs. The table stays valid until the
+	 *         ontology is changed
+	 */
+	public native String[] getEntityNames(int kind) throws FaCTPlusPlusException;
+
 	// ------------------------------------------------------------------------
 	// Options
 	// ------------------------------------------------------------------------
@@ -567,6 +612,29 @@ public class FaCTPlusPlus {
 
 	public native void endChanges();
 
+	/**
+	 * Loads axioms from a file in the OWL 2 functional syntax directly into the
+	 * reasoner, bypassing the per-axiom tell calls.
+	 * @return the number of axioms loaded
+	 */
+	public native int loadOWLFunctionalFile(String path) throws FaCTPlusPlusException;
+
+	/**
+	 * Loads all the axioms encoded by a writer in a single native call.
+	 * @return the number of axioms loaded
+	 */
+	public int loadAxioms(AxiomBufferWriter writer) throws FaCTPlusPlusException {
+		ByteBuffer buffer = writer.getBuffer();
+		return loadAxiomBuffer(buffer, buffer.limit());
+	}
+
+	/**
+	 * Loads SIZE bytes of axioms from a direct buffer in the format of
+	 * {@link AxiomBufferWriter}.
+	 * @return the number of axioms loaded
+	 */
+	public native int loadAxiomBuffer(ByteBuffer buffer, int size) throws FaCTPlusPlusException;
+
 	// ------------------------------------------------------------------------
 	// Argument list processing
 	// ------------------------------------------------------------------------
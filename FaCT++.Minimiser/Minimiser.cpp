@@ -0,0 +1,424 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// minimiser of slow queries: shrinks a LISP ontology to a minimal sub-ontology,
+// on which a (sat C) or (sub C D) query still takes longer than a given threshold
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "parser.h"
+#include "Kernel.h"
+#include "Modularity.h"
+#include "tSignatureUpdater.h"
+#include "tOntologyPrinterLISP.h"
+
+/// top/bottom role names of the LISP syntax
+static const char* const TopORole = "*UROLE*";
+static const char* const BotORole = "*EROLE*";
+static const char* const TopDRole = "*UDROLE*";
+static const char* const BotDRole = "*EDROLE*";
+
+/// @return processor time of the calling thread in seconds; the trials run in parallel
+static float
+threadTime ( void )
+{
+	struct timespec ts;
+	clock_gettime ( CLOCK_THREAD_CPUTIME_ID, &ts );
+	return ts.tv_sec + ts.tv_nsec/1e9f;
+}
+
+/// monitor that cancels the reasoning of a trial when the thread spent LIMIT seconds
+class TrialMonitor: public TProgressMonitor
+{
+protected:	// members
+		/// start time of the trial
+	float Start;
+		/// time limit in seconds; 0 means no limit
+	float Limit;
+		/// true iff the reasoning was cancelled
+	bool Expired;
+
+public:		// interface
+		/// init c'tor
+	TrialMonitor ( float limit ) : Start(threadTime()), Limit(limit), Expired(false) {}
+		/// empty d'tor
+	virtual ~TrialMonitor ( void ) {}
+
+		/// @return true iff the time is over
+	virtual bool isCancelled ( void )
+	{
+		if ( !Expired && Limit > 0 && elapsed() >= Limit )
+			Expired = true;
+		return Expired;
+	}
+		/// @return the time spent since the start of the trial
+	float elapsed ( void ) const { return threadTime() - Start; }
+		/// @return true iff the trial was cancelled
+	bool isExpired ( void ) const { return Expired; }
+}; // TrialMonitor
+
+/// the query to minimise
+struct Query
+{
+		/// (sat C) or (sub C D)
+	std::string Op;
+		/// the sub-concept
+	ReasoningKernel::TConceptExpr* C;
+		/// the super-concept; NULL for a satisfiability query
+	ReasoningKernel::TConceptExpr* D;
+}; // Query
+
+/// run the query Q over the AXIOMS with a fresh kernel, cancel it after LIMIT seconds;
+/// put the processor time to TIME and print the reasoning statistics to STAT if necessary.
+/// @return true iff the query took at least LIMIT seconds
+static bool
+runTrial ( const AxiomVec& Axioms, const Query& Q, float limit, float& time, std::ostream* stat = NULL )
+{
+	ReasoningKernel Kernel;
+	// the entities of the axioms are shared with the main kernel and the other trials
+	Kernel.setBindEntities(false);
+	Kernel.setTopBottomRoleNames ( TopORole, BotORole, TopDRole, BotDRole );
+	TrialMonitor* Monitor = new TrialMonitor(limit);
+	Kernel.setProgressMonitor(Monitor);
+	Kernel.getOntology().setShared(Axioms);
+
+	bool done = false;
+	try
+	{
+		if ( Q.D == NULL )
+			Kernel.isSatisfiable(Q.C);
+		else
+			Kernel.isSubsumedBy ( Q.C, Q.D );
+		done = true;
+	}
+	catch ( const EFPPInconsistentKB& ) { done = true; }
+	catch ( const EFaCTPlusPlus& ) {}	// e.g., the roles of the subset are incorrect: not the case to minimise
+
+	time = Monitor->elapsed();
+	bool slow = Monitor->isExpired() || ( limit > 0 && time >= limit );
+	if ( stat != NULL && done && !Monitor->isExpired() )
+		Kernel.writeReasoningResult ( *stat, time );
+
+	// the axioms belong to the main ontology
+	Kernel.getOntology().safeClear();
+	return slow;
+}
+
+/// delta debugging of the axioms of a slow query: the trials of a round run in parallel
+class SlowQueryMinimiser
+{
+protected:	// members
+		/// the query
+	const Query& Q;
+		/// time threshold of a slow trial
+	float Threshold;
+		/// candidate sets of the current round
+	std::vector<AxiomVec> Candidates;
+		/// lock of the job queue
+	pthread_mutex_t Lock;
+		/// index of the next candidate to check
+	size_t Next;
+		/// index of the first slow candidate; no need to check the ones after it
+	size_t FirstSlow;
+		/// number of the worker threads
+	unsigned int nThreads;
+		/// number of the trials
+	unsigned long nTrials;
+		/// number of the slow trials
+	unsigned long nSlow;
+
+protected:	// methods
+		/// thread body
+	static void* runWorker ( void* arg )
+	{
+		static_cast<SlowQueryMinimiser*>(arg)->checkCandidates();
+		return NULL;
+	}
+		/// check the candidates until they are over or there is a slow one before them
+	void checkCandidates ( void )
+	{
+		for (;;)
+		{
+			pthread_mutex_lock(&Lock);
+			size_t i = Next++;
+			bool skip = i >= Candidates.size() || i > FirstSlow;
+			if ( !skip )
+				++nTrials;
+			pthread_mutex_unlock(&Lock);
+			if ( skip )
+				return;
+
+			float time;
+			if ( runTrial ( Candidates[i], Q, Threshold, time ) )
+			{
+				pthread_mutex_lock(&Lock);
+				++nSlow;
+				if ( i < FirstSlow )
+					FirstSlow = i;
+				pthread_mutex_unlock(&Lock);
+			}
+		}
+	}
+		/// @return the index of the first slow candidate; Candidates.size() if none
+	size_t findSlowCandidate ( void )
+	{
+		Next = 0;
+		FirstSlow = Candidates.size();
+		size_t nWorkers = std::min ( (size_t)nThreads, Candidates.size() );
+		std::vector<pthread_t> Threads(nWorkers);
+		size_t i, nStarted = 1;
+		for ( i = 1; i < nWorkers; ++i, ++nStarted )
+			if ( pthread_create ( &Threads[i], NULL, runWorker, this ) != 0 )
+				break;	// the started workers will do the rest
+		checkCandidates();
+		for ( i = 1; i < nStarted; ++i )
+			pthread_join ( Threads[i], NULL );
+		return FirstSlow;
+	}
+
+public:		// interface
+		/// init c'tor
+	SlowQueryMinimiser ( const Query& q, float threshold, unsigned int threads )
+		: Q(q)
+		, Threshold(threshold)
+		, Next(0)
+		, FirstSlow(0)
+		, nThreads(threads > 0 ? threads : 1)
+		, nTrials(0)
+		, nSlow(0)
+	{
+		pthread_mutex_init ( &Lock, NULL );
+	}
+		/// d'tor
+	~SlowQueryMinimiser ( void ) { pthread_mutex_destroy(&Lock); }
+
+		/// @return a 1-minimal subset of the slow set of AXIOMS that is still slow
+	AxiomVec minimise ( const AxiomVec& Axioms )
+	{
+		AxiomVec Current(Axioms);
+		size_t n = 2;
+		while ( Current.size() >= 2 )
+		{
+			if ( n > Current.size() )
+				n = Current.size();
+			// the chunks of the current set first, then their complements
+			Candidates.assign ( n == 2 ? 2 : 2*n, AxiomVec() );
+			for ( size_t i = 0; i < Current.size(); ++i )
+			{
+				size_t chunk = i*n/Current.size();
+				Candidates[chunk].push_back(Current[i]);
+				if ( n > 2 )
+					for ( size_t j = 0; j < n; ++j )
+						if ( j != chunk )
+							Candidates[n+j].push_back(Current[i]);
+			}
+
+			size_t slow = findSlowCandidate();
+			std::cerr << "Round with " << n << " chunks of " << Current.size() << " axioms: ";
+			if ( slow < n )	// reduce to the chunk
+			{
+				Current.swap(Candidates[slow]);
+				n = 2;
+				std::cerr << "reduced to a chunk\n";
+			}
+			else if ( slow < Candidates.size() )	// reduce to the complement
+			{
+				Current.swap(Candidates[slow]);
+				n = std::max ( n-1, (size_t)2 );
+				std::cerr << "reduced to a complement\n";
+			}
+			else if ( n < Current.size() )	// increase the granularity
+			{
+				n = std::min ( 2*n, Current.size() );
+				std::cerr << "refined\n";
+			}
+			else	// every single axiom is necessary
+			{
+				std::cerr << "done\n";
+				break;
+			}
+		}
+		// the query itself might be slow
+		if ( Current.size() == 1 )
+		{
+			Candidates.assign ( 1, AxiomVec() );
+			if ( findSlowCandidate() == 0 )
+				Current.clear();
+		}
+		Candidates.clear();
+		return Current;
+	}
+
+		/// @return number of the trials
+	unsigned long getNTrials ( void ) const { return nTrials; }
+		/// @return number of the slow trials
+	unsigned long getNSlow ( void ) const { return nSlow; }
+}; // SlowQueryMinimiser
+
+/// print the AXIOMS in LISP syntax
+static void
+printAxioms ( std::ostream& o, const AxiomVec& Axioms )
+{
+	TLISPOntologyPrinter Printer(o);
+	for ( AxiomVec::const_iterator p = Axioms.begin(), p_end = Axioms.end(); p != p_end; ++p )
+		(*p)->accept(Printer);
+	o << std::endl;
+}
+
+inline void Usage ( void )
+{
+	std::cerr << "\nUsage:\tMinimiser [-threads N] [-timeout S] [-out File] <TBox file> <query> <threshold>\n"
+				 "\tquery is (sat C) or (sub C D) in LISP syntax, threshold is in seconds;\n"
+				 "\t-threads N runs N trials in parallel (the number of processors by default);\n"
+				 "\t-timeout S limits the full and the minimised queries to S seconds (no limit by default);\n"
+				 "\t-out File writes the minimised ontology to File\n\n";
+	exit(1);
+}
+
+inline void error ( const char* mes )
+{
+	std::cerr << mes << "\n";
+	exit(2);
+}
+
+//**********************  Main function  ************************************
+int main ( int argc, char *argv[] )
+{
+	unsigned int nThreads = (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+	float timeout = 0;
+	const char* outName = NULL;
+
+	// parse options
+	int arg = 1;
+	for ( ; arg < argc && argv[arg][0] == '-'; arg += 2 )
+	{
+		if ( arg+1 >= argc )
+			Usage();
+		if ( !strcmp ( argv[arg], "-threads" ) )
+			nThreads = atoi(argv[arg+1]);
+		else if ( !strcmp ( argv[arg], "-timeout" ) )
+			timeout = atof(argv[arg+1]);
+		else if ( !strcmp ( argv[arg], "-out" ) )
+			outName = argv[arg+1];
+		else
+			Usage();
+	}
+	if ( argc-arg != 3 )
+		Usage();
+	float threshold = atof(argv[arg+2]);
+	if ( threshold <= 0 )
+		error ( "The threshold should be positive" );
+
+	try
+	{
+
+	ReasoningKernel Kernel;
+	Kernel.setTopBottomRoleNames ( TopORole, BotORole, TopDRole, BotDRole );
+
+	// parsing input TBox
+	std::ifstream iTBox(argv[arg]);
+	if ( iTBox.fail() )
+		error ( "Cannot open input TBox file" );
+	std::cerr << "Loading KB...";
+	DLLispParser TBoxParser ( &iTBox, &Kernel );
+	TBoxParser.Parse();
+
+	// the ontology might contain the retracted axioms
+	AxiomVec All;
+	for ( TOntology::iterator p = Kernel.getOntology().begin(), p_end = Kernel.getOntology().end(); p != p_end; ++p )
+		if ( (*p)->isUsed() )
+			All.push_back(*p);
+	std::cerr << " " << All.size() << " axioms\n";
+
+	// parsing the query
+	Query Q;
+	std::stringstream s(argv[arg+1]);
+	DLLispParser QueryParser ( &s, &Kernel );
+	if ( !QueryParser.parseQuery ( Q.Op, Q.C, Q.D ) || !( (Q.Op == "sat" && Q.D == NULL) || (Q.Op == "sub" && Q.D != NULL) ) )
+		error ( "The query should be either (sat C) or (sub C D)" );
+
+	float time;
+	if ( !runTrial ( All, Q, timeout, time ) && time < threshold )
+	{
+		std::cout << "The query takes " << time << " seconds, that is below the threshold\n";
+		return 0;
+	}
+	std::cout << "The query takes " << time << " seconds" << (timeout > 0 && time >= timeout ? " (timeout)" : "") << " over " << All.size() << " axioms\n";
+
+	// the STAR-module keeps all the entailments about the query signature; check whether it keeps the hardness
+	TSignature Sig;
+	TExpressionSignatureUpdater Updater(Sig);
+	Q.C->accept(Updater);
+	if ( Q.D != NULL )
+		Q.D->accept(Updater);
+	TModularizer Modularizer(/*useSem=*/false);
+	Modularizer.preprocessOntology(All);
+	Modularizer.extract ( All, Sig, M_STAR );
+	AxiomVec Start = All;
+	if ( Modularizer.getModule().size() < All.size() )
+	{
+		const AxiomVec& Module = Modularizer.getModule();
+		bool slow = runTrial ( Module, Q, threshold, time );
+		std::cout << "The STAR-module of the query has " << Module.size() << " axioms; it is " << (slow ? "" : "NOT ") << "slow\n";
+		if ( slow )
+			Start = Module;
+	}
+
+	SlowQueryMinimiser Minimiser ( Q, threshold, nThreads );
+	TsProcTimer timer;
+	timer.Start();
+	AxiomVec Result = Minimiser.minimise(Start);
+	timer.Stop();
+	std::cout << "Minimised to " << Result.size() << " axioms with " << Minimiser.getNTrials() << " trials ("
+			  << Minimiser.getNSlow() << " slow) in " << timer << " seconds of processor time\n";
+
+	std::cout << "Culprit axioms:\n";
+	printAxioms ( std::cout, Result );
+
+	if ( outName != NULL )
+	{
+		std::ofstream Out(outName);
+		if ( Out.fail() )
+			error ( "Cannot open output file" );
+		printAxioms ( Out, Result );
+	}
+
+	std::ostringstream Stat;
+	bool slow = runTrial ( Result, Q, timeout, time, &Stat );
+	std::cout << "The minimised query takes " << time << " seconds";
+	if ( slow && timeout > 0 )
+		std::cout << " (timeout, no statistics)\n";
+	else
+		std::cout << "\n" << Stat.str();
+
+	}
+	catch ( const EFaCTPlusPlus& e )
+	{
+		std::cerr << "\n" << e.what() << "\n";
+		exit(1);
+	}
+
+	return 0;
+}
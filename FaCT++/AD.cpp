@@ -19,10 +19,10 @@ Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 // methods to work with Atomic Decomposition
 
 #include <fstream>
+#include <sys/time.h>
 
 #include "AtomicDecomposer.h"
 #include "tOntologyPrinterLISP.h"	// AD prints
-#include "procTimer.h"
 #include "cppi.h"
 
 // defined in FaCT.cpp
@@ -73,19 +73,65 @@ sizeAD ( AOStructure* AOS )
 	return ret;
 }
 
+/// @return wall-clock time in seconds (processor time is summed over the threads)
+static double
+wallTime ( void )
+{
+	struct timeval tv;
+	gettimeofday ( &tv, NULL );
+	return tv.tv_sec + tv.tv_usec/1e6;
+}
+
+/// build the AD of ONTOLOGY using NTHREADS threads; save the time spent in TIME
+static AOStructure*
+buildAD ( TOntology* Ontology, AtomicDecomposer* AD, unsigned int nThreads, double& time )
+{
+	AD->setThreads(nThreads);
+	AD->setProgressIndicator(new CPPI());
+	double start = wallTime();
+	AOStructure* AOS = AD->getAOS ( Ontology, M_BOT );
+	time = wallTime() - start;
+	return AOS;
+}
+
+/// build the AD of ONTOLOGY; use NTHREADS threads for the AD itself (syntactic locality)
+/// or for the locality checks (semantic locality)
 void
-CreateAD ( TOntology* Ontology, bool useSem )
+CreateAD ( TOntology* Ontology, bool useSem, unsigned int nThreads )
 {
 	std::cerr << "\n";
+	TModularizer mod ( useSem, useSem ? nThreads : 1 );
+	double seqTime = 0;
+	size_t seqAtoms = 0;
+
+	// benchmark the parallel decomposition against the sequential one
+	if ( nThreads > 1 && !useSem )
+	{
+		AtomicDecomposer* Seq = new AtomicDecomposer(&mod);
+		seqAtoms = buildAD ( Ontology, Seq, 1, seqTime )->size();
+		delete Seq;
+		Out << "Sequential atomic structure (" << seqAtoms << " atoms) built in " << seqTime << " seconds\n";
+		std::cerr << "\n";
+	}
+
 	// do the atomic decomposition
-	TsProcTimer timer;
-	timer.Start();
-	TModularizer mod(useSem);
 	AtomicDecomposer* AD = new AtomicDecomposer(&mod);
-	AD->setProgressIndicator(new CPPI());
-	AOStructure* AOS = AD->getAOS ( Ontology, M_BOT );
-	timer.Stop();
-	Out << "Atomic structure built in " << timer << " seconds\n";
+	double time;
+	AOStructure* AOS = buildAD ( Ontology, AD, nThreads, time );
+	Out << "Atomic structure built in " << time << " seconds";
+	if ( useSem )
+	{
+		const SemanticLocalityChecker* LC = dynamic_cast<const SemanticLocalityChecker*>(mod.getLocalityChecker());
+		Out << " using " << nThreads << " reasoner(s); " << LC->getNBatchChecks() << " locality checks, "
+			<< LC->getNCacheHits() << " answered from the cache";
+	}
+	else if ( nThreads > 1 )
+	{
+		Out << " using " << nThreads << " threads (speedup " << seqTime/time << ")";
+		if ( seqAtoms != AOS->size() )
+			Out << "; WARNING: the sequential structure has " << seqAtoms << " atoms";
+	}
+	Out << "\n";
 	size_t sz = sizeAD(AOS);
 	Out << "Atomic structure (" << sz << " axioms in " << AOS->size() << " atoms; " << Ontology->size()-sz << " tautologies):\n";
 	for ( AOStructure::iterator p = AOS->begin(), p_end = AOS->end(); p != p_end; ++p )
@@ -0,0 +1,155 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// benchmark of the modular classification against the monolithic one
+
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <sys/time.h>
+
+#include "Kernel.h"
+#include "Actor.h"
+
+// defined in FaCT.cpp
+extern std::ofstream Out;
+
+/// maximal number of the differences to print
+static const size_t MaxDiffs = 10;
+
+/// taxonomy as a map from every concept name to its equivalents and direct parents
+typedef std::map<std::string, std::string> TaxonomyDump;
+
+/// @return wall-clock time in seconds (processor time is summed over the threads)
+static double
+wallTime ( void )
+{
+	struct timeval tv;
+	gettimeofday ( &tv, NULL );
+	return tv.tv_sec + tv.tv_usec/1e6;
+}
+
+/// @return the sorted names of the synonyms SYN separated by spaces
+static std::string
+groupNames ( const Actor::Array1D& syn )
+{
+	std::vector<std::string> Names;
+	for ( Actor::Array1D::const_iterator p = syn.begin(), p_end = syn.end(); p != p_end; ++p )
+		Names.push_back((*p)->getName());
+	std::sort ( Names.begin(), Names.end() );
+	std::string ret;
+	for ( std::vector<std::string>::const_iterator p = Names.begin(), p_end = Names.end(); p != p_end; ++p )
+		ret += " " + *p;
+	return ret;
+}
+
+/// dump the concept taxonomy of K into TAX
+static void
+dumpTaxonomy ( ReasoningKernel& K, TaxonomyDump& Tax )
+{
+	Tax.clear();
+	TExpressionManager* pEM = K.getExpressionManager();
+	Actor actor;
+	actor.needConcepts();
+	Actor::Array2D All, Parents;
+	K.getSubConcepts ( pEM->Top(), /*direct=*/false, actor );
+	actor.getFoundData(All);
+	for ( Actor::Array2D::const_iterator p = All.begin(), p_end = All.end(); p != p_end; ++p )
+	{
+		if ( p->empty() )
+			continue;
+		std::string entry = groupNames(*p);
+		// the parents of BOTTOM are the leaves; they are compared with the rest of the names
+		bool unsat = false;
+		for ( Actor::Array1D::const_iterator q = p->begin(), q_end = p->end(); q != q_end; ++q )
+			unsat |= (*q)->isBottom();
+		if ( !unsat )
+		{
+			K.getSupConcepts ( pEM->Concept((*p)[0]->getName()), /*direct=*/true, actor );
+			actor.getFoundData(Parents);
+			std::vector<std::string> Names;
+			for ( Actor::Array2D::const_iterator q = Parents.begin(), q_end = Parents.end(); q != q_end; ++q )
+				Names.push_back(groupNames(*q));
+			std::sort ( Names.begin(), Names.end() );
+			for ( std::vector<std::string>::const_iterator q = Names.begin(), q_end = Names.end(); q != q_end; ++q )
+				entry += " <" + *q;
+		}
+		for ( Actor::Array1D::const_iterator q = p->begin(), q_end = p->end(); q != q_end; ++q )
+			Tax[(*q)->getName()] = entry;
+	}
+}
+
+/// classify the ontology of K from scratch with or without the MODULAR classification;
+/// dump the result into TAX; @return the time spent
+static double
+classify ( ReasoningKernel& K, bool modular, TaxonomyDump& Tax )
+{
+	std::cerr << ( modular ? "Modular" : "Monolithic" ) << " classification...";
+	K.setUseModularClassification(modular);
+	// the kernel reloads the changed ontology, so the classification starts from scratch
+	K.declare(K.getExpressionManager()->Top());
+	double start = wallTime();
+	K.classifyKB();
+	double time = wallTime() - start;
+	std::cerr << " done in " << time << " seconds\n";
+	dumpTaxonomy ( K, Tax );
+	return time;
+}
+
+/// classify the ontology of K with the monolithic and the modular classification;
+/// compare the timings and check that the taxonomies are the same
+void
+BenchmarkClassification ( ReasoningKernel& K )
+{
+	std::cerr << "\n";
+	TaxonomyDump Mono, Mod;
+	if ( !K.isKBConsistent() )
+	{
+		Out << "The ontology is inconsistent; no classification to benchmark\n";
+		return;
+	}
+	double tMono = classify ( K, /*modular=*/false, Mono );
+	double tMod = classify ( K, /*modular=*/true, Mod );
+
+	Out << "Monolithic classification: " << tMono << " s\n";
+	Out << "Modular classification using " << K.getOptions()->getInt("modularClassificationThreads")
+		<< " thread(s): " << tMod << " s";
+	if ( tMod > 0 )
+		Out << " (speedup " << tMono/tMod << ")";
+	Out << "\n";
+	if ( K.getModularClassifier() != NULL )
+		K.getModularClassifier()->PrintStat(Out);
+
+	// compare the taxonomies
+	size_t nDiff = 0;
+	for ( TaxonomyDump::const_iterator p = Mono.begin(), p_end = Mono.end(); p != p_end; ++p )
+	{
+		TaxonomyDump::const_iterator q = Mod.find(p->first);
+		std::string modEntry = q == Mod.end() ? " (missing)" : q->second;
+		if ( p->second == modEntry )
+			continue;
+		if ( nDiff++ < MaxDiffs )
+			Out << "DIFF " << p->first << ":\n  monolithic:" << p->second << "\n  modular:   " << modEntry << "\n";
+	}
+	nDiff += Mod.size() > Mono.size() ? Mod.size() - Mono.size() : 0;
+
+	if ( nDiff == 0 )
+		Out << "Taxonomies of " << Mono.size() << " names are the same\n";
+	else
+		Out << "WARNING: taxonomies differ for " << nDiff << " names\n";
+}
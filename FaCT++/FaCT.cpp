@@ -20,13 +20,17 @@ Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 #include <iomanip>
 #include <fstream>
 #include <sstream>
+#include <cctype>
 
 #include "procTimer.h"
 #include "parser.h"
+#include "mappedfile.h"
+#include "tOWLFunctionalParser.h"
 #include "configure.h"
 #include "logging.h"
 
 #include "Kernel.h"
+#include "Actor.h"
 #include "cpm.h"
 
 TsProcTimer totalTimer, wTimer;
@@ -35,7 +39,17 @@ ReasoningKernel Kernel;
 std::ofstream Out;
 
 // defined in AD.cpp
-void CreateAD ( TOntology* O, bool useSem );
+void CreateAD ( TOntology* O, bool useSem, unsigned int nThreads );
+// defined in NameBench.cpp
+void BenchmarkNames ( ReasoningKernel& K );
+void BenchmarkModules ( ReasoningKernel& K );
+// defined in ClassifyBench.cpp
+void BenchmarkClassification ( ReasoningKernel& K );
+// defined in InstanceBench.cpp
+void BenchmarkInstances ( ReasoningKernel& K );
+void BenchmarkRealisation ( ReasoningKernel& K );
+// defined in JustificationBench.cpp
+void BenchmarkJustifications ( ReasoningKernel& K );
 // defined in QA.cpp
 void doQueryAnswering ( ReasoningKernel& Kernel );
 
@@ -205,6 +219,49 @@ doReasoningQuery ( void )
 }
 
 
+//----------------------------------------------------------------------------------
+// query log replay
+//----------------------------------------------------------------------------------
+
+/// replay queries from the log file NAME; every query is either (sat C), (sub C D) or (sup C)
+static void
+replayQueryLog ( const char* name )
+{
+	std::ifstream in(name);
+	if ( in.fail() )
+		error ( "Cannot open query log file" );
+
+	DLLispParser LogParser ( &in, &Kernel );
+	std::string op;
+	ReasoningKernel::TConceptExpr *C, *D;
+	unsigned long hits = Kernel.getQueryResults().getHits(), misses = Kernel.getQueryResults().getMisses();
+	unsigned int nQueries = 0;
+	TsProcTimer timer;
+	timer.Start();
+
+	while ( LogParser.parseQuery ( op, C, D ) )
+	{
+		++nQueries;
+		if ( op == "sat" )
+			TryReasoning ( Kernel.isSatisfiable(C) );
+		else if ( op == "sub" && D != NULL )
+			TryReasoning ( Kernel.isSubsumedBy ( C, D ) );
+		else if ( op == "sup" )
+		{
+			Actor actor;
+			actor.needConcepts();
+			TryReasoning ( Kernel.getSupConcepts ( C, /*direct=*/true, actor ) );
+		}
+		else
+			error ( "Query log: unknown query" );
+	}
+
+	timer.Stop();
+	std::cout << "Replayed " << nQueries << " queries in " << timer << " seconds; query result cache: "
+			  << Kernel.getQueryResults().getHits() - hits << " hits, "
+			  << Kernel.getQueryResults().getMisses() - misses << " misses\n";
+}
+
 //**********************  Main function  ************************************
 int main ( int argc, char *argv[] )
 {
@@ -245,11 +302,16 @@ int main ( int argc, char *argv[] )
 	else
 		tBoxName = Config. getString ();
 
-	// Open input file for TBox and so on...
-	std::ifstream iTBox ( tBoxName );
+	// Map the TBox file to scan it in place; read pipes and other non-regular files as a stream
+	TMappedFile mTBox ( tBoxName );
+	std::ifstream iTBox;
 
-	if ( iTBox.fail () )
-		error ( "Cannot open input TBox file" );
+	if ( !mTBox.isMapped() )
+	{
+		iTBox.open(tBoxName);
+		if ( iTBox.fail () )
+			error ( "Cannot open input TBox file" );
+	}
 
 	// output file...
 	Out.open ( argc == 3 ? argv [2] : "dl.res" );
@@ -274,18 +336,65 @@ int main ( int argc, char *argv[] )
 	bool queryAnswering = Kernel.getOptions()->getBool("queryAnswering");
 	Kernel.setUseUndefinedNames(queryAnswering);
 
+	// init modular classification
+	Kernel.setUseModularClassification(Kernel.getOptions()->getBool("useModularClassification"));
+	// init lazy classification
+	Kernel.setUseLazyClassification(Kernel.getOptions()->getBool("useLazyClassification"));
+	// init summary ABox
+	Kernel.setUseSummaryABox(Kernel.getOptions()->getBool("useSummaryABox"));
+	// init bulk realisation
+	Kernel.setUseBulkRealisation(Kernel.getOptions()->getBool("useBulkRealisation"));
+
 	// Load the ontology
-	DLLispParser TBoxParser ( &iTBox, &Kernel );
 	Kernel.setVerboseOutput(true);
 	TProgressMonitor* pMon = new ConsoleProgressMonitor;
 	Kernel.setProgressMonitor(pMon);
 
+	// OWL functional syntax starts with a keyword or a comment; LISP syntax -- with a bracket
+	char first;
+	if ( mTBox.isMapped() )
+	{
+		const char* p = mTBox.begin();
+		while ( p != mTBox.end() && isspace(*p) )
+			++p;
+		first = p != mTBox.end() ? *p : '(';
+	}
+	else
+		first = (char)(iTBox >> std::ws).peek();
+	bool owlSyntax = isalpha(first) || first == '#';
+
 	// parsing input TBox
 	std::cerr << "Loading KB...";
 	wTimer.Start ();
-	TBoxParser.Parse ();
+	if ( owlSyntax )
+	{
+		if ( !iTBox.is_open() )
+			iTBox.open(tBoxName);
+		TOWLFunctionalParser OWLParser ( Kernel, iTBox );
+		OWLParser.Parse();
+		std::cerr << " " << OWLParser.getAxiomNumber() << " axioms";
+		if ( OWLParser.getSkippedNumber() > 0 )
+		{
+			std::cerr << " (" << OWLParser.getSkippedNumber() << " unsupported skipped";
+			const TOWLFunctionalParser::IRISet& DTs = OWLParser.getUnsupportedDataTypes();
+			for ( TOWLFunctionalParser::IRISet::const_iterator p = DTs.begin(), p_end = DTs.end(); p != p_end; ++p )
+				std::cerr << ( p == DTs.begin() ? "; unknown datatypes " : " " ) << "<" << *p << ">";
+			std::cerr << ")";
+		}
+	}
+	else
+	{
+		DLLispParser* TBoxParser = mTBox.isMapped()
+			? new DLLispParser ( mTBox.begin(), mTBox.end(), &Kernel )
+			: new DLLispParser ( &iTBox, &Kernel );
+		TBoxParser->Parse ();
+		delete TBoxParser;
+	}
 	wTimer.Stop ();
-	std::cerr << " done in " << wTimer << " seconds\n";
+	std::cerr << " done in " << wTimer << " seconds";
+	if ( mTBox.isMapped() && !owlSyntax && (float)wTimer > 0 )
+		std::cerr << " (" << mTBox.size()/(1024.0*1024.0)/(float)wTimer << " MB/s)";
+	std::cerr << "\n";
 
 	Out << "loading time " << wTimer << " seconds\n";
 
@@ -295,7 +404,43 @@ int main ( int argc, char *argv[] )
 
 	if ( Kernel.getOptions()->getBool("checkAD") )	// check atomic decomposition and exit
 	{
-		CreateAD(&Kernel.getOntology(), useSem);
+		CreateAD(&Kernel.getOntology(), useSem, Kernel.getOptions()->getInt(useSem ? "semanticLocalityThreads" : "ADThreads"));
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkNames") )	// measure the name tables and exit
+	{
+		BenchmarkNames(Kernel);
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkModules") )	// measure the module extraction and exit
+	{
+		BenchmarkModules(Kernel);
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkClassification") )	// compare modular and monolithic classification and exit
+	{
+		BenchmarkClassification(Kernel);
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkInstances") )	// compare summary-based and realisation-based instance retrieval and exit
+	{
+		BenchmarkInstances(Kernel);
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkRealisation") )	// compare bulk and one-by-one realisation and exit
+	{
+		BenchmarkRealisation(Kernel);
+		return 0;
+	}
+
+	if ( Kernel.getOptions()->getBool("benchmarkJustifications") )	// find and check the justifications of the subsumptions and exit
+	{
+		BenchmarkJustifications(Kernel);
 		return 0;
 	}
 
@@ -316,6 +461,10 @@ int main ( int argc, char *argv[] )
 			;//doQueryAnswering(Kernel);	// FIXME!! uncomment when general QA will be ready
 		else
 			doReasoningQuery();
+
+		// replay the query log if given
+		if ( !Config.checkValue ( "Query", "QueryLog" ) )
+			replayQueryLog(Config.getString());
 	}
 
 	pt.Stop();
@@ -0,0 +1,484 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// benchmarks of the summary ABox based instance retrieval and of the bulk realisation on a LUBM-style ABox
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <sys/time.h>
+
+#include "Kernel.h"
+#include "Actor.h"
+
+// defined in FaCT.cpp
+extern std::ofstream Out;
+
+/// maximal number of the differences to print
+static const size_t MaxDiffs = 10;
+
+/// @return wall-clock time in seconds
+static double
+wallTime ( void )
+{
+	struct timeval tv;
+	gettimeofday ( &tv, NULL );
+	return tv.tv_sec + tv.tv_usec/1e6;
+}
+
+/// generator of the university ontology in the style of LUBM: a part of its TBox and an ABox
+/// with the universities, departments, faculty, students and courses
+class LUBMGenerator
+{
+protected:	// members
+		/// kernel to put the ontology into
+	ReasoningKernel& K;
+		/// expression manager of the kernel
+	TExpressionManager* pEM;
+		/// state of the pseudo-random generator (the same ABox for the same scale)
+	unsigned long Seed;
+		/// number of the universities
+	unsigned int nUniversities;
+
+public:		// members
+		/// number of the generated individuals
+	unsigned long nIndividuals;
+		/// number of the generated assertions
+	unsigned long nAssertions;
+
+protected:	// methods
+		/// @return pseudo-random number from [0,N)
+	unsigned int random ( unsigned int n )
+	{
+		Seed = Seed * 1103515245 + 12345;
+		return (unsigned int)((Seed / 65536) % 32768) % n;
+	}
+		/// @return pseudo-random number from [FROM,TO]
+	unsigned int random ( unsigned int from, unsigned int to ) { return from + random(to-from+1); }
+
+		/// @return concept name NAME
+	TDLConceptExpression* C ( const char* name ) { return pEM->Concept(name); }
+		/// @return object role name NAME
+	TDLObjectRoleExpression* R ( const char* name ) { return pEM->ObjectRole(name); }
+		/// @return individual named NAME with the number N, that is a part of the entity PARENT
+	TDLIndividualExpression* I ( const char* name, unsigned int n, const std::string& parent = "" )
+	{
+		std::stringstream s;
+		s << name << n;
+		if ( !parent.empty() )
+			s << "." << parent;
+		return pEM->Individual(s.str());
+	}
+		/// @return the name of the individual I
+	static std::string name ( TDLIndividualExpression* I ) { return dynamic_cast<TDLIndividualName*>(I)->getName(); }
+
+		/// add the assertion that I is an instance of the concept name CNAME
+	void type ( TDLIndividualExpression* i, const char* cName ) { K.instanceOf ( i, C(cName) ); ++nIndividuals; ++nAssertions; }
+		/// add the assertion that I is related to J via the role name RNAME
+	void link ( TDLIndividualExpression* i, const char* rName, TDLIndividualExpression* j ) { K.relatedTo ( i, R(rName), j ); ++nAssertions; }
+		/// add the axiom SUB [= SUP for the concept names
+	void sub ( const char* Sub, const char* Sup ) { K.impliesConcepts ( C(Sub), C(Sup) ); }
+		/// add the axiom NAME = Person and some ROLE.FILLER
+	void defPerson ( const char* Name, const char* Role, const char* Filler )
+	{
+		pEM->newArgList();
+		pEM->addArg(C(Name));
+		pEM->addArg(pEM->And ( C("Person"), pEM->Exists ( R(Role), C(Filler) ) ));
+		K.equalConcepts();
+	}
+
+		/// add a department D of the university U
+	void addDepartment ( unsigned int d, TDLIndividualExpression* u );
+
+public:		// interface
+		/// init c'tor: generate N universities in the kernel K
+	LUBMGenerator ( ReasoningKernel& k, unsigned int n )
+		: K(k)
+		, pEM(k.getExpressionManager())
+		, Seed(0)
+		, nUniversities(n)
+		, nIndividuals(0)
+		, nAssertions(0)
+		{}
+
+		/// add the TBox of the ontology
+	void addTBox ( void );
+		/// add the ABox of the ontology
+	void addABox ( void );
+}; // LUBMGenerator
+
+void
+LUBMGenerator :: addTBox ( void )
+{
+	sub ( "University", "Organization" );
+	sub ( "Department", "Organization" );
+	sub ( "ResearchGroup", "Organization" );
+	sub ( "GraduateCourse", "Course" );
+	sub ( "Faculty", "Employee" );
+	sub ( "Professor", "Faculty" );
+	sub ( "FullProfessor", "Professor" );
+	sub ( "AssociateProfessor", "Professor" );
+	sub ( "AssistantProfessor", "Professor" );
+	sub ( "Lecturer", "Faculty" );
+	sub ( "UndergraduateStudent", "Student" );
+	sub ( "GraduateStudent", "Person" );
+	K.impliesConcepts ( C("GraduateStudent"), pEM->Exists ( R("takesCourse"), C("GraduateCourse") ) );
+	defPerson ( "Employee", "worksFor", "Organization" );
+	defPerson ( "Student", "takesCourse", "Course" );
+	defPerson ( "Chair", "headOf", "Department" );
+	defPerson ( "TeachingAssistant", "teachingAssistantOf", "Course" );
+
+	K.impliesORoles ( R("headOf"), R("worksFor") );
+	K.impliesORoles ( R("worksFor"), R("memberOf") );
+	K.setTransitive(R("subOrganizationOf"));
+	K.setInverseRoles ( R("degreeFrom"), R("hasAlumnus") );
+	K.impliesORoles ( R("undergraduateDegreeFrom"), R("degreeFrom") );
+	K.impliesORoles ( R("doctoralDegreeFrom"), R("degreeFrom") );
+	K.setODomain ( R("teacherOf"), C("Faculty") );
+	K.setORange ( R("teacherOf"), C("Course") );
+	K.setORange ( R("advisor"), C("Professor") );
+}
+
+void
+LUBMGenerator :: addDepartment ( unsigned int d, TDLIndividualExpression* u )
+{
+	TDLIndividualExpression* dept = I ( "Department", d, name(u) );
+	std::string dName = name(dept);
+	type ( dept, "Department" );
+	link ( dept, "subOrganizationOf", u );
+
+	unsigned int nGroups = random(2,4);
+	for ( unsigned int i = 0; i < nGroups; ++i )
+	{
+		TDLIndividualExpression* group = I ( "ResearchGroup", i, dName );
+		type ( group, "ResearchGroup" );
+		link ( group, "subOrganizationOf", dept );
+	}
+
+	// faculty with the courses they teach
+	static const char* Kinds[] = { "FullProfessor", "AssociateProfessor", "AssistantProfessor", "Lecturer" };
+	static const unsigned int MinKind[] = { 3, 4, 3, 2 }, MaxKind[] = { 5, 6, 5, 4 };
+	std::vector<TDLIndividualExpression*> Professors, Courses, GradCourses;
+	for ( unsigned int k = 0; k < 4; ++k )
+	{
+		unsigned int n = random ( MinKind[k], MaxKind[k] );
+		for ( unsigned int i = 0; i < n; ++i )
+		{
+			TDLIndividualExpression* f = I ( Kinds[k], i, dName );
+			type ( f, Kinds[k] );
+			link ( f, "worksFor", dept );
+			link ( f, "undergraduateDegreeFrom", I ( "University", random(nUniversities) ) );
+			if ( k < 3 )
+			{
+				link ( f, "doctoralDegreeFrom", I ( "University", random(nUniversities) ) );
+				Professors.push_back(f);
+			}
+			unsigned int nCourses = random(1,2);
+			for ( unsigned int c = 0; c < nCourses; ++c )
+			{
+				TDLIndividualExpression* course = I ( "Course", Courses.size(), dName );
+				type ( course, "Course" );
+				link ( f, "teacherOf", course );
+				Courses.push_back(course);
+			}
+			TDLIndividualExpression* course = I ( "GraduateCourse", GradCourses.size(), dName );
+			type ( course, "GraduateCourse" );
+			link ( f, "teacherOf", course );
+			GradCourses.push_back(course);
+		}
+	}
+	// the first full professor is the head of the department
+	link ( Professors.front(), "headOf", dept );
+
+	// students
+	unsigned int nFaculty = GradCourses.size();
+	unsigned int nUG = nFaculty * random(8,14), nGrad = nFaculty * random(3,4);
+	for ( unsigned int i = 0; i < nUG; ++i )
+	{
+		TDLIndividualExpression* s = I ( "UndergraduateStudent", i, dName );
+		type ( s, "UndergraduateStudent" );
+		link ( s, "memberOf", dept );
+		unsigned int nCourses = random(2,4);
+		for ( unsigned int c = 0; c < nCourses; ++c )
+			link ( s, "takesCourse", Courses[random(Courses.size())] );
+		if ( random(5) == 0 )
+			link ( s, "advisor", Professors[random(Professors.size())] );
+	}
+	for ( unsigned int i = 0; i < nGrad; ++i )
+	{
+		TDLIndividualExpression* s = I ( "GraduateStudent", i, dName );
+		type ( s, "GraduateStudent" );
+		link ( s, "memberOf", dept );
+		unsigned int nCourses = random(1,3);
+		for ( unsigned int c = 0; c < nCourses; ++c )
+			link ( s, "takesCourse", GradCourses[random(GradCourses.size())] );
+		link ( s, "advisor", Professors[random(Professors.size())] );
+		link ( s, "undergraduateDegreeFrom", I ( "University", random(nUniversities) ) );
+		if ( random(4) == 0 )
+			link ( s, "teachingAssistantOf", Courses[random(Courses.size())] );
+	}
+}
+
+void
+LUBMGenerator :: addABox ( void )
+{
+	for ( unsigned int u = 0; u < nUniversities; ++u )
+	{
+		TDLIndividualExpression* univ = I ( "University", u );
+		type ( univ, "University" );
+		unsigned int nDepts = random(4,6);
+		for ( unsigned int d = 0; d < nDepts; ++d )
+			addDepartment ( d, univ );
+	}
+}
+
+/// answers of the instance queries: sorted names of the instances of every query
+typedef std::vector<std::vector<std::string> > AnswerVec;
+
+/// answer all QUERIES in K with or without the SUMMARY ABox; put the results into ANSWERS; @return the time spent
+static double
+answerQueries ( ReasoningKernel& K, const std::vector<TDLConceptExpression*>& Queries, bool summary, AnswerVec& Answers )
+{
+	std::cerr << "Instance retrieval " << ( summary ? "with" : "without" ) << " the summary ABox...";
+	K.setUseSummaryABox(summary);
+	Answers.clear();
+	SummaryABox::IndividualVec Result;
+	double start = wallTime();
+	for ( std::vector<TDLConceptExpression*>::const_iterator p = Queries.begin(), p_end = Queries.end(); p != p_end; ++p )
+	{
+		K.getInstanceNames ( *p, Result );
+		Answers.push_back(std::vector<std::string>());
+		for ( SummaryABox::IndividualVec::const_iterator q = Result.begin(), q_end = Result.end(); q != q_end; ++q )
+			Answers.back().push_back((*q)->getName());
+		std::sort ( Answers.back().begin(), Answers.back().end() );
+	}
+	double time = wallTime() - start;
+	std::cerr << " done in " << time << " seconds\n";
+	return time;
+}
+
+/// answer the instance queries on a small ABox with the summary ABox and with the realisation;
+/// the roles of the ABox are not in the TBox, and the TBox makes the summary answers ambiguous,
+/// so the descriptions of the summary nodes are checked; @return the number of the differences
+static size_t
+checkAssertionRoles ( void )
+{
+	// R(a,b), S(b,e), E(e), R(c,d); A [= B or C
+	ReasoningKernel K;
+	TExpressionManager* pEM = K.getExpressionManager();
+	TDLObjectRoleExpression* R = pEM->ObjectRole("R");
+	TDLObjectRoleExpression* S = pEM->ObjectRole("S");
+	TDLConceptExpression* E = pEM->Concept("E");
+	K.impliesConcepts ( pEM->Concept("A"), pEM->Or ( pEM->Concept("B"), pEM->Concept("C") ) );
+	const char* Names[] = { "a", "b", "c", "d", "e" };
+	std::vector<TDLIndividualExpression*> Inds;
+	for ( size_t i = 0; i < sizeof(Names)/sizeof(Names[0]); ++i )
+		Inds.push_back(pEM->Individual(Names[i]));
+	K.relatedTo ( Inds[0], R, Inds[1] );
+	K.relatedTo ( Inds[1], S, Inds[4] );
+	K.instanceOf ( Inds[4], E );
+	K.relatedTo ( Inds[2], R, Inds[3] );
+
+	std::vector<TDLConceptExpression*> Queries;
+	Queries.push_back(pEM->Exists ( R, pEM->Exists ( S, E ) ));
+	Queries.push_back(pEM->Top());
+
+	AnswerVec Answers[2];
+	std::vector<std::string> Instances[2];
+	try
+	{
+		// the summary ABox is used only before the realisation
+		for ( int summary = 1; summary >= 0; --summary )
+		{
+			answerQueries ( K, Queries, summary != 0, Answers[summary] );
+			for ( size_t q = 0; q < Queries.size(); ++q )
+			{
+				std::string flags;
+				for ( size_t i = 0; i < Inds.size(); ++i )
+					flags += K.isInstance ( Inds[i], Queries[q] ) ? '1' : '0';
+				Instances[summary].push_back(flags);
+			}
+		}
+	}
+	catch ( const EFaCTPlusPlus& e )
+	{
+		Out << "DIFF on the ABox with the assertion-only roles: " << e.what() << "\n";
+		return 1;
+	}
+
+	size_t nDiff = 0;
+	for ( size_t q = 0; q < Queries.size(); ++q )
+		if ( Answers[0][q] != Answers[1][q] || Instances[0][q] != Instances[1][q] )
+		{
+			++nDiff;
+			Out << "DIFF on the ABox with the assertion-only roles in query " << q << ": instances " << Instances[1][q]
+				<< " with the summary ABox, " << Instances[0][q] << " with the realisation\n";
+		}
+	return nDiff;
+}
+
+/// add a generated LUBM-style ontology to K; answer the instance queries with the summary ABox and
+/// with the realisation; compare the timings and check that the answers are the same
+void
+BenchmarkInstances ( ReasoningKernel& K )
+{
+	std::cerr << "\n";
+	LUBMGenerator Gen ( K, std::max ( K.getOptions()->getInt("benchmarkInstancesScale"), 1 ) );
+	Gen.addTBox();
+	Gen.addABox();
+	Out << "Generated LUBM-style ABox: " << Gen.nIndividuals << " individuals, " << Gen.nAssertions << " assertions\n";
+
+	TExpressionManager* pEM = K.getExpressionManager();
+	std::vector<TDLConceptExpression*> Queries;
+	const char* Names[] = { "Person", "Student", "GraduateStudent", "Employee", "Faculty", "Professor",
+		"Chair", "TeachingAssistant", "Organization", "Course" };
+	for ( size_t i = 0; i < sizeof(Names)/sizeof(Names[0]); ++i )
+		Queries.push_back(pEM->Concept(Names[i]));
+	Queries.push_back(pEM->And ( pEM->Concept("Student"), pEM->Value ( pEM->ObjectRole("memberOf"), pEM->Individual("Department0.University0") ) ));
+	Queries.push_back(pEM->Exists ( pEM->ObjectRole("advisor"), pEM->Concept("FullProfessor") ));
+	Queries.push_back(pEM->Exists ( pEM->ObjectRole("degreeFrom"), pEM->Concept("University") ));
+
+	AnswerVec Summary, Realised;
+	double tSummary = answerQueries ( K, Queries, /*summary=*/true, Summary );
+	if ( K.getSummaryABox() != NULL )
+		K.getSummaryABox()->PrintStat(Out);
+	if ( !K.isKBConsistent() )
+	{
+		Out << "The ontology is inconsistent; no instances to benchmark\n";
+		return;
+	}
+	double tRealised = answerQueries ( K, Queries, /*summary=*/false, Realised );
+
+	Out << "Instance retrieval with the summary ABox: " << tSummary << " s\n";
+	Out << "Instance retrieval with the realisation: " << tRealised << " s";
+	if ( tSummary > 0 )
+		Out << " (speedup " << tRealised/tSummary << ")";
+	Out << "\n";
+
+	// compare the answers
+	size_t nDiff = 0;
+	for ( size_t i = 0; i < Queries.size(); ++i )
+	{
+		if ( Summary[i] == Realised[i] )
+			continue;
+		if ( nDiff++ < MaxDiffs )
+			Out << "DIFF in query " << i << ": " << Summary[i].size() << " instances with the summary ABox, "
+				<< Realised[i].size() << " with the realisation\n";
+	}
+	nDiff += checkAssertionRoles();
+	if ( nDiff == 0 )
+		Out << "Answers of " << Queries.size() << " queries are the same\n";
+	else
+		Out << "WARNING: answers differ for " << nDiff << " queries\n";
+}
+
+/// direct types of every individual: the individual name -> sorted names of its direct types
+typedef std::map<std::string, std::string> TypesDump;
+
+/// realise the ontology of K from scratch with or without the BULK realisation;
+/// dump the direct types of the individuals into TYPES; @return the time spent
+static double
+realise ( ReasoningKernel& K, bool bulk, TypesDump& Types )
+{
+	std::cerr << "Realisation " << ( bulk ? "in bulk" : "one by one" ) << "...";
+	K.setUseBulkRealisation(bulk);
+	// the kernel reloads the changed ontology, so the realisation starts from scratch;
+	// the preprocessing and the consistency check are the same for both ways, so they are not timed
+	K.declare(K.getExpressionManager()->Top());
+	K.isKBConsistent();
+	double start = wallTime();
+	K.realiseKB();
+	double time = wallTime() - start;
+	std::cerr << " done in " << time << " seconds\n";
+
+	Types.clear();
+	TExpressionManager* pEM = K.getExpressionManager();
+	Actor actor;
+	actor.needIndividuals();
+	Actor::Array1D Inds;
+	K.getInstances ( pEM->Top(), actor );
+	actor.getFoundData(Inds);
+	actor.needConcepts();
+	Actor::Array2D Found;
+	for ( Actor::Array1D::const_iterator p = Inds.begin(), p_end = Inds.end(); p != p_end; ++p )
+	{
+		K.getTypes ( pEM->Individual((*p)->getName()), /*direct=*/true, actor );
+		actor.getFoundData(Found);
+		std::vector<std::string> Names;
+		for ( Actor::Array2D::const_iterator q = Found.begin(), q_end = Found.end(); q != q_end; ++q )
+			for ( Actor::Array1D::const_iterator r = q->begin(), r_end = q->end(); r != r_end; ++r )
+				Names.push_back((*r)->getName());
+		std::sort ( Names.begin(), Names.end() );
+		std::string& entry = Types[(*p)->getName()];
+		for ( std::vector<std::string>::const_iterator q = Names.begin(), q_end = Names.end(); q != q_end; ++q )
+			entry += " " + *q;
+	}
+	return time;
+}
+
+/// add a generated LUBM-style ontology to K; realise it in bulk and one by one; compare the
+/// timings and check that the direct types of the individuals are the same
+void
+BenchmarkRealisation ( ReasoningKernel& K )
+{
+	std::cerr << "\n";
+	LUBMGenerator Gen ( K, std::max ( K.getOptions()->getInt("benchmarkInstancesScale"), 1 ) );
+	Gen.addTBox();
+	Gen.addABox();
+	Out << "Generated LUBM-style ABox: " << Gen.nIndividuals << " individuals, " << Gen.nAssertions << " assertions\n";
+
+	if ( !K.isKBConsistent() )
+	{
+		Out << "The ontology is inconsistent; no individuals to realise\n";
+		return;
+	}
+
+	// the taxonomy dumps of the verbose output would take longer than the realisation itself
+	TypesDump Bulk, Single;
+	K.setVerboseOutput(false);
+	double tBulk = realise ( K, /*bulk=*/true, Bulk );
+	if ( K.getBulkRealiser() != NULL )
+		K.getBulkRealiser()->PrintStat(Out);
+	double tSingle = realise ( K, /*bulk=*/false, Single );
+	K.setVerboseOutput(true);
+
+	Out << "Bulk realisation: " << tBulk << " s\n";
+	Out << "Realisation one by one: " << tSingle << " s";
+	if ( tBulk > 0 )
+		Out << " (speedup " << tSingle/tBulk << ")";
+	Out << "\n";
+
+	// compare the types
+	size_t nDiff = 0;
+	for ( TypesDump::const_iterator p = Single.begin(), p_end = Single.end(); p != p_end; ++p )
+	{
+		TypesDump::const_iterator q = Bulk.find(p->first);
+		if ( q != Bulk.end() && q->second == p->second )
+			continue;
+		if ( nDiff++ < MaxDiffs )
+			Out << "DIFF in " << p->first << ":" << ( q == Bulk.end() ? std::string(" <missing>") : q->second )
+				<< " in bulk, " << p->second << " one by one\n";
+	}
+	if ( Bulk.size() != Single.size() )
+		Out << "DIFF in the number of individuals: " << Bulk.size() << " in bulk, " << Single.size() << " one by one\n";
+	if ( nDiff == 0 && Bulk.size() == Single.size() )
+		Out << "Direct types of " << Single.size() << " individuals are the same\n";
+	else
+		Out << "WARNING: direct types differ for " << nDiff << " individuals\n";
+}
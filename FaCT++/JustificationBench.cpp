@@ -0,0 +1,215 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// benchmark of the justification search on the direct subsumptions of a loaded ontology
+
+#include <fstream>
+#include <algorithm>
+#include <sys/time.h>
+
+#include "Kernel.h"
+#include "Actor.h"
+#include "eFPPInconsistentKB.h"
+
+// defined in FaCT.cpp
+extern std::ofstream Out;
+
+/// maximal number of the entailments to explain
+static const size_t MaxQueries = 50;
+/// maximal number of the justifications per entailment
+static const unsigned int MaxJustifications = 10;
+/// time limit of the search per entailment in milliseconds
+static const unsigned long TimeLimit = 10000;
+/// maximal number of the differences to print
+static const size_t MaxDiffs = 10;
+
+/// entailment C [= D; D is NULL for the unsatisfiability of C
+typedef std::pair<const TDLConceptExpression*, const TDLConceptExpression*> Entailment;
+
+/// @return wall-clock time in seconds
+static double
+wallTime ( void )
+{
+	struct timeval tv;
+	gettimeofday ( &tv, NULL );
+	return tv.tv_sec + tv.tv_usec/1e6;
+}
+
+/// @return the name of an entailment E
+static std::string
+entailmentName ( const Entailment& E )
+{
+	std::string ret = dynamic_cast<const TDLConceptName*>(E.first)->getName();
+	if ( E.second == NULL )
+		return ret + " [= BOTTOM";
+	return ret + " [= " + dynamic_cast<const TDLConceptName*>(E.second)->getName();
+}
+
+/// @return true iff the AXIOMS entail E; the entailment is checked by the kernel K from scratch
+static bool
+entails ( ReasoningKernel& K, const AxiomVec& Axioms, const Entailment& E )
+{
+	K.getOntology().setShared(Axioms);
+	try
+	{
+		return E.second == NULL ? !K.isSatisfiable(E.first) : K.isSubsumedBy(E.first,E.second);
+	}
+	catch ( const EFPPInconsistentKB& )
+	{
+		return true;
+	}
+}
+
+/// @return the number of the axioms of J that can be removed keeping the entailment E; J.size()+1 if J does not entail E
+static size_t
+checkJustification ( ReasoningKernel& K, const AxiomVec& J, const Entailment& E )
+{
+	if ( !entails ( K, J, E ) )
+		return J.size()+1;
+	size_t nRedundant = 0;
+	for ( size_t i = 0; i < J.size(); ++i )
+	{
+		AxiomVec Rest(J);
+		Rest.erase(Rest.begin()+i);
+		if ( entails ( K, Rest, E ) )
+			++nRedundant;
+	}
+	return nRedundant;
+}
+
+/// collect the direct subsumptions between the concept names and the unsatisfiable names of K into QUERIES
+static void
+collectEntailments ( ReasoningKernel& K, std::vector<Entailment>& Queries )
+{
+	TExpressionManager* pEM = K.getExpressionManager();
+	Actor actor;
+	actor.needConcepts();
+	Actor::Array2D All, Parents;
+	K.getSubConcepts ( pEM->Top(), /*direct=*/false, actor );
+	actor.getFoundData(All);
+	for ( Actor::Array2D::const_iterator p = All.begin(), p_end = All.end(); p != p_end; ++p )
+	{
+		if ( p->empty() || (*p)[0]->isTop() )
+			continue;
+		if ( (*p)[0]->isBottom() )
+		{
+			for ( Actor::Array1D::const_iterator q = p->begin(), q_end = p->end(); q != q_end; ++q )
+				if ( !(*q)->isBottom() )
+					Queries.push_back(Entailment(pEM->Concept((*q)->getName()),NULL));
+			continue;
+		}
+		const TDLConceptExpression* C = pEM->Concept((*p)[0]->getName());
+		K.getSupConcepts ( C, /*direct=*/true, actor );
+		actor.getFoundData(Parents);
+		for ( Actor::Array2D::const_iterator q = Parents.begin(), q_end = Parents.end(); q != q_end; ++q )
+			if ( !q->empty() && !(*q)[0]->isTop() )
+				Queries.push_back(Entailment(C,pEM->Concept((*q)[0]->getName())));
+	}
+}
+
+/// find the justifications of a sample of the direct subsumptions of the ontology in K;
+/// check that every found justification entails the subsumption and is minimal
+void
+BenchmarkJustifications ( ReasoningKernel& K )
+{
+	std::cerr << "\n";
+	if ( !K.isKBConsistent() )
+	{
+		Out << "The ontology is inconsistent; no justifications to benchmark\n";
+		return;
+	}
+	TExpressionManager* pEM = K.getExpressionManager();
+	std::vector<Entailment> Queries;
+	collectEntailments ( K, Queries );
+	if ( Queries.empty() )
+	{
+		Out << "No subsumptions to explain\n";
+		return;
+	}
+	// take an evenly spaced sample of the entailments
+	if ( Queries.size() > MaxQueries )
+	{
+		size_t step = Queries.size()/MaxQueries;
+		for ( size_t i = 0; i < MaxQueries; ++i )
+			Queries[i] = Queries[i*step];
+		Queries.resize(MaxQueries);
+	}
+
+	// the kernel to check the justifications from scratch
+	ReasoningKernel Checker;
+	Checker.setBindEntities(false);
+	Checker.setTopBottomRoleNames ( "*UROLE*", "*EROLE*", "*UDROLE*", "*EDROLE*" );
+
+	size_t nJust = 0, nIncomplete = 0, nWrong = 0;
+	double tSearch = 0, tCheck = 0;
+	for ( std::vector<Entailment>::const_iterator p = Queries.begin(), p_end = Queries.end(); p != p_end; ++p )
+	{
+		double start = wallTime();
+		if ( !K.computeJustifications ( p->first, p->second, MaxJustifications, TimeLimit ) )
+			++nIncomplete;
+		tSearch += wallTime() - start;
+		const std::vector<AxiomVec>& Just = K.getJustifications();
+		nJust += Just.size();
+
+		start = wallTime();
+		std::string problem;
+		if ( Just.empty() )
+			problem = "no justifications";
+		for ( std::vector<AxiomVec>::const_iterator q = Just.begin(), q_end = Just.end(); q != q_end && problem.empty(); ++q )
+		{
+			size_t nRedundant = checkJustification ( Checker, *q, *p );
+			if ( nRedundant > q->size() )
+				problem = "a justification does not entail it";
+			else if ( nRedundant > 0 )
+				problem = "a justification is not minimal";
+		}
+		tCheck += wallTime() - start;
+		if ( !problem.empty() && nWrong++ < MaxDiffs )
+			Out << "WRONG " << entailmentName(*p) << ": " << problem << "\n";
+	}
+	Checker.getOntology().safeClear();
+
+	// a tautology has the only empty justification, and a non-entailment has none
+	const Entailment& First = Queries.front();
+	K.computeJustifications ( pEM->And ( First.first, First.second != NULL ? First.second : pEM->Top() ), First.first, MaxJustifications, TimeLimit );
+	if ( K.getJustifications().size() != 1 || !K.getJustifications().front().empty() )
+	{
+		++nWrong;
+		Out << "WRONG tautology " << entailmentName(Entailment(First.first,First.first)) << ": "
+			<< K.getJustifications().size() << " justification(s) instead of the empty one\n";
+	}
+	if ( First.second != NULL && !K.isSubsumedBy(First.second,First.first) )
+	{
+		K.computeJustifications ( First.second, First.first, MaxJustifications, TimeLimit );
+		if ( !K.getJustifications().empty() )
+		{
+			++nWrong;
+			Out << "WRONG non-entailment " << entailmentName(Entailment(First.second,First.first)) << ": "
+				<< K.getJustifications().size() << " justification(s)\n";
+		}
+	}
+
+	Out << "Justifications: " << nJust << " found for " << Queries.size() << " entailments in " << tSearch << " s";
+	if ( nIncomplete > 0 )
+		Out << " (" << nIncomplete << " searches interrupted)";
+	Out << "; checked from scratch in " << tCheck << " s\n";
+	if ( nWrong == 0 )
+		Out << "Justifications of " << Queries.size() << " entailments are correct\n";
+	else
+		Out << "WARNING: justifications of " << nWrong << " entailments are wrong\n";
+}
@@ -0,0 +1,223 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// benchmark of the module extraction on the concept names of a loaded ontology
+
+#include <fstream>
+#include <algorithm>
+
+#include "Kernel.h"
+#include "Modularity.h"
+#include "tModuleIndex.h"
+#include "procTimer.h"
+
+// defined in FaCT.cpp
+extern std::ofstream Out;
+
+/// maximal number of modules to extract (the set-based extractor is linear in the ontology size per module)
+static const size_t MaxModules = 2000;
+/// number of names to check the STAR- and TOP-modules for (they are much larger than BOT-modules)
+static const size_t MaxCheckedModules = 200;
+/// number of module signatures to check all the axioms against in the locality benchmark
+static const size_t MaxLocalitySigs = 100;
+
+/// print the result of one measurement
+static void
+printResult ( const char* name, size_t nModules, size_t nAxioms, unsigned long long nChecks, float time )
+{
+	Out << name << ": " << time << " s, ";
+	if ( time > 0 )
+		Out << nModules/time << " modules/s, ";
+	Out << (float)nAxioms/nModules << " axioms per module, " << nChecks << " locality checks\n";
+}
+
+/// check locality of all the axioms of INDEX wrt the signatures of the modules of NAMES with both
+/// values of a TOP-locality, using the visitor-based checker and the compiled conditions; compare the results
+static void
+BenchmarkLocality ( const TModuleIndex& Index, TModuleExtractor& Extractor, const std::vector<const TNamedEntity*>& Names )
+{
+	std::vector<TDenseSignature> Sigs;
+	for ( size_t i = 0; i < Names.size() && i < MaxLocalitySigs; ++i )
+	{
+		TSignature sig;
+		sig.add(Names[i]);
+		Extractor.extract ( sig, M_BOT );
+		Sigs.push_back(Extractor.getDenseSignature());
+	}
+
+	// set both values of the TOP-locality
+	const size_t nSigs = Sigs.size();
+	for ( size_t i = 0; i < nSigs; ++i )
+	{
+		Sigs.push_back(Sigs[i]);
+		Sigs.back().setLocality(true);
+	}
+
+	TDenseSignature Sig;
+	SyntacticLocalityChecker Checker(&Sig);
+	std::vector<bool> Local;
+	Local.reserve(Sigs.size()*Index.size());
+	unsigned long long nLocal = 0, nDiff = 0;
+	std::vector<TDenseSignature>::const_iterator s, s_end = Sigs.end();
+	TsProcTimer tVisitor, tCompiled;
+
+	tVisitor.Start();
+	for ( s = Sigs.begin(); s != s_end; ++s )
+	{
+		Sig = *s;
+		for ( unsigned int i = 0; i < Index.size(); ++i )
+			Local.push_back(Checker.local(Index.getAxiom(i)));
+	}
+	tVisitor.Stop();
+
+	tCompiled.Start();
+	for ( s = Sigs.begin(); s != s_end; ++s )
+		for ( unsigned int i = 0; i < Index.size(); ++i )
+			if ( Index.local ( i, *s ) )
+				++nLocal;
+	tCompiled.Stop();
+
+	// compare separately to keep the timing loops tight
+	std::vector<bool>::const_iterator l = Local.begin();
+	for ( s = Sigs.begin(); s != s_end; ++s )
+		for ( unsigned int i = 0; i < Index.size(); ++i, ++l )
+			if ( Index.local ( i, *s ) != *l )
+				++nDiff;
+	unsigned long long nChecks = Local.size();
+
+	Out << "Locality checks: " << nChecks << " (" << nLocal << " local) wrt " << nSigs
+		<< " module signatures; compiled conditions take " << Index.getConditions().codeSize() << " words\n";
+	Out << "visitor checker: " << tVisitor << " s, compiled conditions: " << tCompiled << " s\n";
+	if ( nDiff != 0 )
+		Out << "WARNING: " << nDiff << " locality checks differ\n";
+}
+
+/// @return the module M as a sorted vector to compare modules regardless of the order of axioms
+static AxiomVec
+sortedModule ( const AxiomVec& M )
+{
+	AxiomVec ret(M);
+	std::sort ( ret.begin(), ret.end() );
+	return ret;
+}
+
+/// extract the modules of TYPE for every name of NAMES with the set-based extractor MOD and
+/// the dense-ID extractor EXTRACTOR; check that the modules are the same
+static void
+BenchmarkModuleType ( const AxiomVec& Axioms, TModularizer& Mod, TModuleExtractor& Extractor,
+					  const std::vector<const TNamedEntity*>& Names, ModuleType type )
+{
+	const char* typeName = type == M_BOT ? "BOT" : type == M_TOP ? "TOP" : "STAR";
+	std::vector<AxiomVec> Modules;
+	Modules.reserve(Names.size());
+	size_t nAxioms = 0;
+	TsProcTimer t;
+
+	// set-based extractor
+	unsigned long long nChecks = Mod.getNChecks();
+	t.Start();
+	for ( std::vector<const TNamedEntity*>::const_iterator p = Names.begin(), p_end = Names.end(); p != p_end; ++p )
+	{
+		TSignature sig;
+		sig.add(*p);
+		Mod.extract ( Axioms, sig, type );
+		Modules.push_back(Mod.getModule());
+		nAxioms += Mod.getModule().size();
+	}
+	t.Stop();
+	Out << typeName << "-modules\n";
+	printResult ( "set-based extractor", Names.size(), nAxioms, Mod.getNChecks()-nChecks, t );
+	t.Reset();
+
+	// dense-ID extractor
+	std::vector<AxiomVec> DenseModules;
+	DenseModules.reserve(Names.size());
+	nAxioms = 0;
+	nChecks = Extractor.getNChecks();
+	t.Start();
+	for ( size_t i = 0; i < Names.size(); ++i )
+	{
+		TSignature sig;
+		sig.add(Names[i]);
+		Extractor.extract ( sig, type );
+		DenseModules.push_back(Extractor.getModule());
+		nAxioms += Extractor.getModule().size();
+	}
+	t.Stop();
+	printResult ( "dense-ID extractor", Names.size(), nAxioms, Extractor.getNChecks()-nChecks, t );
+
+	// compare separately to keep the timing loops tight
+	size_t nDiff = 0;
+	for ( size_t i = 0; i < Names.size(); ++i )
+		if ( sortedModule(DenseModules[i]) != sortedModule(Modules[i]) )
+			++nDiff;
+
+	if ( nDiff != 0 )
+		Out << "WARNING: " << nDiff << " " << typeName << "-modules differ\n";
+}
+
+/// extract the BOT-, STAR- and TOP-modules of the concept names of the ontology in K with the
+/// set-based and the dense-ID extractors; check that the modules are the same
+void
+BenchmarkModules ( ReasoningKernel& K )
+{
+	const AxiomVec& Axioms = K.getOntology().getAxioms();
+
+	TsProcTimer t;
+	t.Start();
+	TModuleIndex Index;
+	Index.preprocessOntology(Axioms);
+	t.Stop();
+	float indexTime = t;
+	t.Reset();
+
+	// collect the concept names
+	std::vector<const TNamedEntity*> Names;
+	for ( unsigned int id = 0; id < Index.maxEntityId(); ++id )
+		if ( dynamic_cast<const TDLConceptName*>(Index.getEntity(id)) != NULL )
+			Names.push_back(Index.getEntity(id));
+
+	if ( Names.empty() )
+	{
+		Out << "No concept names to benchmark\n";
+		return;
+	}
+
+	// take an evenly spaced sample of the names
+	if ( Names.size() > MaxModules )
+	{
+		size_t step = Names.size()/MaxModules;
+		for ( size_t i = 0; i < MaxModules; ++i )
+			Names[i] = Names[i*step];
+		Names.resize(MaxModules);
+	}
+
+	Out << "Module extraction benchmark: " << Index.size() << " axioms, " << Names.size()
+		<< " sample concept names; dense index built in " << indexTime << " s\n";
+
+	TModularizer Mod(/*useSem=*/false);
+	Mod.preprocessOntology(Axioms);
+	TModuleExtractor Extractor(Index);
+	BenchmarkModuleType ( Axioms, Mod, Extractor, Names, M_BOT );
+	// STAR-modules are extracted within the range of the previous module, TOP-modules are large; check both on a smaller sample
+	std::vector<const TNamedEntity*> Sample ( Names.begin(), Names.begin() + std::min ( Names.size(), MaxCheckedModules ) );
+	BenchmarkModuleType ( Axioms, Mod, Extractor, Sample, M_STAR );
+	BenchmarkModuleType ( Axioms, Mod, Extractor, Sample, M_TOP );
+
+	BenchmarkLocality ( Index, Extractor, Names );
+}
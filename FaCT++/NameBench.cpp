@@ -0,0 +1,171 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+// benchmark of the name tables on the names of a loaded ontology
+
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+
+#include "Kernel.h"
+#include "tNameIndex.h"
+#include "tEntryName.h"
+#include "procTimer.h"
+
+// defined in FaCT.cpp
+extern std::ofstream Out;
+
+/// minimal number of lookups to measure
+static const size_t MinLookups = 2000000;
+/// the lookup results go here, so that the loops are not optimised away
+static volatile unsigned long Sink;
+
+/// add all the names from the index NI to NAMES
+static void
+addNames ( const TNameIndex& NI, std::vector<std::string>& Names )
+{
+	for ( unsigned int i = 0; i < NI.maxId(); ++i )
+		if ( NI.isValid(i) )
+			Names.push_back(NI.getName(i));
+}
+
+/// @return estimated number of bytes taken by a heap block of SIZE bytes
+static size_t
+heapSize ( size_t size )
+{
+	// the size of the block is kept before it, the whole chunk is aligned
+	return ( size + sizeof(void*) + 15 ) & ~(size_t)15;
+}
+
+/// @return estimated number of bytes taken by a std::string NAME kept by an entry
+static size_t
+stringSize ( const std::string& name )
+{
+	// long strings are kept on the heap
+	return sizeof(std::string) + ( name.size() > 15 ? heapSize(name.size()+1) : 0 );
+}
+
+/// @return estimated number of bytes taken by a std::map node with a key NAME
+static size_t
+mapNodeSize ( const std::string& name )
+{
+	// tree node header + key + value
+	return heapSize ( 4*sizeof(void*) + sizeof(std::string) + sizeof(void*) ) - sizeof(std::string) + stringSize(name);
+}
+
+/// print the result of one measurement
+static void
+printResult ( const char* name, size_t nNames, size_t memory, size_t nLookups, float time )
+{
+	Out << name << ": " << (float)memory/nNames << " bytes per name, ";
+	if ( time > 0 )
+		Out << nLookups/time/1e6 << " M lookups/s\n";
+	else
+		Out << "lookups are too fast to measure\n";
+}
+
+/// measure the lookups of NAMES in the ordered map
+static void
+benchMap ( const std::vector<std::string>& Names, const std::vector<unsigned int>& Order, unsigned int rounds )
+{
+	typedef std::map<std::string, unsigned int> NameMap;
+	NameMap Map;
+	size_t memory = 0;
+	for ( unsigned int i = 0; i < Names.size(); ++i )
+	{
+		Map[Names[i]] = i;
+		// the entry keeps its own copy of the name
+		memory += mapNodeSize(Names[i]) + stringSize(Names[i]);
+	}
+
+	TsProcTimer t;
+	unsigned long sum = 0;
+	t.Start();
+	for ( unsigned int r = 0; r < rounds; ++r )
+		for ( std::vector<unsigned int>::const_iterator p = Order.begin(), p_end = Order.end(); p != p_end; ++p )
+			sum += Map.find(Names[*p])->second;
+	t.Stop();
+	printResult ( "std::map (estimated memory)", Names.size(), memory, rounds*Order.size(), t );
+	Sink = sum;
+}
+
+/// measure the lookups of NAMES in the name index with the given prefix compression
+static void
+benchIndex ( const std::vector<std::string>& Names, const std::vector<unsigned int>& Order, unsigned int rounds, bool compress )
+{
+	TNameIndex Index;
+	Index.setPrefixCompression(compress);
+	size_t memory = 0;
+	for ( unsigned int i = 0; i < Names.size(); ++i )
+	{
+		Index.insert(Names[i]);
+		// the entry shares the name with the index; compressed names are not kept in one piece, so the entry copies them
+		memory += sizeof(TEntryName) + ( compress ? heapSize(Names[i].size()+1) : 0 );
+	}
+	memory += Index.getMemoryUsage();
+
+	TsProcTimer t;
+	unsigned long sum = 0;
+	t.Start();
+	for ( unsigned int r = 0; r < rounds; ++r )
+		for ( std::vector<unsigned int>::const_iterator p = Order.begin(), p_end = Order.end(); p != p_end; ++p )
+			sum += Index.find(Names[*p]);
+	t.Stop();
+	printResult ( compress ? "name index, shared prefixes" : "name index", Names.size(), memory, rounds*Order.size(), t );
+	if ( compress )
+		Out << "  (" << Index.getPrefixNumber()-1 << " different prefixes)\n";
+	Sink = sum;
+}
+
+/// measure memory per name and lookup throughput of the name tables on the names of the ontology in K.
+/// The memory includes the name kept by the entry of the name set
+void
+BenchmarkNames ( ReasoningKernel& K )
+{
+	TExpressionManager* EM = K.getExpressionManager();
+	std::vector<std::string> Names;
+	addNames ( EM->getConceptNameIndex(), Names );
+	addNames ( EM->getIndividualNameIndex(), Names );
+	addNames ( EM->getORoleNameIndex(), Names );
+	addNames ( EM->getDRoleNameIndex(), Names );
+
+	if ( Names.empty() )
+	{
+		Out << "No names to benchmark\n";
+		return;
+	}
+
+	size_t length = 0;
+	for ( std::vector<std::string>::const_iterator p = Names.begin(), p_end = Names.end(); p != p_end; ++p )
+		length += p->size();
+
+	// look the names up in a random (but reproducible) order
+	std::vector<unsigned int> Order;
+	for ( unsigned int i = 0; i < Names.size(); ++i )
+		Order.push_back(i);
+	srand(1);
+	for ( size_t i = Order.size()-1; i > 0; --i )
+		std::swap ( Order[i], Order[rand()%(i+1)] );
+	unsigned int rounds = (unsigned int)( ( MinLookups + Names.size() - 1 ) / Names.size() );
+
+	Out << "Name table benchmark: " << Names.size() << " names, " << (float)length/Names.size()
+		<< " characters per name on average, " << rounds*Order.size() << " lookups\n";
+	benchMap ( Names, Order, rounds );
+	benchIndex ( Names, Order, rounds, /*compress=*/false );
+	benchIndex ( Names, Order, rounds, /*compress=*/true );
+}
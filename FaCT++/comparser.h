@@ -51,6 +51,8 @@ protected:	// methods
 public:		// interface
 		/// c'tor
 	CommonParser ( std::istream* in ) : scan ( in ) { NextLex (); }
+		/// c'tor: parse the memory buffer [BEG,END)
+	CommonParser ( const char* beg, const char* end ) : scan ( beg, end ) { NextLex (); }
 		/// empty d'tor
 	virtual ~CommonParser ( void ) {}
 };	// CommonParser
@@ -35,25 +35,53 @@ const unsigned int MaxIDLength = 10240;
 class CommonScanner
 {
 protected:	// members
-		/// input stream
+		/// input stream (NULL if the scanner works over a memory buffer)
 	std::istream* InFile;
+		/// start of the memory buffer with the input
+	const char* BufBeg;
+		/// current position in the memory buffer
+	const char* BufPos;
+		/// end of the memory buffer
+	const char* BufEnd;
 		/// buffer for names
 	char LexBuff [ MaxIDLength + 1 ];
 		/// currently processed line of input (used in error diagnosis)
 	unsigned int CurLine;
 
 protected:	// methods
-		/// get next symbol from the stream
-	char NextChar ( void ) const { return InFile->get(); }
-		/// return given symbol back to stream
-	void PutBack ( char c ) const { InFile->putback(c); }
+		/// get next symbol from the buffer or the stream
+	char NextChar ( void )
+	{
+		if ( InFile != NULL )
+			return InFile->get();
+		return BufPos < BufEnd ? *BufPos++ : std::char_traits<char>::eof();
+	}
+		/// return given symbol back to the buffer or the stream
+	void PutBack ( char c )
+	{
+		if ( InFile != NULL )
+			InFile->putback(c);
+		else if ( !eof(c) )
+			--BufPos;
+	}
 		/// check whether C is a EOF char
 	static bool eof ( char c ) { return c == std::char_traits<char>::eof(); }
 
 public:		// interface
-		/// c'tor
+		/// c'tor: scan the stream INP
 	CommonScanner ( std::istream* inp )
 		: InFile(inp)
+		, BufBeg(NULL)
+		, BufPos(NULL)
+		, BufEnd(NULL)
+		, CurLine(1)
+		{}
+		/// c'tor: scan the memory buffer [BEG,END) in place
+	CommonScanner ( const char* beg, const char* end )
+		: InFile(NULL)
+		, BufBeg(beg)
+		, BufPos(beg)
+		, BufEnd(end)
 		, CurLine(1)
 		{}
 		/// d'tor
@@ -72,12 +100,18 @@ public:		// interface
 		/// reset scanner on the same file
 	void ReSet ( void )
 	{
-		InFile->clear();
-		InFile->seekg ( 0L, std::ios::beg );
+		if ( InFile != NULL )
+		{
+			InFile->clear();
+			InFile->seekg ( 0L, std::ios::beg );
+		}
+		BufPos = BufBeg;
 		CurLine = 1;
 	}
 		/// reset scanner to a given file
 	void reIn ( std::istream* in ) { InFile = in; CurLine = 1; }
+		/// @return number of bytes scanned so far in the memory buffer
+	size_t scannedBytes ( void ) const { return BufPos - BufBeg; }
 
 		/// output an error message
 	void error ( const char* msg = NULL ) const
@@ -0,0 +1,98 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+//-------------------------------------------------------------------------
+//
+//  Read-only memory mapping of an input file
+//
+//-------------------------------------------------------------------------
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+
+#ifndef _WIN32
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#endif
+
+/// read-only view of a regular file mapped into memory. Non-regular files
+/// (pipes, devices) are not mapped, so the caller should read them as streams
+class TMappedFile
+{
+protected:	// members
+		/// start of the mapped content
+	const char* Data;
+		/// size of the mapped content
+	size_t Size;
+
+private:	// no copy
+		/// no copy c'tor
+	TMappedFile ( const TMappedFile& );
+		/// no assignment
+	TMappedFile& operator = ( const TMappedFile& );
+
+public:		// interface
+		/// c'tor: map file NAME if it is a regular one
+	TMappedFile ( const char* name )
+		: Data(NULL)
+		, Size(0)
+	{
+#	ifndef _WIN32
+		int fd = open ( name, O_RDONLY );
+		if ( fd < 0 )
+			return;
+		struct stat st;
+		if ( fstat ( fd, &st ) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 )
+		{
+			void* p = mmap ( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+			if ( p != MAP_FAILED )
+			{
+				Data = static_cast<const char*>(p);
+				Size = st.st_size;
+				// the file is scanned once from the beginning to the end
+				madvise ( p, Size, MADV_SEQUENTIAL );
+			}
+		}
+		close(fd);
+#	else
+		(void)name;
+#	endif
+	}
+		/// d'tor: unmap the file
+	~TMappedFile ( void )
+	{
+#	ifndef _WIN32
+		if ( Data != NULL )
+			munmap ( const_cast<char*>(Data), Size );
+#	endif
+	}
+
+		/// @return true iff the file was mapped
+	bool isMapped ( void ) const { return Data != NULL; }
+		/// @return start of the file content
+	const char* begin ( void ) const { return Data; }
+		/// @return end of the file content
+	const char* end ( void ) const { return Data + Size; }
+		/// @return size of the file content
+	size_t size ( void ) const { return Size; }
+};	// TMappedFile
+
+#endif
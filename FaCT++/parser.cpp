@@ -31,6 +31,21 @@ void DLLispParser :: Parse ( void )
 		parseCommand ();
 }
 
+bool DLLispParser :: parseQuery ( std::string& name, TConceptExpr*& C, TConceptExpr*& D )
+{
+	if ( Current == LEXEOF )
+		return false;
+
+	MustBeM (LBRACK);
+	MustBe(ID);
+	name = scan.GetName();
+	NextLex ();
+	C = getConceptExpression();
+	D = Current == RBRACK ? NULL : getConceptExpression();
+	MustBeM (RBRACK);
+	return true;
+}
+
 void DLLispParser :: parseCommand ( void )
 {
 	MustBeM (LBRACK);
@@ -146,12 +146,24 @@ public:		// interface
 		// locally register Top/Bottom data properties
 		DataRoles.insert("*UDROLE*");
 		DataRoles.insert("*EDROLE*");
+	}
+		/// c'tor: parse the memory buffer [BEG,END)
+	DLLispParser ( const char* beg, const char* end, ReasoningKernel* kernel )
+		: CommonParser<TsScanner>(beg,end)
+		, Kernel (kernel)
+		, EManager(kernel->getExpressionManager())
+	{
+		// locally register Top/Bottom data properties
+		DataRoles.insert("*UDROLE*");
+		DataRoles.insert("*EDROLE*");
 	}
 		/// empty d'tor
 	~DLLispParser ( void ) {}
 
 		/// main parsing method
 	void Parse ( void );
+		/// parse the next query of the form (Name C [D]); @return false at the end of input
+	bool parseQuery ( std::string& name, TConceptExpr*& C, TConceptExpr*& D );
 };	// DLLispParser
 
 #endif
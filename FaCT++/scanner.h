@@ -41,6 +41,8 @@ protected:	// methods
 public:		// interface
 		/// c'tor
 	TsScanner ( std::istream* inp ) : CommonScanner(inp) {}
+		/// c'tor: scan the memory buffer [BEG,END)
+	TsScanner ( const char* beg, const char* end ) : CommonScanner(beg,end) {}
 		/// d'tor
 	~TsScanner ( void ) {}
 
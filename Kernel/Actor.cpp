@@ -19,6 +19,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "Actor.h"
 #include "tConcept.h"
 #include "tIndividual.h"
+#include "dlTBox.h"
 
 	/// check whether actor is applicable to the ENTRY
 bool
@@ -34,3 +35,35 @@ Actor :: applicable ( const EntryType* entry ) const
 	else	// concept or individual: standard are concepts
 		return static_cast<const TConcept*>(entry)->isSingleton() != isStandard;
 }
+
+void
+Actor :: getEntityNames ( const TBox& tbox, std::vector<const char*>& names ) const
+{
+	names.clear();
+	if ( isRole )	// object- or data-role
+	{
+		const RoleMaster& RM = isStandard ? *tbox.getORM() : *tbox.getDRM();
+		names.resize ( 2 + (RM.end()-RM.begin()), NULL );
+		names[0] = RM.getBotRole()->getName();
+		names[1] = RM.getTopRole()->getName();
+		for ( RoleMaster::const_iterator p = RM.begin(), p_end = RM.end(); p < p_end; ++p )
+			if ( tryEntry(*p) )
+				names[getEntityId(*p)] = (*p)->getName();
+	}
+	else if ( isStandard )	// concepts
+	{
+		names.resize ( 2 + (tbox.c_end()-tbox.c_begin()), NULL );
+		names[0] = tbox.getTop()->getName();
+		names[1] = tbox.getBottom()->getName();
+		for ( TBox::c_const_iterator p = tbox.c_begin(), p_end = tbox.c_end(); p < p_end; ++p )
+			if ( tryEntry(*p) )
+				names[getEntityId(*p)] = (*p)->getName();
+	}
+	else	// individuals
+	{
+		names.resize ( tbox.i_end()-tbox.i_begin(), NULL );
+		for ( TBox::i_const_iterator p = tbox.i_begin(), p_end = tbox.i_end(); p < p_end; ++p )
+			if ( tryEntry(*p) )
+				names[getEntityId(*p)] = (*p)->getName();
+	}
+}
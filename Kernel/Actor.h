@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "taxVertex.h"
 
 class TIndividual;
+class TBox;
 
 /// class for acting with concept taxonomy
 class Actor
@@ -33,10 +34,33 @@ public:		// types
 	typedef std::vector<const EntryType*> Array1D;
 		/// 2D vector of entries
 	typedef std::vector<Array1D> Array2D;
+		/// ID of an entity in the ID-based results
+	typedef unsigned int EntityId;
+		/// vector of entity IDs
+	typedef std::vector<EntityId> IdVector;
+
+protected:	// types
+		/// group of equal entries found in the taxonomy: the primer and its synonyms
+	struct FoundGroup
+	{
+			/// the representative of the group
+		const EntryType* primer;
+			/// begin of the synonyms
+		TaxonomyVertex::syn_iterator syn_begin;
+			/// end of the synonyms
+		TaxonomyVertex::syn_iterator syn_end;
+
+			/// init c'tor
+		FoundGroup ( const EntryType* p, TaxonomyVertex::syn_iterator begin, TaxonomyVertex::syn_iterator end )
+			: primer(p)
+			, syn_begin(begin)
+			, syn_end(end)
+			{}
+	}; // FoundGroup
 
 protected:	// members
-		/// vertices that satisfy the condition
-	std::vector<const TaxonomyVertex*> found;
+		/// groups of entries (from the vertices or from the instance buckets) that satisfy the condition
+	std::vector<FoundGroup> found;
 		/// flag to look at concept-like or role-like entities
 	bool isRole;
 		/// flag to look at concepts or object roles
@@ -49,22 +73,31 @@ protected:	// methods
 	bool applicable ( const EntryType* entry ) const;
 		/// @return true iff current entry is visible
 	bool tryEntry ( const EntryType* p ) const { return !p->isSystem() && applicable(p);}
-		/// @return true if at least one entry of a vertex V is visible
-	bool tryVertex ( const TaxonomyVertex& v ) const
+		/// @return true if at least one entry of a group G is visible
+	bool tryGroup ( const FoundGroup& g ) const
 	{
-		if ( tryEntry(v.getPrimer()) )
+		if ( tryEntry(g.primer) )
 			return true;
-		for ( TaxonomyVertex::syn_iterator p = v.begin_syn(), p_end=v.end_syn(); p != p_end; ++p )
+		for ( TaxonomyVertex::syn_iterator p = g.syn_begin; p != g.syn_end; ++p )
 			if ( tryEntry(*p) )
 				return true;
 		return false;
 	}
-		/// fills an array with all suitable data from the vertex
-	void fillArray ( const TaxonomyVertex& v, Array1D& array ) const
+		/// add IDs of all suitable entries from the group G to an array
+	void fillIds ( const FoundGroup& g, IdVector& ids ) const
+	{
+		if ( tryEntry(g.primer) )
+			ids.push_back(getEntityId(g.primer));
+		for ( TaxonomyVertex::syn_iterator p = g.syn_begin; p != g.syn_end; ++p )
+			if ( tryEntry(*p) )
+				ids.push_back(getEntityId(*p));
+	}
+		/// fills an array with all suitable data from the group G
+	void fillArray ( const FoundGroup& g, Array1D& array ) const
 	{
-		if ( tryEntry(v.getPrimer()) )
-			array.push_back(v.getPrimer());
-		for ( TaxonomyVertex::syn_iterator p = v.begin_syn(), p_end=v.end_syn(); p != p_end; ++p )
+		if ( tryEntry(g.primer) )
+			array.push_back(g.primer);
+		for ( TaxonomyVertex::syn_iterator p = g.syn_begin; p != g.syn_end; ++p )
 			if ( tryEntry(*p) )
 				array.push_back(*p);
 	}
@@ -98,7 +131,7 @@ public:		// interface
 	{
 		array.clear();
 		for ( size_t i = 0; i < found.size(); i++ )
-			fillArray ( *found[i], array );
+			fillArray ( found[i], array );
 	}
 		/// return data as a 2D-array
 	void getFoundData ( Array2D& array ) const
@@ -106,17 +139,60 @@ public:		// interface
 		array.clear();
 		array.resize(found.size());
 		for ( size_t i = 0; i < found.size(); i++ )
-			fillArray ( *found[i], array[i] );
+			fillArray ( found[i], array[i] );
+	}
+
+		/// return data as IDs of the found entries; OFFSETS gets the start of every synonym group and the total number of IDs
+	void getFoundIds ( IdVector& ids, IdVector& offsets ) const
+	{
+		ids.clear();
+		offsets.clear();
+		for ( size_t i = 0; i < found.size(); i++ )
+		{
+			offsets.push_back(ids.size());
+			fillIds ( found[i], ids );
+		}
+		offsets.push_back(ids.size());
+	}
+
+	// entity IDs
+
+		/// @return ID of an ENTRY of the kind of the actor. The IDs are dense for every kind:
+		/// concepts are TOP (0), BOTTOM (1), then the named ones; individuals start with 0;
+		/// roles are BOTTOM (0), TOP (1), then every role is followed by its inverse
+	EntityId getEntityId ( const EntryType* entry ) const
+	{
+		int id = entry->getId();
+		if ( isRole )
+		{
+			if ( entry->isBottom() )
+				return 0;
+			if ( entry->isTop() )
+				return 1;
+			return id > 0 ? 2*id : 2*(-id)+1;
+		}
+		if ( !isStandard )	// individuals
+			return id-1;
+		if ( entry->isTop() )
+			return 0;
+		if ( entry->isBottom() )
+			return 1;
+		return id+1;
 	}
+		/// fill NAMES with the names of all the entities of the kind of the actor in TBOX, indexed by IDs; unused IDs get NULL
+	void getEntityNames ( const TBox& tbox, std::vector<const char*>& names ) const;
 
 		/// taxonomy walking method.
 		/// @return true if node was processed
 		/// @return false if node can not be processed in current settings
-	bool apply ( const TaxonomyVertex& v )
+	bool apply ( const TaxonomyVertex& v ) { return apply ( v.getPrimer(), v.begin_syn(), v.end_syn() ); }
+		/// taxonomy walking method for an ENTRY with synonyms [BEGIN,END) that is kept outside of the graph
+	bool apply ( const EntryType* entry, TaxonomyVertex::syn_iterator begin, TaxonomyVertex::syn_iterator end )
 	{
-		if ( tryVertex(v) )
+		FoundGroup g ( entry, begin, end );
+		if ( tryGroup(g) )
 		{
-			found.push_back(&v);
+			found.push_back(g);
 			return true;
 		}
 		return false;
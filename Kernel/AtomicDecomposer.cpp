@@ -16,7 +16,11 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <pthread.h>
+#include <algorithm>
+
 #include "AtomicDecomposer.h"
+#include "tModuleIndex.h"
 #include "logging.h"
 #include "ProgressIndicatorInterface.h"
 
@@ -103,6 +107,127 @@ AtomicDecomposer :: createAtom ( TDLAxiom* ax, TOntologyAtom* parent )
 	return atom;
 }
 
+/// part of the parallel AD: modules of the axioms First, First+Step, ... of an index
+struct TADWorker
+{
+		/// index of the ontology
+	const TModuleIndex* Index;
+		/// module type
+	ModuleType type;
+		/// modules of the axioms (as local indices) by the axioms' local indices
+	std::vector<std::vector<unsigned int> >* Modules;
+		/// first axiom to process
+	unsigned int First;
+		/// step between the axioms to process
+	unsigned int Step;
+		/// progress indicator (for the main thread only)
+	ProgressIndicatorInterface* PI;
+		/// number of the locality checks made
+	unsigned long long nChecks;
+};
+
+/// build all the modules of the TADWorker ARG; run in a separate thread
+static void*
+buildAxiomModules ( void* arg )
+{
+	TADWorker* w = static_cast<TADWorker*>(arg);
+	TModuleExtractor Extractor(*w->Index);
+	for ( unsigned int i = w->First; i < w->Index->size(); i += w->Step )
+	{
+		Extractor.extract ( w->Index->getAxiom(i)->getSignature(), w->type );
+		std::vector<unsigned int>& M = (*w->Modules)[i];
+		M = Extractor.getModuleIds();
+		// keep the axioms of the module in the ontology order
+		std::sort ( M.begin(), M.end() );
+		if ( w->PI )
+			w->PI->incIndicator();
+	}
+	w->nChecks = Extractor.getNChecks();
+	return NULL;
+}
+
+/// build atoms of the ontology O from the modules of all axioms computed in parallel
+void
+AtomicDecomposer :: buildAtomsParallel ( TOntology* O )
+{
+	// index all the axioms but tautologies
+	TModuleIndex Index;
+	Index.preprocessOntology(O->getAxioms());
+	const unsigned int n = Index.size();
+
+	// build modules of all the axioms independently; the main thread does the work of the worker 0
+	std::vector<std::vector<unsigned int> > Modules(n);
+	std::vector<TADWorker> Workers(nThreads);
+	std::vector<pthread_t> Threads(nThreads);
+	for ( unsigned int t = 0; t < nThreads; ++t )
+	{
+		TADWorker w = { &Index, type, &Modules, t, nThreads, t == 0 ? PI : NULL, 0 };
+		Workers[t] = w;
+	}
+	if ( PI )
+		PI->setLimit((n+nThreads-1)/nThreads);
+	unsigned int nStarted = 1;
+	while ( nStarted < nThreads && pthread_create ( &Threads[nStarted], NULL, buildAxiomModules, &Workers[nStarted] ) == 0 )
+		++nStarted;
+	// the work of the threads that failed to start is done here as well
+	buildAxiomModules(&Workers[0]);
+	for ( unsigned int t = nStarted; t < nThreads; ++t )
+		buildAxiomModules(&Workers[t]);
+	for ( unsigned int t = 1; t < nStarted; ++t )
+		pthread_join ( Threads[t], NULL );
+	for ( unsigned int t = 0; t < nThreads; ++t )
+		nChecks += Workers[t].nChecks;
+
+	// merge the modules into atoms in the ontology order, so the result does not depend on the threads
+	std::vector<TOntologyAtom*> AtomOf ( n, NULL );
+	AxiomVec Module;
+
+	// the "bottom" atom for an empty signature goes first
+	TModuleExtractor Extractor(Index);
+	Extractor.extract ( TSignature(), type );
+	nChecks += Extractor.getNChecks();
+	std::vector<unsigned int> BotModule = Extractor.getModuleIds();
+	if ( !BotModule.empty() )
+	{
+		std::sort ( BotModule.begin(), BotModule.end() );
+		TOntologyAtom* atom = AOS->newAtom();
+		for ( std::vector<unsigned int>::const_iterator q = BotModule.begin(), q_end = BotModule.end(); q != q_end; ++q )
+			Module.push_back(Index.getAxiom(*q));
+		atom->setModule(Module);
+		for ( std::vector<unsigned int>::const_iterator q = BotModule.begin(), q_end = BotModule.end(); q != q_end; ++q )
+		{
+			atom->addAxiom(Index.getAxiom(*q));
+			AtomOf[*q] = atom;
+		}
+	}
+
+	// an axiom from the module of AX has the same module iff the modules are of the same size
+	for ( unsigned int i = 0; i < n; ++i )
+		if ( AtomOf[i] == NULL )
+		{
+			const std::vector<unsigned int>& M = Modules[i];
+			TOntologyAtom* atom = AOS->newAtom();
+			Module.clear();
+			for ( std::vector<unsigned int>::const_iterator q = M.begin(), q_end = M.end(); q != q_end; ++q )
+				Module.push_back(Index.getAxiom(*q));
+			atom->setModule(Module);
+			for ( std::vector<unsigned int>::const_iterator q = M.begin(), q_end = M.end(); q != q_end; ++q )
+				if ( AtomOf[*q] == NULL && Modules[*q].size() == M.size() )
+				{
+					atom->addAxiom(Index.getAxiom(*q));
+					AtomOf[*q] = atom;
+				}
+		}
+
+	// an atom depends on the atoms of all the axioms in its module
+	for ( AOStructure::iterator p = AOS->begin(), p_end = AOS->end(); p != p_end; ++p )
+	{
+		const TOntologyAtom::AxiomSet& M = (*p)->getModule();
+		for ( TOntologyAtom::AxiomSet::const_iterator q = M.begin(), q_end = M.end(); q != q_end; ++q )
+			(*p)->addDepAtom(AtomOf[Index.getIndex(*q)-1]);
+	}
+}
+
 /// get the atomic structure for given module type T
 AOStructure*
 AtomicDecomposer :: getAOS ( TOntology* O, ModuleType t )
@@ -120,6 +245,16 @@ AtomicDecomposer :: getAOS ( TOntology* O, ModuleType t )
 	// we don't need tautologies here
 	removeTautologies(O);
 
+	if ( nThreads > 1 && dynamic_cast<SyntacticLocalityChecker*>(pModularizer->getLocalityChecker()) != NULL )
+	{
+		// the modularizer might be gone by the time the number of checks is asked for
+		nChecks = pModularizer->getNChecks();
+		buildAtomsParallel(O);
+		restoreTautologies();
+		AOS->reduceGraph();
+		return AOS;
+	}
+
 	// init the root atom
 	rootAtom = new TOntologyAtom();
 	rootAtom -> setModule ( TOntologyAtom::AxiomSet ( O->begin(), O->end() ) );
@@ -141,6 +276,9 @@ AtomicDecomposer :: getAOS ( TOntology* O, ModuleType t )
 	if ( LLM.isWritable(llAlways) )
 		LL << "\nThere were " << pModularizer->getNNonLocal() << " non-local axioms out of " << pModularizer->getNChecks() << " totally checked\n";
 
+	// the modularizer might be gone by the time the number of checks is asked for
+	nChecks = pModularizer->getNChecks();
+
 	// clear the root atom
 	delete rootAtom;
 
@@ -24,6 +24,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "Modularity.h"
 
 class ProgressIndicatorInterface;
+class SaveLoadManager;
 
 /// atomical ontology structure
 class AOStructure
@@ -92,6 +93,10 @@ protected:	// members
 	TOntologyAtom* rootAtom;
 		/// module type for current AOS creation
 	ModuleType type;
+		/// number of locality checks made while creating the AOS
+	unsigned long long nChecks;
+		/// number of threads to build the modules of axioms; sequential nested algorithm is used if 1
+	unsigned int nThreads;
 
 protected:	// methods
 		/// remove tautologies (axioms that are always local) from the ontology temporarily
@@ -106,10 +111,12 @@ protected:	// methods
 	TOntologyAtom* buildModule ( const TSignature& sig, TOntologyAtom* parent );
 		/// create atom for given axiom AX; use parent atom's module as a base for the module search
 	TOntologyAtom* createAtom ( TDLAxiom* ax, TOntologyAtom* parent );
+		/// build atoms of the ontology O from the modules of all axioms computed in parallel
+	void buildAtomsParallel ( TOntology* O );
 
 public:		// interface
 		/// init c'tor; M would NOT be deleted in d'tor
-	AtomicDecomposer ( TModularizer* m ) : AOS(NULL), pModularizer(m), PI(NULL), rootAtom(NULL) {}
+	AtomicDecomposer ( TModularizer* m ) : AOS(NULL), pModularizer(m), PI(NULL), rootAtom(NULL), type(M_BOT), nChecks(0), nThreads(1) {}
 		/// d'tor
 	~AtomicDecomposer ( void );
 
@@ -120,8 +127,19 @@ public:		// interface
 
 		/// set progress indicator to be PI
 	void setProgressIndicator ( ProgressIndicatorInterface* pi ) { PI = pi; }
+		/// set the number of threads to build the modules. Parallel mode works for syntactic locality only
+	void setThreads ( unsigned int n ) { nThreads = n > 0 ? n : 1; }
 		/// get number of performed locality checks
-	unsigned long long getLocChekNumber ( void ) const { return pModularizer->getNChecks(); }
+	unsigned long long getLocChekNumber ( void ) const { return nChecks; }
+		/// get the module type of the last created AOS
+	ModuleType getModuleType ( void ) const { return type; }
+
+	// save/load interface; implementation is in SaveLoad.cpp
+
+		/// save the AOS; all the ontology axioms should be registered in M
+	void Save ( SaveLoadManager& m ) const;
+		/// load the AOS instead of creating it; all the ontology axioms should be registered in M
+	void Load ( SaveLoadManager& m );
 }; // AtomicDecomposer
 
 #endif
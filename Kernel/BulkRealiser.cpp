@@ -0,0 +1,587 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <map>
+#include <algorithm>
+#include <unistd.h>
+
+#include "BulkRealiser.h"
+#include "Kernel.h"
+#include "Reasoner.h"
+
+/// maximal number of the individuals checked by one group test
+static const size_t MaxGroupSize = 512;
+/// number of the failed group tests of a job (over the passed ones) after which its candidates are checked singly
+static const unsigned long MaxGroupFailures = 2;
+/// minimal number of the candidates per kernel at a level to check them in parallel: a parallel kernel
+/// preprocesses the whole ontology, which costs as much as thousands of tests
+static const size_t MinWorkerCandidates = 2048;
+
+struct BulkRealiser::Job
+{
+		/// index of the vertex of the concept
+	unsigned int Vertex;
+		/// concept to check
+	const TConcept* C;
+		/// candidate instances of the concept
+	IndexSet Inds;
+		/// found instances of the concept
+	IndexSet Yes;
+		/// number of the group tests
+	unsigned long nGroupTests;
+		/// number of the failed group tests (some individuals could be instances)
+	unsigned long nFailedGroupTests;
+		/// number of the single tests
+	unsigned long nSingleTests;
+		/// true iff the job is checked
+	bool Done;
+
+		/// init c'tor
+	Job ( unsigned int v, const TConcept* c )
+		: Vertex(v)
+		, C(c)
+		, nGroupTests(0)
+		, nFailedGroupTests(0)
+		, nSingleTests(0)
+		, Done(false)
+		{}
+
+		/// @return true iff the group tests keep failing, so most of the candidates are instances
+	bool checkSingly ( void ) const { return 2*nFailedGroupTests > nGroupTests + MaxGroupFailures; }
+}; // Job
+
+/// worker slot of a realiser to run in a thread
+struct WorkerSlot
+{
+		/// realiser to work for
+	BulkRealiser* Realiser;
+		/// number of the slot
+	unsigned int n;
+}; // WorkerSlot
+
+BulkRealiser :: BulkRealiser ( unsigned int threads, unsigned long timeout )
+	: KB(NULL)
+	, NextJob(0)
+	, nThreads(threads > 0 ? threads : 1)
+	, Timeout(timeout)
+	, nIndividuals(0)
+	, nCandidates(0)
+	, nToldYes(0)
+	, nCachedYes(0)
+	, nCachedNo(0)
+	, nGroupTests(0)
+	, nSingleTests(0)
+	, nFailedWorkers(0)
+{
+	pthread_mutex_init ( &Lock, NULL );
+	// the kernels over the number of the processors would only slow each other down
+	long nCPU = sysconf(_SC_NPROCESSORS_ONLN);
+	if ( nCPU > 0 && nThreads > (unsigned long)nCPU )
+		nThreads = (unsigned int)nCPU;
+}
+
+BulkRealiser :: ~BulkRealiser ( void )
+{
+	clear();
+	pthread_mutex_destroy(&Lock);
+}
+
+void
+BulkRealiser :: clear ( void )
+{
+	for ( std::vector<Job*>::iterator p = Jobs.begin(), p_end = Jobs.end(); p != p_end; ++p )
+		delete *p;
+	Jobs.clear();
+	for ( std::vector<ReasoningKernel*>::iterator p = Workers.begin(), p_end = Workers.end(); p != p_end; ++p )
+		if ( *p != NULL )
+		{
+			// the axioms belong to the main ontology
+			(*p)->getOntology().safeClear();
+			delete *p;
+		}
+	Workers.clear();
+	WorkerFailed.clear();
+}
+
+std::vector<unsigned int>
+BulkRealiser :: sortVertices ( void )
+{
+	Vertices.clear();
+	VertexIndex.clear();
+	Parents.clear();
+	std::vector<unsigned int> Level;
+	const Taxonomy* Tax = KB->getTaxonomy();
+	TaxonomyVertex* top = Tax->getTopVertex();
+	TaxonomyVertex* bottom = Tax->getBottomVertex();
+
+	// a vertex is taken when all its parents are there
+	std::map<const TaxonomyVertex*, unsigned int> nWaiting;
+	Vertices.push_back(top);
+	VertexIndex[top] = 0;
+	Level.push_back(0);
+	Parents.push_back(IndexSet());
+	for ( size_t i = 0; i < Vertices.size(); ++i )
+		for ( TaxonomyVertex::iterator p = Vertices[i]->begin(/*upDirection=*/false), p_end = Vertices[i]->end(/*upDirection=*/false); p != p_end; ++p )
+		{
+			if ( *p == bottom )
+				continue;
+			std::map<const TaxonomyVertex*, unsigned int>::iterator w = nWaiting.find(*p);
+			if ( w == nWaiting.end() )
+				w = nWaiting.insert(std::make_pair(*p,(unsigned int)((*p)->end(true)-(*p)->begin(true)))).first;
+			if ( --w->second > 0 )
+				continue;
+
+			unsigned int level = 0;
+			IndexSet Up;
+			for ( TaxonomyVertex::iterator q = (*p)->begin(/*upDirection=*/true), q_end = (*p)->end(/*upDirection=*/true); q != q_end; ++q )
+			{
+				Up.push_back(VertexIndex[*q]);
+				level = std::max ( level, Level[Up.back()]+1 );
+			}
+			VertexIndex[*p] = Vertices.size();
+			Vertices.push_back(*p);
+			Level.push_back(level);
+			Parents.push_back(IndexSet());
+			Parents.back().swap(Up);
+		}
+
+	return Level;
+}
+
+void
+BulkRealiser :: setToldTypes ( void )
+{
+	Told.assign ( Vertices.size(), IndexSet() );
+	std::vector<unsigned int> Mark(Vertices.size(),0);
+	std::vector<unsigned int> Stack;
+	for ( unsigned int i = 0; i < Individuals.size(); ++i )
+	{
+		const TIndividual* I = Individuals[i];
+		for ( ClassifiableEntry::const_iterator p = I->told_begin(), p_end = I->told_end(); p != p_end; ++p )
+		{
+			if ( !(*p)->isClassified() )
+				continue;
+			std::map<const TaxonomyVertex*, unsigned int>::const_iterator v = VertexIndex.find((*p)->getTaxVertex());
+			if ( v != VertexIndex.end() && Mark[v->second] != i+1 )
+			{
+				Mark[v->second] = i+1;
+				Stack.push_back(v->second);
+			}
+		}
+		// all the ancestors of the told subsumers are the types of I; the indices are added in order
+		while ( !Stack.empty() )
+		{
+			unsigned int v = Stack.back();
+			Stack.pop_back();
+			Told[v].push_back(i);
+			for ( IndexSet::const_iterator q = Parents[v].begin(), q_end = Parents[v].end(); q != q_end; ++q )
+				if ( Mark[*q] != i+1 )
+				{
+					Mark[*q] = i+1;
+					Stack.push_back(*q);
+				}
+		}
+	}
+}
+
+void
+BulkRealiser :: filterCandidates ( unsigned int v )
+{
+	TaxonomyVertex* V = Vertices[v];
+	const TConcept* C = static_cast<const TConcept*>(V->getPrimer());
+	// primitive singletons are not the types of other individuals, as in the usual realisation
+	if ( C->isSingleton() && C->isPrimitive() && !C->isNominal() )
+		return;
+
+	// the candidates are the instances of all the parents
+	IndexSet Cand, tmp;
+	for ( IndexSet::const_iterator p = Parents[v].begin(), p_end = Parents[v].end(); p != p_end; ++p )
+	{
+		const IndexSet& M = Members[*p];
+		if ( p == Parents[v].begin() )
+			Cand = M;
+		else
+		{
+			tmp.clear();
+			std::set_intersection ( Cand.begin(), Cand.end(), M.begin(), M.end(), std::back_inserter(tmp) );
+			Cand.swap(tmp);
+		}
+		if ( Cand.empty() )
+			return;
+	}
+
+	Job* J = NULL;
+	IndexSet::const_iterator t = Told[v].begin(), t_end = Told[v].end();
+	for ( IndexSet::const_iterator p = Cand.begin(), p_end = Cand.end(); p != p_end; ++p )
+	{
+		++nCandidates;
+		// both sets are sorted
+		while ( t != t_end && *t < *p )
+			++t;
+		if ( t != t_end && *t == *p )
+		{
+			++nToldYes;
+			Members[v].push_back(*p);
+			continue;
+		}
+		const TIndividual* I = Individuals[*p];
+		if ( KB->testSortedNonSubsumption ( I, C ) )
+		{
+			++nCachedNo;
+			continue;
+		}
+		switch ( KB->testCachedNonSubsumption ( I, C ) )
+		{
+		case csValid:	// the model of I merges with the one of not C
+			++nCachedNo;
+			break;
+		case csInvalid:	// C is in the model of I
+			++nCachedYes;
+			Members[v].push_back(*p);
+			break;
+		default:		// need the tableaux
+			if ( J == NULL || J->Inds.size() >= MaxGroupSize )
+			{
+				J = new Job ( v, C );
+				Jobs.push_back(J);
+			}
+			J->Inds.push_back(*p);
+			break;
+		}
+	}
+}
+
+void*
+BulkRealiser :: runWorker ( void* arg )
+{
+	WorkerSlot* slot = static_cast<WorkerSlot*>(arg);
+	slot->Realiser->checkJobs(slot->n);
+	return NULL;
+}
+
+BulkRealiser::Job*
+BulkRealiser :: nextJob ( void )
+{
+	pthread_mutex_lock(&Lock);
+	Job* ret = NextJob < Jobs.size() ? Jobs[NextJob++] : NULL;
+	pthread_mutex_unlock(&Lock);
+	return ret;
+}
+
+TBox*
+BulkRealiser :: getWorkerKB ( unsigned int n )
+{
+	if ( n == 0 )
+		return KB;
+	if ( Workers[n] == NULL && !WorkerFailed[n] )
+	{
+		ReasoningKernel* K = new ReasoningKernel();
+		// the entities of the axioms are shared with the main kernel
+		K->setBindEntities(false);
+		K->setOperationTimeout(Timeout);
+		K->getOntology().setShared(Axioms);
+		Workers[n] = K;
+		try
+		{
+			K->preprocessKB();
+		}
+		catch ( const EFaCTPlusPlus& )
+		{
+			WorkerFailed[n] = true;
+		}
+	}
+	return WorkerFailed[n] ? NULL : Workers[n]->getTBox();
+}
+
+void
+BulkRealiser :: checkJobs ( unsigned int n )
+{
+	TBox* W = getWorkerKB(n);
+	if ( W == NULL )	// the rest of the kernels will do the jobs
+		return;
+
+	for ( Job* J = nextJob(); J != NULL; J = nextJob() )
+	{
+		if ( n == 0 )	// failures of the KB itself are reported as usual
+		{
+			checkJob ( *W, *J );
+			continue;
+		}
+		try
+		{
+			checkJob ( *W, *J );
+		}
+		catch ( const EFaCTPlusPlus& )
+		{
+			// the job is left to the KB itself
+			WorkerFailed[n] = true;
+			return;
+		}
+	}
+}
+
+void
+BulkRealiser :: checkJob ( TBox& W, Job& J )
+{
+	// the parallel kernels have their own entries with the same names
+	const TConcept* C = &W == KB ? J.C : W.getConcept(J.C->getName());
+	IndividualVec Inds;
+	Inds.reserve(J.Inds.size());
+	for ( IndexSet::const_iterator p = J.Inds.begin(), p_end = J.Inds.end(); p != p_end; ++p )
+		Inds.push_back ( &W == KB ? Individuals[*p] : W.getIndividual(Individuals[*p]->getName()) );
+
+	J.Yes.clear();
+	J.nGroupTests = J.nFailedGroupTests = J.nSingleTests = 0;
+	partition ( W, J, C, Inds, 0, Inds.size() );
+	J.Done = true;
+}
+
+void
+BulkRealiser :: partition ( TBox& W, Job& J, const TConcept* C, const IndividualVec& Inds, size_t begin, size_t end )
+{
+	// a group test pays off only if it could pass; otherwise the halves are checked again
+	if ( end - begin == 1 || J.checkSingly() )
+	{
+		for ( size_t i = begin; i < end; ++i )
+		{
+			++J.nSingleTests;
+			if ( W.isSubHolds ( Inds[i], C ) )
+				J.Yes.push_back(J.Inds[i]);
+		}
+		return;
+	}
+
+	// no instances among the individuals if all of them could be out of C at once
+	++J.nGroupTests;
+	if ( W.isNonInstanceSet ( IndividualVec ( Inds.begin()+begin, Inds.begin()+end ), C ) )
+		return;
+	++J.nFailedGroupTests;
+
+	size_t mid = begin + (end-begin)/2;
+	partition ( W, J, C, Inds, begin, mid );
+	partition ( W, J, C, Inds, mid, end );
+}
+
+void
+BulkRealiser :: runJobs ( void )
+{
+	NextJob = 0;
+	// only the concepts from the ontology are known to the parallel kernels
+	bool named = true;
+	for ( std::vector<Job*>::const_iterator p = Jobs.begin(), p_end = Jobs.end(); p != p_end; ++p )
+		named &= (*p)->C->getEntity() != NULL;
+
+	// the kernels loaded at the previous levels are used anyway; new ones are loaded only for a lot of candidates
+	size_t nCand = 0, nLoaded = 1;
+	for ( std::vector<Job*>::const_iterator p = Jobs.begin(), p_end = Jobs.end(); p != p_end; ++p )
+		nCand += (*p)->Inds.size();
+	while ( nLoaded < nThreads && Workers[nLoaded] != NULL && !WorkerFailed[nLoaded] )
+		++nLoaded;
+	size_t nWorkers = named ? std::min ( std::min ( (size_t)nThreads, Jobs.size() ), std::max ( nLoaded, 1 + nCand/MinWorkerCandidates ) ) : 1;
+	std::vector<pthread_t> Threads(nWorkers);
+	std::vector<WorkerSlot> Slots(nWorkers);
+	size_t i, nStarted = 1;
+	for ( i = 1; i < nWorkers; ++i, ++nStarted )
+	{
+		Slots[i].Realiser = this;
+		Slots[i].n = i;
+		if ( pthread_create ( &Threads[i], NULL, runWorker, &Slots[i] ) != 0 )
+			break;	// the started workers will do the rest
+	}
+	try
+	{
+		checkJobs(0);
+	}
+	catch ( ... )
+	{
+		// stop the workers before reporting the failure
+		pthread_mutex_lock(&Lock);
+		NextJob = Jobs.size();
+		pthread_mutex_unlock(&Lock);
+		for ( i = 1; i < nStarted; ++i )
+			pthread_join ( Threads[i], NULL );
+		throw;
+	}
+	for ( i = 1; i < nStarted; ++i )
+		pthread_join ( Threads[i], NULL );
+
+	// the jobs of the failed kernels are done by the KB itself; merge the results
+	for ( std::vector<Job*>::iterator p = Jobs.begin(), p_end = Jobs.end(); p != p_end; ++p )
+	{
+		Job& J = **p;
+		if ( !J.Done )
+			checkJob ( *KB, J );
+		nGroupTests += J.nGroupTests;
+		nSingleTests += J.nSingleTests;
+		IndexSet& M = Members[J.Vertex];
+		M.insert ( M.end(), J.Yes.begin(), J.Yes.end() );
+		std::sort ( M.begin(), M.end() );
+		delete *p;
+	}
+	Jobs.clear();
+}
+
+void
+BulkRealiser :: buildTaxonomy ( void )
+{
+	Taxonomy* Tax = KB->getTaxonomy();
+
+	// the direct types of an individual are its types without subtypes; the types of the individual I
+	// are Types[Start[I],Start[I+1])
+	std::vector<size_t> Start(Individuals.size()+1,0);
+	for ( unsigned int v = 1; v < Vertices.size(); ++v )
+		for ( IndexSet::const_iterator p = Members[v].begin(), p_end = Members[v].end(); p != p_end; ++p )
+			++Start[*p+1];
+	for ( unsigned int i = 0; i < Individuals.size(); ++i )
+		Start[i+1] += Start[i];
+	IndexSet Types(Start.back());
+	std::vector<size_t> Next ( Start.begin(), Start.end()-1 );
+	for ( unsigned int v = 1; v < Vertices.size(); ++v )
+	{
+		for ( IndexSet::const_iterator p = Members[v].begin(), p_end = Members[v].end(); p != p_end; ++p )
+			Types[Next[*p]++] = v;
+		IndexSet().swap(Members[v]);
+	}
+
+	// the parents of the types are the types themselves, so a type is direct if it is not a parent of another one;
+	// put the individuals into the instance buckets of their direct types
+	std::vector<unsigned int> Covered(Vertices.size(),0);
+	std::vector<TaxonomyVertex*> Direct;
+	for ( unsigned int i = 0; i < Individuals.size(); ++i )
+	{
+		IndexSet::const_iterator t_begin = Types.begin()+Start[i], t_end = Types.begin()+Start[i+1], p;
+		for ( p = t_begin; p != t_end; ++p )
+			for ( IndexSet::const_iterator q = Parents[*p].begin(), q_end = Parents[*p].end(); q != q_end; ++q )
+				Covered[*q] = i+1;
+
+		Direct.clear();
+		for ( p = t_begin; p != t_end; ++p )
+			if ( Covered[*p] != i+1 )
+				Direct.push_back(Vertices[*p]);
+		if ( Direct.empty() )
+			Direct.push_back(Tax->getTopVertex());
+		Tax->addInstance ( Individuals[i], Direct.begin(), Direct.end() );
+	}
+}
+
+void
+BulkRealiser :: addSynonym ( const TIndividual* I, const TIndividual* syn )
+{
+	if ( I->getTaxVertex() != NULL )	// nominals are in the graph
+		I->getTaxVertex()->addSynonym(syn);
+	else
+		KB->getTaxonomy()->addInstanceSynonym ( I, syn );
+}
+
+void
+BulkRealiser :: realise ( TBox& kb, const AxiomVec& ontology )
+{
+	Timer.Reset();
+	Timer.Start();
+	KB = &kb;
+	KB->clearQueryConcept();
+	nIndividuals = nCandidates = nToldYes = nCachedYes = nCachedNo = nGroupTests = nSingleTests = nFailedWorkers = 0;
+
+	// only the parallel kernels need the axioms
+	Axioms.clear();
+	if ( nThreads > 1 )
+		for ( AxiomVec::const_iterator p = ontology.begin(), p_end = ontology.end(); p != p_end; ++p )
+			if ( (*p)->isUsed() )
+				Axioms.push_back(*p);
+
+	// the individuals merged with others become their synonyms, as in the usual realisation
+	Individuals.clear();
+	IndividualVec Same, Synonyms;
+	for ( TBox::i_iterator p = KB->i_begin(), p_end = KB->i_end(); p != p_end; ++p )
+	{
+		TIndividual* I = *p;
+		if ( I->isClassified() || I->isNonClassifiable() )
+			continue;
+		if ( I->isSynonym() )
+			Synonyms.push_back(I);
+		else if ( KB->isBlockedInd(I) && ( KB->isBlockingDet(I) || KB->isSubHolds ( I, KB->getBlockingInd(I) ) ) )
+			Same.push_back(I);
+		else
+			Individuals.push_back(I);
+	}
+	nIndividuals = Individuals.size() + Same.size() + Synonyms.size();
+
+	// process the concepts top-down level by level; the concepts of the same level are independent
+	std::vector<unsigned int> Level = sortVertices();
+	Members.assign ( Vertices.size(), IndexSet() );
+	for ( unsigned int i = 0; i < Individuals.size(); ++i )
+		Members[0].push_back(i);
+	setToldTypes();
+	Workers.assign ( nThreads, NULL );
+	WorkerFailed.assign ( nThreads, false );
+
+	try
+	{
+		unsigned int maxLevel = 0;
+		for ( std::vector<unsigned int>::const_iterator p = Level.begin(), p_end = Level.end(); p != p_end; ++p )
+			maxLevel = std::max ( maxLevel, *p );
+		for ( unsigned int level = 1; level <= maxLevel; ++level )
+		{
+			for ( unsigned int v = 1; v < Vertices.size(); ++v )
+				if ( Level[v] == level )
+					filterCandidates(v);
+			if ( !Jobs.empty() )
+				runJobs();
+		}
+	}
+	catch ( ... )
+	{
+		clear();
+		Timer.Stop();
+		throw;
+	}
+	for ( unsigned int i = 1; i < nThreads; ++i )
+		if ( WorkerFailed[i] )
+			++nFailedWorkers;
+	clear();
+
+	buildTaxonomy();
+	// the blocking individual could be merged with another one itself, so take the classified ones first
+	while ( !Same.empty() )
+	{
+		IndividualVec Rest;
+		for ( IndividualVec::const_iterator p = Same.begin(), p_end = Same.end(); p != p_end; ++p )
+			if ( KB->getBlockingInd(*p)->isClassified() )
+				addSynonym ( KB->getBlockingInd(*p), *p );
+			else
+				Rest.push_back(*p);
+		fpp_assert ( Rest.size() < Same.size() );
+		Same.swap(Rest);
+	}
+	for ( IndividualVec::const_iterator p = Synonyms.begin(), p_end = Synonyms.end(); p != p_end; ++p )
+	{
+		fpp_assert ( resolveSynonym(*p)->isClassified() );
+		addSynonym ( resolveSynonym(*p), *p );
+	}
+	KB->getTaxonomy()->finalise();
+	KB->setRealised();
+
+	Members.clear();
+	Told.clear();
+	Vertices.clear();
+	VertexIndex.clear();
+	Parents.clear();
+	Individuals.clear();
+	Axioms.clear();
+	Timer.Stop();
+}
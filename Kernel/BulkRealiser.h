@@ -0,0 +1,166 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef BULKREALISER_H
+#define BULKREALISER_H
+
+#include <pthread.h>
+#include <vector>
+#include <map>
+#include <ostream>
+
+#include "tDLAxiom.h"
+#include "procTimer.h"
+
+class TBox;
+class TConcept;
+class TIndividual;
+class TaxonomyVertex;
+class ReasoningKernel;
+
+/// realisation of all the individuals of a classified KB at once. The concepts of the taxonomy are
+/// processed top-down, so an individual is a candidate instance of a concept only if it is an instance
+/// of all its parents. The ancestors of the told subsumers of an individual are its types without any
+/// tests, as in the usual realisation. The model of every individual cached after the consistency check
+/// answers most of the other candidates: a clash with the negation of the concept means an instance,
+/// and a model that can be merged with it means a non-instance. The rest of the candidates of a concept
+/// are checked in groups: if the negations of the concept are consistent together for all the individuals
+/// of a group, none of them is an instance; otherwise the group is split in halves. If most of the group
+/// tests of a concept fail, the rest of its candidates are checked singly. The groups of the independent
+/// concepts are checked by the separate kernels in parallel if there are enough of them to pay for loading
+/// the kernels. At the end the individuals are put into the taxonomy under their most specific types, as
+/// the usual realisation does.
+class BulkRealiser
+{
+protected:	// types
+		/// vector of the individuals
+	typedef std::vector<TIndividual*> IndividualVec;
+		/// sorted set of the indices of the individuals
+	typedef std::vector<unsigned int> IndexSet;
+		/// group of the candidate instances of a concept to check by the tableaux; defined in the .cpp
+	struct Job;
+
+protected:	// members
+		/// axioms of the ontology to load to the parallel kernels
+	AxiomVec Axioms;
+		/// KB to realise
+	TBox* KB;
+		/// individuals to realise
+	IndividualVec Individuals;
+		/// vertices of the concept taxonomy (without the bottom) in the topological order, the top first
+	std::vector<TaxonomyVertex*> Vertices;
+		/// map from a vertex to its index in Vertices
+	std::map<const TaxonomyVertex*, unsigned int> VertexIndex;
+		/// indices of the parents of every vertex in Vertices
+	std::vector<IndexSet> Parents;
+		/// instances of every vertex
+	std::vector<IndexSet> Members;
+		/// instances of every vertex known from the told subsumers of the individuals
+	std::vector<IndexSet> Told;
+		/// groups to check at the current level of the taxonomy
+	std::vector<Job*> Jobs;
+		/// parallel kernels; the first slot belongs to the KB itself
+	std::vector<ReasoningKernel*> Workers;
+		/// non-zero for the slots of the kernels that fail to load the ontology or to check a job (not bits: set by several threads)
+	std::vector<char> WorkerFailed;
+		/// lock of the next job to check
+	pthread_mutex_t Lock;
+		/// index of the next job to check
+	size_t NextJob;
+		/// number of kernels that check the groups in parallel
+	unsigned int nThreads;
+		/// timeout of a single test in the parallel kernels
+	unsigned long Timeout;
+		/// time of the realisation
+	TsProcTimer Timer;
+
+	// statistics
+
+		/// number of the realised individuals
+	size_t nIndividuals;
+		/// number of the candidate types of the individuals
+	unsigned long nCandidates;
+		/// number of the candidates answered positively by the told subsumers
+	unsigned long nToldYes;
+		/// number of the candidates answered positively by the cached models
+	unsigned long nCachedYes;
+		/// number of the candidates answered negatively by the cached models or by the sorts
+	unsigned long nCachedNo;
+		/// number of the group tests
+	unsigned long nGroupTests;
+		/// number of the tests of the single individuals
+	unsigned long nSingleTests;
+		/// number of the parallel kernels that fail to load the ontology or to check a job
+	unsigned int nFailedWorkers;
+
+private:	// no copy
+		/// no copy c'tor
+	BulkRealiser ( const BulkRealiser& );
+		/// no assignment
+	BulkRealiser& operator = ( const BulkRealiser& );
+
+protected:	// methods
+		/// sort the concept vertices of the taxonomy of the KB top-down; @return the level of every vertex
+	std::vector<unsigned int> sortVertices ( void );
+		/// collect the instances of the vertices known from the told subsumers of the individuals
+	void setToldTypes ( void );
+		/// find the candidates of the vertex V; answer them by the told types and the cached models and make jobs for the rest
+	void filterCandidates ( unsigned int v );
+		/// check all the jobs of the current level, in parallel if possible
+	void runJobs ( void );
+		/// thread body: check jobs in the worker slot of ARG until they are over
+	static void* runWorker ( void* arg );
+		/// check jobs with the kernel in the slot N until they are over
+	void checkJobs ( unsigned int n );
+		/// @return the next job to check; NULL if there are no more
+	Job* nextJob ( void );
+		/// @return the KB of the worker slot N; NULL if the kernel can't be loaded
+	TBox* getWorkerKB ( unsigned int n );
+		/// check the job J using KB W
+	void checkJob ( TBox& W, Job& J );
+		/// add the instances of C from INDS[BEGIN,END) (the entries of W for the individuals of J) to the result of J
+	void partition ( TBox& W, Job& J, const TConcept* C, const IndividualVec& Inds, size_t begin, size_t end );
+		/// put the realised individuals into the taxonomy of the KB
+	void buildTaxonomy ( void );
+		/// make SYN the same individual as a classified individual I
+	void addSynonym ( const TIndividual* I, const TIndividual* syn );
+		/// delete the jobs and the parallel kernels
+	void clear ( void );
+
+public:		// interface
+		/// init c'tor: use THREADS kernels with the TIMEOUT of a test
+	BulkRealiser ( unsigned int threads, unsigned long timeout );
+		/// d'tor
+	~BulkRealiser ( void );
+
+		/// realise the individuals of the classified KB with the axioms of the ONTOLOGY
+	void realise ( TBox& kb, const AxiomVec& ontology );
+
+		/// print the statistics of the realisation
+	void PrintStat ( std::ostream& o ) const
+	{
+		o << "Bulk realisation: " << nIndividuals << " individuals with " << nCandidates << " candidate types in "
+		  << Timer << " seconds; " << nToldYes << " told types, " << nCachedYes << " types and " << nCachedNo << " non-types found in the cached models, "
+		  << nGroupTests << " group tests and " << nSingleTests << " single tests";
+		if ( nFailedWorkers > 0 )
+			o << "; " << nFailedWorkers << " parallel kernels failed";
+		o << "\n";
+	}
+}; // BulkRealiser
+
+#endif
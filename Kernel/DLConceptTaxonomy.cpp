@@ -27,6 +27,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "logging.h"
 
 #include <queue>
+#include <algorithm>
+#include <iterator>
 
 /********************************************************\
 |* 			Implementation of class Taxonomy			*|
@@ -53,6 +55,18 @@ bool DLConceptTaxonomy :: testSub ( const TConcept* p, const TConcept* q )
 	if ( LLM.isWritable(llTaxTrying) )
 		LL << "\nTAX: trying '" << p->getName() << "' [= '" << q->getName() << "'... ";
 
+	// both concepts are from the shared schema: its classification holds in a consistent KB
+	bool result;
+	const TSchemaTaxonomy* schema = tBox.getSchemaTaxonomy();
+	if ( schema != NULL && !p->isSingleton() && !q->isSingleton() && schema->isSubsumedBy ( p, q, result ) )
+	{
+		if ( LLM.isWritable(llTaxTrying) )
+			LL << ( result ? "holds" : "NOT holds" ) << " (schema result)";
+
+		++nSchemaResults;
+		return result;
+	}
+
 	if ( tBox.testSortedNonSubsumption ( p, q ) )
 	{
 		if ( LLM.isWritable(llTaxTrying) )
@@ -141,6 +155,8 @@ void DLConceptTaxonomy :: print ( std::ostream& o ) const
 		o << "Sorted reasoning deals with " << nSortedNegative << " non-subsumptions\n";
 	if ( nModuleNegative )
 		o << "Modular reasoning deals with " << nModuleNegative << " non-subsumptions\n";
+	if ( nSchemaResults )
+		o << "Shared schema classification answers " << nSchemaResults << " subsumption tests\n";
 	o << "There were made " << nSearchCalls << " search calls\nThere were made " << nSubCalls
 	  << " Sub calls, of which " << nNonTrivialSubCalls << " non-trivial\n";
 	o << "Current efficiency (wrt Brute-force) is " << nEntries*(nEntries-1)/n << "\n";
@@ -284,11 +300,11 @@ DLConceptTaxonomy :: classifySynonym ( void )
 		if ( unlikely(tBox.isBlockedInd(curI)) )
 		{	// check whether current entry is the same as another individual
 			TIndividual* syn = tBox.getBlockingInd(curI);
-			fpp_assert ( syn->getTaxVertex() != NULL );
+			fpp_assert ( syn->isClassified() );
 
  			if ( tBox.isBlockingDet(curI) )
 			{	// deterministic merge => curI = syn
- 				pTax->addCurrentToSynonym(syn->getTaxVertex());
+ 				pTax->addCurrentToSynonymOf(syn);
 				return true;
 			}
 			else	// non-det merge: check whether it is the same
@@ -297,7 +313,7 @@ DLConceptTaxonomy :: classifySynonym ( void )
 					LL << "\nTAX: trying '" << curI->getName() << "' = '" << syn->getName() << "'... ";
 				if ( testSubTBox ( curI, syn ) )	// they are actually the same
 				{
-					pTax->addCurrentToSynonym(syn->getTaxVertex());
+					pTax->addCurrentToSynonymOf(syn);
 					return true;
 				}
 			}
@@ -506,6 +522,69 @@ DLConceptTaxonomy :: reclassify ( TaxonomyVertex* node, const TSignature* s )
 	pTax->setCurrent(oldCur);
 }
 
+/// actor to gather the individuals from the instance buckets
+class InstanceCollector
+{
+public:		// types
+		/// type for the found entries
+	typedef std::vector<const ClassifiableEntry*> EntryVec;
+
+protected:	// members
+		/// found instances
+	EntryVec& Found;
+
+public:		// interface
+		/// init c'tor
+	InstanceCollector ( EntryVec& found ) : Found(found) {}
+		/// vertices of the graph are not interesting
+	bool apply ( const TaxonomyVertex& v ATTR_UNUSED ) { return false; }
+		/// remember an ENTRY from the instance buckets (its synonyms go together with it)
+	bool apply ( const ClassifiableEntry* entry, TaxonomyVertex::syn_iterator begin ATTR_UNUSED, TaxonomyVertex::syn_iterator end ATTR_UNUSED )
+	{
+		Found.push_back(entry);
+		return true;
+	}
+}; // InstanceCollector
+
+void
+DLConceptTaxonomy :: realiseCurrent ( const TConcept* query )
+{
+	typedef InstanceCollector::EntryVec EntryVec;
+	TaxonomyVertex* cur = pTax->getCurrent();
+	EntryVec Candidates, Found;
+	InstanceCollector actor(Found);
+	TaxonomyVertex::iterator p, p_end;
+
+	// the candidates are the common instances of all the parents
+	for ( p = cur->begin(/*upDirection=*/true), p_end = cur->end(/*upDirection=*/true); p != p_end; ++p )
+	{
+		Found.clear();
+		pTax->getInstancesInfo</*onlyDirect=*/false> ( *p, actor );
+		std::sort ( Found.begin(), Found.end() );
+		if ( p == cur->begin(/*upDirection=*/true) )
+			Candidates.swap(Found);
+		else
+		{
+			EntryVec Common;
+			std::set_intersection ( Candidates.begin(), Candidates.end(), Found.begin(), Found.end(), std::back_inserter(Common) );
+			Candidates.swap(Common);
+		}
+	}
+
+	// the instances of the children are the instances of the query, but not the direct ones
+	Found.clear();
+	for ( p = cur->begin(/*upDirection=*/false), p_end = cur->end(/*upDirection=*/false); p != p_end; ++p )
+		pTax->getInstancesInfo</*onlyDirect=*/false> ( *p, actor );
+	std::sort ( Found.begin(), Found.end() );
+	EntryVec Direct;
+	std::set_difference ( Candidates.begin(), Candidates.end(), Found.begin(), Found.end(), std::back_inserter(Direct) );
+
+	upDirection = true;	// the query is not in the module signatures
+	for ( EntryVec::const_iterator q = Direct.begin(), q_end = Direct.end(); q != q_end; ++q )
+		if ( testSub ( static_cast<const TConcept*>(*q), query ) )
+			pTax->addCurrentInstance(*q);
+}
+
 /********************************************************\
 |* 			Implementation of class TBox				*|
 \********************************************************/
@@ -549,8 +628,16 @@ void TBox :: createTaxonomy ( bool needIndividual )
 
 //	if ( needConcept )
 		nItems += fillArrays ( c_begin(), c_end() );
-//	if ( needIndividual || nNominalReferences > 0 )	// TODO ORE
-		nItems += fillArrays ( i_begin(), i_end() );
+	// nominals are classified as usual concepts; the rest of the individuals are put into
+	// the instance buckets after all the concepts (unless they would be realised in bulk)
+	ConceptVector Nominals, Instances;
+	for ( i_iterator p = i_begin(), p_end = i_end(); p != p_end; ++p )
+		if ( (*p)->isNominal() )
+			Nominals.push_back(*p);
+		else if ( ( needIndividual || !deferIndividuals ) && !(*p)->isNonClassifiable() )
+			Instances.push_back(*p);
+	nItems += fillArrays ( Nominals.begin(), Nominals.end() );
+	nItems += Instances.size();
 
 	// taxonomy progress
 	if ( pMonitor )
@@ -568,6 +655,17 @@ void TBox :: createTaxonomy ( bool needIndividual )
 //	sort ( arrayNP.begin(), arrayNP.end(), TSDepthCompare() );
 	classifyConcepts ( arrayNP, false, "non-primitive" );
 
+	// the concept graph is complete here, so the instances don't need the bottom-up search
+	arrayCD.clear();
+	arrayNoCD.clear();
+	arrayNP.clear();
+	fillArrays ( Instances.begin(), Instances.end() );
+	pTaxCreator->setInstanceMode(true);
+	classifyConcepts ( arrayCD, true, "completely defined individual" );
+	classifyConcepts ( arrayNoCD, false, "regular individual" );
+	classifyConcepts ( arrayNP, false, "non-primitive individual" );
+	pTaxCreator->setInstanceMode(false);
+
 	duringClassification = false;
 
 	pTaxCreator->processSplits();
@@ -596,6 +694,43 @@ void TBox :: createTaxonomy ( bool needIndividual )
 	}
 }
 
+void
+TBox :: setRealised ( void )
+{
+	Status = kbRealised;
+
+	if ( verboseOutput )
+	{
+		std::ofstream of("Taxonomy.log");
+		pTaxCreator->print(of);
+	}
+}
+
+void
+TBox :: performPartialClassification ( const ConceptVector& collection )
+{
+	// the query concept could be in the DAG; delete it as in the full classification
+	clearQueryConcept();
+
+	if ( pTax == NULL )	// 1st run
+		initTaxonomy();
+
+	DLHeap.setSubOrder();	// init priorities in order to do subsumption tests
+	pTaxCreator->setBottomUp(GCIs);
+
+	arrayCD.clear();
+	arrayNoCD.clear();
+	arrayNP.clear();
+	fillArrays ( collection.begin(), collection.end() );
+
+	// the taxonomy is not finalised: the rest of the concepts will be added there later
+	duringClassification = true;
+	classifyConcepts ( arrayCD, true, "completely defined" );
+	classifyConcepts ( arrayNoCD, false, "regular" );
+	classifyConcepts ( arrayNP, false, "non-primitive" );
+	duringClassification = false;
+}
+
 void
 TBox :: classifyConcepts ( const ConceptVector& collection, bool curCompletelyDefined, const char* type )
 {
@@ -95,6 +95,8 @@ protected:	// members
 	unsigned long nSortedNegative;
 		/// number of non-subsumptions because of module reasons
 	unsigned long nModuleNegative;
+		/// number of subsumption tests answered by the schema classification
+	unsigned long nSchemaResults;
 
 		/// indicator of taxonomy creation progress
 	TProgressMonitor* pTaxProgress;
@@ -105,6 +107,8 @@ protected:	// members
 	bool flagNeedBottomUp;
 		/// flag shows that subsumption check could be simplified
 	bool inSplitCheck;
+		/// flag shows that the individuals are put into the instance buckets rather than into the graph
+	bool instanceMode;
 
 private:	// no copy
 		/// no copy c'tor
@@ -119,6 +123,8 @@ protected:	// methods
 
 		/// get access to curEntry as a TConcept
 	const TConcept* curConcept ( void ) const { return static_cast<const TConcept*>(curEntry); }
+		/// @return true iff curEntry is an individual that goes to the instance buckets
+	bool isInstanceEntry ( void ) const { return instanceMode && curConcept()->isSingleton(); }
 		/// tests subsumption (via tBox) and gather statistics.  Use cache and other optimisations.
 	bool testSub ( const TConcept* p, const TConcept* q );
 		/// test subsumption via TBox explicitely
@@ -220,6 +226,9 @@ protected:	// methods
 		/// check if it is possible to skip BU phase
 	virtual bool needBottomUp ( void ) const
 	{
+		// all the concepts and nominals are classified before the instances, so nothing could be below them
+		if ( isInstanceEntry() )
+			return false;
 		// we DON'T need bottom-up phase for primitive concepts during CD-like reasoning
 		// if no GCIs are in the TBox (C [= T, T [= X or Y, X [= D, Y [= D) or (T [= {o})
 		// or no reflexive roles w/RnD precent (Refl(R), Range(R)=D)
@@ -246,6 +255,14 @@ protected:	// methods
 		++nConcepts;
 		if ( pTaxProgress != NULL )
 			pTaxProgress->nextClass();
+	}
+		/// instances are kept in the buckets of their parents rather than in the graph
+	virtual void insertCurrentEntry ( void )
+	{
+		if ( isInstanceEntry() )
+			pTax->finishCurrentInstance();
+		else
+			pTax->finishCurrentNode();
 	}
 		/// @return true iff curEntry is classified as a synonym
 	virtual bool classifySynonym ( void );
@@ -258,6 +275,7 @@ protected:	// methods
 		if ( likely ( cur != v ) )
 		{
 			cur->mergeIndepNode ( v, excludes, curEntry );
+			pTax->moveInstances ( v, cur );
 			pTax->removeNode(v);
 		}
 	}
@@ -280,8 +298,10 @@ public:		// interface
 		, nCachedNegative(0)
 		, nSortedNegative(0)
 		, nModuleNegative(0)
+		, nSchemaResults(0)
 		, pTaxProgress (NULL)
 		, inSplitCheck(false)
+		, instanceMode(false)
 	{
 	}
 		/// d'tor
@@ -293,6 +313,10 @@ public:		// interface
 		for ( TSplitVars::iterator p = tBox.Splits->begin(), p_end = tBox.Splits->end(); p != p_end; ++p )
 			mergeSplitVars(*p);
 	}
+		/// set the instance mode: if set, individuals are put into the instance buckets of their types
+	void setInstanceMode ( bool value ) { instanceMode = value; }
+		/// fill the instance bucket of the current (query) vertex with the direct instances of QUERY
+	void realiseCurrent ( const TConcept* query );
 		/// set bottom-up flag
 	void setBottomUp ( const TKBFlags& GCIs ) { flagNeedBottomUp = (GCIs.isGCI() || (GCIs.isReflexive() && GCIs.isRnD())); }
 		/// reclassify taxonomy wrt changed sets
@@ -352,6 +376,12 @@ TBox :: classifyEntry ( TConcept* entry )
 		pTaxCreator->classifyEntry(entry);
 }
 
+inline void
+TBox :: realiseQueryConcept ( void )
+{
+	pTaxCreator->realiseCurrent(pQuery);
+}
+
 inline void
 TBox :: reclassify ( const std::set<const TNamedEntity*>& MPlus, const std::set<const TNamedEntity*>& MMinus )
 {
@@ -78,6 +78,8 @@ protected:	// methods
 public:		// interface
 		/// init c'tor
 	GeneralSyntacticLocalityChecker ( const TSignature* s ) : LocalityChecker(s) {}
+		/// init c'tor for the bitset signatures
+	GeneralSyntacticLocalityChecker ( const TDenseSignature* s ) : LocalityChecker(s) {}
 		/// empty d'tor
 	virtual ~GeneralSyntacticLocalityChecker ( void ) {}
 
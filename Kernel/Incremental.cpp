@@ -18,58 +18,226 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
 // incremental reasoning implementation
 
+#include <pthread.h>
+
 #include "Kernel.h"
 #include "OntologyBasedModularizer.h"
+#include "AtomicDecomposer.h"
 #include "Actor.h"
 #include "tOntologyPrinterLISP.h"
 #include "procTimer.h"
 #include "SaveLoadManager.h"	// for saving/restoring ontology
 
-TsProcTimer moduleTimer, subCheckTimer;
-int nModule = 0;
+TsProcTimer subCheckTimer;
+
+/// @return true iff the AD can be used to speed up the BOT-modules extraction
+bool
+ReasoningKernel :: canUseADInModules ( void ) const
+{
+	// atom modules should be parts of BOT-modules, and the atoms should be built for the current axioms
+	return AD != NULL && ADVersion == Ontology.getVersion() && AD->getModuleType() != M_TOP;
+}
 
 /// setup Name2Sig for a given name C
 void
-ReasoningKernel :: setupSig ( const TNamedEntity* entity, const AxiomVec& Module )
+ReasoningKernel :: setupSig ( const TNamedEntity* entity, const AxiomVec* Module )
 {
 	// do nothing if entity doesn't exist
 	if ( entity == NULL )
 		return;
 
-	moduleTimer.Start();
+	TModuleExtractor* Extractor = getModExtractor(false)->getModuleExtractor();
 	// prepare a place to update
-	TSignature sig;
 	NameSigMap::iterator insert = Name2Sig.find(entity);
 	if ( insert == Name2Sig.end() )
-		insert = Name2Sig.insert(std::make_pair(entity,&sig)).first;
-	else
-		delete insert->second;
+		insert = Name2Sig.insert(std::make_pair(entity,(TSignature*)NULL)).first;
 
 	// calculate a module
+	TSignature sig;
 	sig.add(entity);
-	getModExtractor(false)->getModule(Module,sig,M_BOT);
+	if ( Module == NULL )
+		Extractor->extract ( sig, M_BOT );
+	else
+		Extractor->extract ( *Module, sig, M_BOT );
 	++nModule;
 
 	// perform update
-	insert->second = new TSignature(getModExtractor(false)->getModularizer()->getSignature());
+	TSignature* oldSig = insert->second;
+	insert->second = new TSignature(Extractor->getSignature());
+	addSig2Names ( entity, *insert->second, oldSig );
+	delete oldSig;
+}
 
-	moduleTimer.Stop();
+/// add ENTITY to the reverse index for all the elements of SIG that are not in OLDSIG (if any)
+void
+ReasoningKernel :: addSig2Names ( const TNamedEntity* entity, const TSignature& sig, const TSignature* oldSig )
+{
+	for ( TSignature::iterator p = sig.begin(), p_end = sig.end(); p != p_end; ++p )
+		if ( oldSig == NULL || !oldSig->contains(*p) )
+		{
+			unsigned int id = (*p)->getId();
+			if ( id >= Sig2Names.size() )
+				Sig2Names.resize(id+1);
+			Sig2Names[id].push_back(entity);
+		}
+}
+
+/// add to CANDIDATES all the names whose module signatures might make the axiom AX non-local wrt LC
+void
+ReasoningKernel :: addAffectedNames ( TDLAxiom* ax, LocalityChecker* lc, std::set<const TNamedEntity*>& Candidates )
+{
+	// the axiom non-local wrt the empty signature is non-local wrt all of them
+	lc->setSignatureValue(TSignature());
+	if ( !lc->local(ax) )
+	{
+		for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+			Candidates.insert(p->first);
+		return;
+	}
+
+	// otherwise the module signature should contain some entity of the axiom
+	const TSignature& sig = ax->getSignature();
+	for ( TSignature::iterator e = sig.begin(), e_end = sig.end(); e != e_end; ++e )
+	{
+		if ( (*e)->getId() >= Sig2Names.size() )
+			continue;
+		// drop the stale entries (that were removed from the signature or from Name2Sig) on the way
+		std::vector<const TNamedEntity*>& Names = Sig2Names[(*e)->getId()];
+		size_t n = 0;
+		for ( size_t i = 0; i < Names.size(); ++i )
+		{
+			NameSigMap::const_iterator found = Name2Sig.find(Names[i]);
+			if ( found != Name2Sig.end() && found->second->contains(*e) )
+			{
+				Candidates.insert(Names[i]);
+				Names[n++] = Names[i];
+			}
+		}
+		Names.resize(n);
+	}
 }
 
 /// build signature for ENTITY and all dependent entities from toProcess; look for modules in Module;
 void
-ReasoningKernel :: buildSignature ( const TNamedEntity* entity, const AxiomVec& Module, std::set<const TNamedEntity*>& toProcess )
+ReasoningKernel :: buildSignature ( const TNamedEntity* entity, const AxiomVec* Module, std::set<const TNamedEntity*>& toProcess )
 {
 	toProcess.erase(entity);
 	setupSig ( entity, Module );
-	const AxiomVec NewModule = getModExtractor(false)->getModularizer()->getModule();
-	if ( Module.size() == NewModule.size() )	// the same module
+	const TModuleExtractor* Extractor = getModExtractor(false)->getModuleExtractor();
+	const AxiomVec NewModule = Extractor->getModule();
+	size_t size = Module ? Module->size() : getModExtractor(false)->getModuleIndex()->size();
+	if ( size == NewModule.size() )	// the same module
 		return;
 	// smaller module: recurse
-	TSignature ModSig = getModExtractor(false)->getModularizer()->getSignature();
-	for ( TSignature::iterator p = ModSig.begin(), p_end = ModSig.end(); p != p_end; ++p )
-		if ( toProcess.count(*p) > 0 )	// need to process
-			buildSignature ( *p, NewModule, toProcess );
+	const TDenseSignature& Sig = Extractor->getDenseSignature();
+	const std::vector<unsigned int> ModSig ( Sig.begin(), Sig.end() );
+	const TModuleIndex* Index = getModExtractor(false)->getModuleIndex();
+	for ( std::vector<unsigned int>::const_iterator p = ModSig.begin(), p_end = ModSig.end(); p != p_end; ++p )
+		if ( const TNamedEntity* e = Index->getEntity(*p) )
+			if ( toProcess.count(e) > 0 )	// need to process
+				buildSignature ( e, &NewModule, toProcess );
+}
+
+/// part of the parallel module computation: modules of the names First, First+Step, ... of a list
+struct TIncModuleWorker
+{
+		/// index of the ontology
+	const TModuleIndex* Index;
+		/// names to build the modules for
+	const std::vector<const TNamedEntity*>* Names;
+		/// positions of the names in Names by their entity IDs (Names.size() if not there)
+	const std::vector<size_t>* PosOf;
+		/// module signatures of the names by their positions; a worker fills only its own ones
+	std::vector<TSignature*>* Sigs;
+		/// first name to process
+	size_t First;
+		/// step between the names to process
+	size_t Step;
+		/// whether the atoms of the AD are used in the extraction
+	bool useAtoms;
+		/// number of the modules built
+	unsigned long nModules;
+};
+
+/// build the module of the name at POS within MODULE (the whole index if NULL) with EXTRACTOR;
+/// recurse into the names of the worker W that are in the module signature
+static void
+buildWorkerSignature ( TIncModuleWorker* w, TModuleExtractor& Extractor, size_t pos, const AxiomVec* Module )
+{
+	TSignature sig;
+	sig.add((*w->Names)[pos]);
+	if ( Module == NULL )
+		Extractor.extract ( sig, M_BOT );
+	else
+		Extractor.extract ( *Module, sig, M_BOT );
+	++w->nModules;
+	(*w->Sigs)[pos] = new TSignature(Extractor.getSignature());
+	size_t size = Module ? Module->size() : w->Index->size();
+	if ( size == Extractor.getModule().size() )	// the same module
+		return;
+	// smaller module: nested modules of the names of this worker are built within it
+	const AxiomVec NewModule = Extractor.getModule();
+	const TDenseSignature& Sig = Extractor.getDenseSignature();
+	const std::vector<unsigned int> ModSig ( Sig.begin(), Sig.end() );
+	for ( std::vector<unsigned int>::const_iterator p = ModSig.begin(), p_end = ModSig.end(); p != p_end; ++p )
+	{
+		size_t q = *p < w->PosOf->size() ? (*w->PosOf)[*p] : w->Names->size();
+		if ( q < w->Names->size() && q % w->Step == w->First && (*w->Sigs)[q] == NULL )
+			buildWorkerSignature ( w, Extractor, q, &NewModule );
+	}
+}
+
+/// build all the module signatures of the TIncModuleWorker ARG; run in a separate thread
+static void*
+buildNameModules ( void* arg )
+{
+	TIncModuleWorker* w = static_cast<TIncModuleWorker*>(arg);
+	TModuleExtractor Extractor(*w->Index);
+	Extractor.setUseAtoms(w->useAtoms);
+	for ( size_t i = w->First; i < w->Names->size(); i += w->Step )
+		if ( (*w->Sigs)[i] == NULL )
+			buildWorkerSignature ( w, Extractor, i, NULL );
+	return NULL;
+}
+
+/// build signatures of the modules of all NAMES with NTHREADS independent extractors; USEATOMS allows them to use the AD
+void
+ReasoningKernel :: buildSignaturesParallel ( const std::vector<const TNamedEntity*>& Names, unsigned int nThreads, bool useAtoms )
+{
+	// the index is shared by the workers and is not changed by them
+	const TModuleIndex* Index = getModExtractor(false)->getModuleIndex();
+	std::vector<size_t> PosOf ( Index->maxEntityId(), Names.size() );
+	for ( size_t i = 0; i < Names.size(); ++i )
+		if ( Names[i]->getId() < PosOf.size() )
+			PosOf[Names[i]->getId()] = i;
+
+	// the main thread does the work of the worker 0
+	std::vector<TSignature*> Sigs ( Names.size(), NULL );
+	std::vector<TIncModuleWorker> Workers(nThreads);
+	std::vector<pthread_t> Threads(nThreads);
+	for ( unsigned int t = 0; t < nThreads; ++t )
+	{
+		TIncModuleWorker w = { Index, &Names, &PosOf, &Sigs, t, nThreads, useAtoms, 0 };
+		Workers[t] = w;
+	}
+	unsigned int nStarted = 1;
+	while ( nStarted < nThreads && pthread_create ( &Threads[nStarted], NULL, buildNameModules, &Workers[nStarted] ) == 0 )
+		++nStarted;
+	// the work of the threads that failed to start is done here as well
+	buildNameModules(&Workers[0]);
+	for ( unsigned int t = nStarted; t < nThreads; ++t )
+		buildNameModules(&Workers[t]);
+	for ( unsigned int t = 1; t < nStarted; ++t )
+		pthread_join ( Threads[t], NULL );
+
+	// fill the maps in the order of the names, so the result does not depend on the threads
+	for ( unsigned int t = 0; t < nThreads; ++t )
+		nModule += Workers[t].nModules;
+	for ( size_t i = 0; i < Names.size(); ++i )
+	{
+		Name2Sig[Names[i]] = Sigs[i];
+		addSig2Names ( Names[i], *Sigs[i], NULL );
+	}
 }
 
 /// initialise the incremental bits on full reload
@@ -79,20 +247,51 @@ ReasoningKernel :: initIncremental ( void )
 	delete ModSyn;
 	ModSyn = NULL;
 	// fill the module signatures of the concepts
+	for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+		delete p->second;
 	Name2Sig.clear();
-	// found all entities
-	std::set<const TNamedEntity*> toProcess;
-	for ( TBox::c_const_iterator p = getTBox()->c_begin(), p_end = getTBox()->c_end(); p != p_end; ++p )
-		toProcess.insert((*p)->getEntity());
-	// process all entries recursively
-	while ( !toProcess.empty() )
-		buildSignature ( *toProcess.begin(), Ontology.getAxioms(), toProcess );
+	Sig2Names.clear();
+	nModule = nADModule = 0;
+	moduleIndexTimer.Reset();
+	moduleTimer.Reset();
 
+	// build the dense module index
+	moduleIndexTimer.Start();
+	TModuleExtractor* Extractor = getModExtractor(false)->getModuleExtractor();
+	moduleIndexTimer.Stop();
+
+	moduleTimer.Start();
+	// modules are nested, so the atoms of the AD are parts of the modules
+	bool useAD = canUseADInModules();
+	int nThreads = getOptions()->getInt("incrementalModuleThreads");
+	if ( nThreads > 1 )
+	{
+		// found all entities
+		std::vector<const TNamedEntity*> Names;
+		for ( TBox::c_const_iterator p = getTBox()->c_begin(), p_end = getTBox()->c_end(); p != p_end; ++p )
+			if ( (*p)->getEntity() != NULL )
+				Names.push_back((*p)->getEntity());
+		buildSignaturesParallel ( Names, (unsigned int)nThreads, useAD );
+	}
+	else
+	{
+		Extractor->setUseAtoms(useAD);
+		// found all entities
+		std::set<const TNamedEntity*> toProcess;
+		for ( TBox::c_const_iterator p = getTBox()->c_begin(), p_end = getTBox()->c_end(); p != p_end; ++p )
+			toProcess.insert((*p)->getEntity());
+		// process all entries recursively
+		while ( !toProcess.empty() )
+			buildSignature ( *toProcess.begin(), NULL, toProcess );
+		Extractor->setUseAtoms(false);
+	}
+	if ( useAD )
+		nADModule = nModule;
+	moduleTimer.Stop();
 
 	getTBox()->setNameSigMap(&Name2Sig);
 	// fill in ontology signature
 	OntoSig = Ontology.getSignature();
-	std::cout << "Init modules (" << nModule << ") time: " << moduleTimer << " sec" << std::endl;
 }
 
 void
@@ -124,8 +323,11 @@ ReasoningKernel :: doIncremental ( void )
 		if ( const TConcept* C = dynamic_cast<const TConcept*>((*e)->getEntry()) )
 		{
 			excluded.insert(C);
-			// remove all links
-			C->getTaxVertex()->remove();
+			// remove all links; individuals are in the instance buckets
+			if ( C->getTaxVertex() != NULL )
+				C->getTaxVertex()->remove();
+			else
+				tax->removeInstance(C);
 			// update Name2Sig
 			delete Name2Sig[*e];
 			Name2Sig.erase(*e);
@@ -167,44 +369,63 @@ ReasoningKernel :: doIncremental ( void )
 //		std::cout << "Del:";
 //		(*p)->accept(pr);
 //	}
-	for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+	// only the concepts whose module signatures might make a changed axiom non-local are checked
+	std::set<const TNamedEntity*> PlusCandidates, MinusCandidates;
+	for ( p = nb; p != ne; ++p )
+		addAffectedNames ( *p, lc, PlusCandidates );
+	for ( p = rb; p != re; ++p )
+		addAffectedNames ( *p, lc, MinusCandidates );
+	std::set<const TNamedEntity*> Candidates(PlusCandidates);
+	Candidates.insert ( MinusCandidates.begin(), MinusCandidates.end() );
+	++nIncUpdates;
+	nIncChecked += Candidates.size();
+
+	for ( std::set<const TNamedEntity*>::iterator c = Candidates.begin(), c_end = Candidates.end(); c != c_end; ++c )
 	{
+		NameSigMap::iterator p = Name2Sig.find(*c);
 		lc->setSignatureValue(*p->second);
-		for ( TOntology::iterator notProcessed = nb; notProcessed != ne; ++notProcessed )
-			if ( !lc->local(*notProcessed) )
-			{
-				MPlus.insert(p->first);
-//				std::cout << "Non-local NP axiom ";
-//				(*notProcessed)->accept(pr);
-//				std::cout << " wrt " << p->first->getName() << std::endl;
-				break;
-			}
-		for ( TOntology::iterator retracted = rb; retracted != re; retracted++ )
-			if ( !lc->local(*retracted) )
-			{
-				MMinus.insert(p->first);
-				// FIXME!! only concepts for now
-				TaxonomyVertex* v = dynamic_cast<const ClassifiableEntry*>(p->first->getEntry())->getTaxVertex();
-				if ( v->noNeighbours(true) )
+		if ( PlusCandidates.count(*c) > 0 )
+			for ( TOntology::iterator notProcessed = nb; notProcessed != ne; ++notProcessed )
+				if ( !lc->local(*notProcessed) )
 				{
-					v->addNeighbour(true,tax->getTopVertex());
-					tax->getTopVertex()->addNeighbour(false,v);
+					MPlus.insert(p->first);
+//					std::cout << "Non-local NP axiom ";
+//					(*notProcessed)->accept(pr);
+//					std::cout << " wrt " << p->first->getName() << std::endl;
+					break;
+				}
+		if ( MinusCandidates.count(*c) > 0 )
+			for ( TOntology::iterator retracted = rb; retracted != re; retracted++ )
+				if ( !lc->local(*retracted) )
+				{
+					MMinus.insert(p->first);
+					// FIXME!! only concepts for now
+					TaxonomyVertex* v = dynamic_cast<const ClassifiableEntry*>(p->first->getEntry())->getTaxVertex();
+					if ( v->noNeighbours(true) )
+					{
+						v->addNeighbour(true,tax->getTopVertex());
+						tax->getTopVertex()->addNeighbour(false,v);
+					}
+//					std::cout << "Non-local RT axiom ";
+//					(*retracted)->accept(pr);
+//					std::cout << " wrt " << p->first->getName() << std::endl;
+					break;
 				}
-//				std::cout << "Non-local RT axiom ";
-//				(*retracted)->accept(pr);
-//				std::cout << " wrt " << p->first->getName() << std::endl;
-				break;
-			}
 	}
+	nIncPlus += MPlus.size();
+	nIncMinus += MMinus.size();
 	t.Stop();
-	std::cout << "Determine concepts that need reclassification: done in " << t << std::endl;
+	std::cout << "Determine concepts that need reclassification: " << Candidates.size() << " of " << Name2Sig.size()
+			  << " checked, done in " << t << std::endl;
 
 	// build changed modules
 	std::set<const TNamedEntity*> toProcess(MPlus);
 	toProcess.insert ( MMinus.begin(), MMinus.end() );
 	// process all entries recursively
+	moduleTimer.Start();
 	while ( !toProcess.empty() )
-		buildSignature ( *toProcess.begin(), Ontology.getAxioms(), toProcess );
+		buildSignature ( *toProcess.begin(), NULL, toProcess );
+	moduleTimer.Stop();
 
 	tax->finalise();
 //	std::cout << "Adjusted Taxonomy:";
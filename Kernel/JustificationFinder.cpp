@@ -0,0 +1,475 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <deque>
+#include <algorithm>
+
+#include <sstream>
+
+#include "JustificationFinder.h"
+#include "Kernel.h"
+#include "eFPPTimeout.h"
+#include "tSignatureUpdater.h"
+
+/// @return true iff the sorted sets A and B have no common element
+static bool
+disjoint ( const std::vector<unsigned int>& A, const std::vector<unsigned int>& B )
+{
+	std::vector<unsigned int>::const_iterator p = A.begin(), p_end = A.end(), q = B.begin(), q_end = B.end();
+	while ( p != p_end && q != q_end )
+		if ( *p < *q )
+			++p;
+		else if ( *q < *p )
+			++q;
+		else
+			return false;
+	return true;
+}
+
+/// @return the sorted union of the sorted sets A and B
+static std::vector<unsigned int>
+merge ( const std::vector<unsigned int>& A, const std::vector<unsigned int>& B )
+{
+	std::vector<unsigned int> ret;
+	ret.reserve(A.size()+B.size());
+	std::set_union ( A.begin(), A.end(), B.begin(), B.end(), std::back_inserter(ret) );
+	return ret;
+}
+
+/// rewriter of the concept-level axioms X [= Y into X [= Y or G for a guard concept G. The guard
+/// is a positive disjunct, so it is never chosen by the concept absorption of the rewritten axiom.
+/// A definition A = C is rewritten as A = (C and not G) or (G and F) for a fresh concept F, so it
+/// is still unfolded lazily
+class TGuardedAxiomBuilder: public DLAxiomVisitorEmpty
+{
+protected:	// members
+		/// expression manager to build the new expressions
+	TExpressionManager* pEM;
+		/// number of the current axiom
+	unsigned int n;
+		/// the guard
+	const TDLConceptExpression* Guard;
+		/// the rewritten axioms
+	AxiomVec& Result;
+		/// true iff the last visited axiom was rewritten
+	bool Guarded;
+
+protected:	// methods
+		/// add the axiom X [= Y or G
+	void add ( const TDLConceptExpression* X, const TDLConceptExpression* Y )
+	{
+		Result.push_back(new TDLAxiomConceptInclusion(X,pEM->Or(Y,Guard)));
+		Guarded = true;
+	}
+		/// @return fresh concept with a kind KIND for the current axiom
+	const TDLConceptExpression* fresh ( const char* kind )
+	{
+		std::stringstream name;
+		name << "*" << kind << n << "*";
+		return pEM->Concept(name.str());
+	}
+		/// add the axioms Xi [= not (Xi+1 or ... or Xn) or G for the pairwise disjoint [BEG,END)
+	template<class Iterator>
+	void addDisjoint ( Iterator beg, Iterator end )
+	{
+		for ( Iterator p = beg; p != end; ++p )
+		{
+			if ( p+1 == end )
+				break;
+			pEM->newArgList();
+			for ( Iterator q = p+1; q != end; ++q )
+				pEM->addArg(*q);
+			add ( *p, pEM->Not(pEM->Or()) );
+		}
+	}
+
+public:		// interface
+		/// init c'tor
+	TGuardedAxiomBuilder ( TExpressionManager* em, AxiomVec& result ) : pEM(em), n(0), Guard(NULL), Result(result), Guarded(false) {}
+		/// empty d'tor
+	virtual ~TGuardedAxiomBuilder ( void ) {}
+
+		/// rewrite AXIOM number N with a new guard; @return true iff the axiom has a guarded form
+	bool build ( const TDLAxiom* axiom, unsigned int N )
+	{
+		n = N;
+		Guard = fresh("GUARD");
+		Guarded = false;
+		axiom->accept(*this);
+		return Guarded;
+	}
+		/// @return the guard of the last rewritten axiom
+	const TDLConceptExpression* getGuard ( void ) const { return Guard; }
+
+public:		// visitor interface
+	virtual void visit ( const TDLAxiomEquivalentConcepts& axiom )
+	{
+		if ( axiom.size() == 2 )
+		{
+			const TDLConceptExpression* A = *axiom.begin();
+			const TDLConceptExpression* C = *(axiom.begin()+1);
+			if ( dynamic_cast<const TDLConceptName*>(A) == NULL )
+				std::swap ( A, C );
+			if ( dynamic_cast<const TDLConceptName*>(A) != NULL )
+			{
+				const TDLConceptExpression* Def = pEM->Or ( pEM->And(C,pEM->Not(Guard)), pEM->And(Guard,fresh("FREE")) );
+				pEM->newArgList();
+				pEM->addArg(A);
+				pEM->addArg(Def);
+				Result.push_back(new TDLAxiomEquivalentConcepts(pEM->getArgList()));
+				Guarded = true;
+				return;
+			}
+		}
+		// C1 [= C2 [= ... [= Cn [= C1
+		for ( TDLAxiomEquivalentConcepts::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+			add ( *p, p+1 == p_end ? *axiom.begin() : *(p+1) );
+		Guarded = true;
+	}
+	virtual void visit ( const TDLAxiomDisjointConcepts& axiom ) { addDisjoint ( axiom.begin(), axiom.end() ); Guarded = true; }
+	virtual void visit ( const TDLAxiomDisjointUnion& axiom )
+	{
+		// C = D1 or ... or Dn, where Di are pairwise disjoint
+		for ( TDLAxiomDisjointUnion::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+			add ( *p, axiom.getC() );
+		pEM->newArgList();
+		for ( TDLAxiomDisjointUnion::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+			pEM->addArg(*p);
+		add ( axiom.getC(), pEM->Or() );
+		addDisjoint ( axiom.begin(), axiom.end() );
+	}
+	virtual void visit ( const TDLAxiomORoleDomain& axiom ) { add ( pEM->Exists(axiom.getRole(),pEM->Top()), axiom.getDomain() ); }
+	virtual void visit ( const TDLAxiomDRoleDomain& axiom ) { add ( pEM->Exists(axiom.getRole(),pEM->DataTop()), axiom.getDomain() ); }
+	virtual void visit ( const TDLAxiomORoleRange& axiom ) { add ( pEM->Top(), pEM->Forall(axiom.getRole(),axiom.getRange()) ); }
+	virtual void visit ( const TDLAxiomDRoleRange& axiom ) { add ( pEM->Top(), pEM->Forall(axiom.getRole(),axiom.getRange()) ); }
+	virtual void visit ( const TDLAxiomConceptInclusion& axiom ) { add ( axiom.getSubC(), axiom.getSupC() ); }
+	virtual void visitOntology ( TOntology& ontology ATTR_UNUSED ) {}
+}; // TGuardedAxiomBuilder
+
+JustificationFinder :: JustificationFinder ( const AxiomVec& module, unsigned long timeout )
+	: Kernel(new ReasoningKernel())
+	, pEM(Kernel->getExpressionManager())
+	, Module(module)
+	, isLoaded(false)
+	, C(NULL)
+	, D(NULL)
+	, TestTimeout(timeout)
+	, TimeLimit(0)
+	, MaxCount(0)
+	, Stopped(false)
+	, nTests(0)
+	, nLoads(0)
+	, nReused(0)
+	, nPruned(0)
+{
+	// the entities of the axioms are shared with the main kernel
+	Kernel->setBindEntities(false);
+	buildGuards();
+}
+
+JustificationFinder :: ~JustificationFinder ( void )
+{
+	// the unguarded axioms belong to the main ontology
+	Kernel->getOntology().safeClear();
+	delete Kernel;
+	for ( AxiomVec::iterator p = GuardedAxioms.begin(), p_end = GuardedAxioms.end(); p != p_end; ++p )
+		delete *p;
+	for ( AxiomVec::iterator p = QueryDeclarations.begin(), p_end = QueryDeclarations.end(); p != p_end; ++p )
+		delete *p;
+}
+
+void
+JustificationFinder :: setTopBottomRoleNames ( const char* topORoleName, const char* botORoleName, const char* topDRoleName, const char* botDRoleName )
+{
+	Kernel->setTopBottomRoleNames ( topORoleName, botORoleName, topDRoleName, botDRoleName );
+}
+
+void
+JustificationFinder :: buildGuards ( void )
+{
+	TGuardedAxiomBuilder Builder ( pEM, GuardedAxioms );
+	AxiomVec All, Rest;
+	All.swap(Module);
+	for ( AxiomVec::const_iterator p = All.begin(), p_end = All.end(); p != p_end; ++p )
+	{
+		// declarations do not change the entailments, so they are always loaded
+		if ( dynamic_cast<const TDLAxiomDeclaration*>(*p) != NULL )
+		{
+			Module.push_back(*p);
+			Guards.push_back(pEM->Top());
+			Declarations.push_back(*p);
+			continue;
+		}
+		if ( Builder.build ( *p, Module.size() ) )
+		{
+			Module.push_back(*p);
+			Guards.push_back(pEM->Not(Builder.getGuard()));
+		}
+		else
+			Rest.push_back(*p);
+	}
+	// the unguarded axioms are at the end, so the minimisation changes them less often
+	Module.insert ( Module.end(), Rest.begin(), Rest.end() );
+	Guards.resize ( Module.size(), NULL );
+}
+
+void
+JustificationFinder :: loadUnguarded ( const AxiomSet& S )
+{
+	AxiomSet Unguarded;
+	for ( AxiomSet::const_iterator p = S.begin(), p_end = S.end(); p != p_end; ++p )
+		if ( Guards[*p] == NULL )
+			Unguarded.push_back(*p);
+	if ( isLoaded && Unguarded == Loaded )
+		return;
+
+	AxiomVec Axioms ( GuardedAxioms );
+	Axioms.insert ( Axioms.end(), Declarations.begin(), Declarations.end() );
+	Axioms.insert ( Axioms.end(), QueryDeclarations.begin(), QueryDeclarations.end() );
+	for ( AxiomSet::const_iterator p = Unguarded.begin(), p_end = Unguarded.end(); p != p_end; ++p )
+		Axioms.push_back(Module[*p]);
+	Kernel->getOntology().setShared(Axioms);
+	Loaded.swap(Unguarded);
+	isLoaded = true;
+	++nLoads;
+}
+
+void
+JustificationFinder :: declareQuery ( void )
+{
+	for ( AxiomVec::iterator p = QueryDeclarations.begin(), p_end = QueryDeclarations.end(); p != p_end; ++p )
+		delete *p;
+	QueryDeclarations.clear();
+
+	TSignature Sig;
+	TExpressionSignatureUpdater Updater(Sig);
+	C->accept(Updater);
+	if ( D != NULL )
+		D->accept(Updater);
+	for ( TSignature::iterator p = Sig.begin(), p_end = Sig.end(); p != p_end; ++p )
+		QueryDeclarations.push_back(new TDLAxiomDeclaration(dynamic_cast<const TDLExpression*>(*p)));
+	// the kernel should be reloaded with the new declarations
+	isLoaded = false;
+}
+
+bool
+JustificationFinder :: outOfLimits ( void )
+{
+	if ( !Stopped && TimeLimit > 0 && (unsigned long)(Timer*1000) >= TimeLimit )
+		Stopped = true;
+	return Stopped;
+}
+
+bool
+JustificationFinder :: entailed ( const AxiomSet& S )
+{
+	if ( outOfLimits() )
+		return false;
+	++nTests;
+
+	loadUnguarded(S);
+	// switch on the guarded axioms of S everywhere in the model
+	pEM->newArgList();
+	for ( AxiomSet::const_iterator p = S.begin(), p_end = S.end(); p != p_end; ++p )
+		if ( Guards[*p] != NULL )
+			pEM->addArg(Guards[*p]);
+	const TDLConceptExpression* Q = pEM->And ( C, pEM->Forall ( pEM->ObjectRoleTop(), pEM->And() ) );
+
+	// a single test should not run over the time limit of the search
+	unsigned long timeout = TestTimeout;
+	if ( TimeLimit > 0 )
+	{
+		unsigned long rest = TimeLimit - (unsigned long)(Timer*1000);
+		if ( timeout == 0 || rest < timeout )
+			timeout = rest > 0 ? rest : 1;
+	}
+	Kernel->setOperationTimeout(timeout);
+
+	try
+	{
+		return D == NULL ? !Kernel->isSatisfiable(Q) : Kernel->isSubsumedBy(Q,D);
+	}
+	catch ( const EFPPInconsistentKB& )
+	{
+		// inconsistent set of axioms entails everything
+		return true;
+	}
+	catch ( const EFPPTimeout& )
+	{
+		Stopped = true;
+		return false;
+	}
+}
+
+JustificationFinder::AxiomSet
+JustificationFinder :: complement ( const AxiomSet& Path ) const
+{
+	AxiomSet ret;
+	AxiomSet::const_iterator q = Path.begin(), q_end = Path.end();
+	for ( unsigned int i = 0; i < Module.size(); ++i )
+		if ( q != q_end && *q == i )
+			++q;
+		else
+			ret.push_back(i);
+	return ret;
+}
+
+JustificationFinder::AxiomSet
+JustificationFinder :: minimise ( const AxiomSet& Support, const AxiomSet& Candidates, bool check )
+{
+	// all the candidates are irrelevant if the support entails the query
+	if ( check && entailed(Support) )
+		return AxiomSet();
+	if ( Candidates.size() <= 1 || Stopped )
+		return Candidates;
+
+	AxiomSet::const_iterator mid = Candidates.begin() + Candidates.size()/2;
+	AxiomSet Left ( Candidates.begin(), mid ), Right ( mid, Candidates.end() );
+	// the right part is minimised wrt the whole left one, and the left part -- wrt the minimised right one
+	AxiomSet RightJ = minimise ( merge(Support,Left), Right, /*check=*/true );
+	AxiomSet LeftJ = minimise ( merge(Support,RightJ), Left, !RightJ.empty() );
+	return merge ( LeftJ, RightJ );
+}
+
+JustificationFinder::AxiomSet
+JustificationFinder :: findOne ( const AxiomSet& S )
+{
+	AxiomSet J = minimise ( AxiomSet(), S, /*check=*/false );
+	if ( Stopped )
+		return AxiomSet();
+	return J;
+}
+
+size_t
+JustificationFinder :: findReusable ( const AxiomSet& Path ) const
+{
+	for ( size_t i = 0; i < Found.size(); ++i )
+		if ( disjoint ( Found[i], Path ) )
+			return i;
+	return Found.size();
+}
+
+bool
+JustificationFinder :: isClosed ( const AxiomSet& Path ) const
+{
+	for ( std::vector<AxiomSet>::const_iterator p = Closed.begin(), p_end = Closed.end(); p != p_end; ++p )
+		if ( std::includes ( Path.begin(), Path.end(), p->begin(), p->end() ) )
+			return true;
+	return false;
+}
+
+void
+JustificationFinder :: expandTree ( const AxiomSet& Root )
+{
+	// nodes of the tree: the path and the justification that labels it
+	std::deque<std::pair<AxiomSet, size_t> > Queue;
+	Found.push_back(Root);
+	Queue.push_back(std::make_pair(AxiomSet(),0));
+
+	while ( !Queue.empty() )
+	{
+		AxiomSet Path = Queue.front().first;
+		AxiomSet J = Found[Queue.front().second];
+		Queue.pop_front();
+
+		for ( AxiomSet::const_iterator p = J.begin(), p_end = J.end(); p != p_end; ++p )
+		{
+			if ( outOfLimits() || (MaxCount > 0 && Found.size() >= MaxCount) )
+			{
+				Stopped = true;
+				return;
+			}
+
+			AxiomSet NewPath = merge ( Path, AxiomSet(1,*p) );
+			// the same set of removed axioms gives the same subtree; a superset of a closed path is closed
+			if ( !Visited.insert(NewPath).second || isClosed(NewPath) )
+			{
+				++nPruned;
+				continue;
+			}
+
+			// any known justification that survives the removal labels the new node
+			size_t label = findReusable(NewPath);
+			if ( label < Found.size() )
+				++nReused;
+			else
+			{
+				AxiomSet Rest = complement(NewPath);
+				if ( !entailed(Rest) )
+				{
+					if ( Stopped )
+						return;
+					Closed.push_back(NewPath);
+					continue;
+				}
+				AxiomSet NewJ = findOne(Rest);
+				if ( Stopped )
+					return;
+				Found.push_back(NewJ);
+			}
+			Queue.push_back(std::make_pair(NewPath,label));
+		}
+	}
+}
+
+bool
+JustificationFinder :: find ( const TDLConceptExpression* c, const TDLConceptExpression* d, unsigned int maxCount, unsigned long timeLimit )
+{
+	C = c;
+	D = d;
+	MaxCount = maxCount;
+	TimeLimit = timeLimit;
+	Stopped = false;
+	Found.clear();
+	Closed.clear();
+	Visited.clear();
+	nTests = nLoads = nReused = nPruned = 0;
+	Timer.Reset();
+	Timer.Start();
+	declareQuery();
+
+	AxiomSet All = complement(AxiomSet());
+	// a tautology has the only empty justification
+	if ( entailed(AxiomSet()) )
+	{
+		if ( !Stopped )
+			Found.push_back(AxiomSet());
+	}
+	// no justifications for a non-entailment
+	else if ( !Stopped && entailed(All) )
+	{
+		AxiomSet Root = findOne(All);
+		if ( !Stopped )
+			expandTree(Root);
+	}
+
+	Timer.Stop();
+	return !Stopped;
+}
+
+void
+JustificationFinder :: getJustifications ( JustificationVec& Result ) const
+{
+	Result.clear();
+	for ( std::vector<AxiomSet>::const_iterator p = Found.begin(), p_end = Found.end(); p != p_end; ++p )
+	{
+		Result.push_back(AxiomVec());
+		for ( AxiomSet::const_iterator q = p->begin(), q_end = p->end(); q != q_end; ++q )
+			Result.back().push_back(Module[*q]);
+	}
+}
@@ -0,0 +1,161 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef JUSTIFICATIONFINDER_H
+#define JUSTIFICATIONFINDER_H
+
+#include <vector>
+#include <set>
+#include <ostream>
+
+#include "tDLAxiom.h"
+#include "tDLExpression.h"
+#include "procTimer.h"
+
+class ReasoningKernel;
+class TExpressionManager;
+
+/// search of the justifications (minimal entailing sets of axioms) of C [= D, or of the
+/// unsatisfiability of C if D is NULL. Every justification of the entailment is contained
+/// in the STAR-module of the signature of C and D, so the search works only with the axioms
+/// of that module. The entailment of a subset of the module is checked by a separate kernel
+/// that is loaded once: every concept-level axiom X [= Y of the module is rewritten as X [= Y or G
+/// for a fresh guard concept G, and the axioms of the subset are switched on by adding not G for all
+/// of them to the query under the top role. The axioms that cannot be guarded (role axioms and
+/// assertions) are shared with the main ontology; the kernel is reloaded only when the subset of
+/// them changes, so they are kept at the end of the module. A single
+/// justification is found by the divide-and-conquer minimisation of an entailing set; all the
+/// justifications are found by the hitting set tree with the reuse of the known justifications
+/// and with the pruning of the closed and of the repeated paths.
+class JustificationFinder
+{
+public:		// types
+		/// set of the justifications
+	typedef std::vector<AxiomVec> JustificationVec;
+
+protected:	// types
+		/// set of axioms as sorted positions in the module
+	typedef std::vector<unsigned int> AxiomSet;
+
+protected:	// members
+		/// kernel to check the entailments
+	ReasoningKernel* Kernel;
+		/// expression manager of the kernel
+	TExpressionManager* pEM;
+		/// axioms of the module: the guarded ones first
+	AxiomVec Module;
+		/// concept that switches on every axiom of the module (negated guard); NULL for the unguarded axioms
+	std::vector<const TDLConceptExpression*> Guards;
+		/// guarded axioms that are always loaded to the kernel
+	AxiomVec GuardedAxioms;
+		/// declarations of the module that are always loaded to the kernel
+	AxiomVec Declarations;
+		/// declarations of the entities of the query, so the kernel knows them even if the module does not
+	AxiomVec QueryDeclarations;
+		/// positions of the axioms without guards that are loaded to the kernel
+	AxiomSet Loaded;
+		/// true iff the kernel was loaded
+	bool isLoaded;
+		/// sub-concept of the entailment
+	const TDLConceptExpression* C;
+		/// super-concept of the entailment; NULL for the unsatisfiability of C
+	const TDLConceptExpression* D;
+		/// found justifications as sets of positions
+	std::vector<AxiomSet> Found;
+		/// paths of the hitting set tree that do not entail the query any more
+	std::vector<AxiomSet> Closed;
+		/// all the paths of the hitting set tree that were already expanded
+	std::set<AxiomSet> Visited;
+		/// timer of the search
+	TsProcTimer Timer;
+		/// timeout of a single entailment test in milliseconds; 0 means no timeout
+	unsigned long TestTimeout;
+		/// limit of the search time in milliseconds; 0 means no limit
+	unsigned long TimeLimit;
+		/// maximal number of justifications to find; 0 means no limit
+	unsigned int MaxCount;
+		/// true iff the search was interrupted by the limits or by a timeout
+	bool Stopped;
+		/// number of the entailment tests
+	unsigned long nTests;
+		/// number of the loads of the kernel
+	unsigned long nLoads;
+		/// number of the justifications reused in the tree
+	unsigned long nReused;
+		/// number of the pruned paths of the tree
+	unsigned long nPruned;
+
+private:	// no copy
+		/// no copy c'tor
+	JustificationFinder ( const JustificationFinder& );
+		/// no assignment
+	JustificationFinder& operator = ( const JustificationFinder& );
+
+protected:	// methods
+		/// rewrite the axioms of the module with the guards; put the other axioms to the end of the module
+	void buildGuards ( void );
+		/// make sure the kernel has exactly the axioms without guards of S; reload it if necessary
+	void loadUnguarded ( const AxiomSet& S );
+		/// declare the entities of the query to the kernel
+	void declareQuery ( void );
+		/// @return true iff the search should stop due to the limits; set Stopped accordingly
+	bool outOfLimits ( void );
+		/// @return true iff the axioms of the module at the positions S entail the query
+	bool entailed ( const AxiomSet& S );
+		/// @return positions of all the axioms of the module except the ones in PATH
+	AxiomSet complement ( const AxiomSet& Path ) const;
+		/// @return minimal subset J of CANDIDATES such that SUPPORT+J entails the query,
+		/// provided SUPPORT+CANDIDATES does; CHECK is false iff SUPPORT is known to be non-entailing
+	AxiomSet minimise ( const AxiomSet& Support, const AxiomSet& Candidates, bool check );
+		/// @return a justification within the positions S known to entail the query; empty if stopped
+	AxiomSet findOne ( const AxiomSet& S );
+		/// @return the index of a found justification that does not intersect PATH; Found.size() if none
+	size_t findReusable ( const AxiomSet& Path ) const;
+		/// @return true iff PATH contains a closed path
+	bool isClosed ( const AxiomSet& Path ) const;
+		/// expand the hitting set tree from the justification ROOT
+	void expandTree ( const AxiomSet& Root );
+
+public:		// interface
+		/// init c'tor: search in the MODULE with the single test TIMEOUT
+	JustificationFinder ( const AxiomVec& module, unsigned long timeout );
+		/// d'tor
+	~JustificationFinder ( void );
+
+		/// set the top/bottom role names of the main KB; the top object role is used to switch the axioms on
+	void setTopBottomRoleNames ( const char* topORoleName, const char* botORoleName, const char* topDRoleName, const char* botDRoleName );
+
+		/// find at most MAXCOUNT justifications of C [= D (or of C [= Bottom if D is NULL) in TIMELIMIT ms;
+		/// @return true iff all the justifications were found
+	bool find ( const TDLConceptExpression* c, const TDLConceptExpression* d, unsigned int maxCount, unsigned long timeLimit );
+		/// put the found justifications into RESULT
+	void getJustifications ( JustificationVec& Result ) const;
+
+		/// print the statistics of the last search
+	void PrintStat ( std::ostream& o ) const
+	{
+		o << "Justifications: " << Found.size() << " found in the module of " << Module.size()
+		  << " axioms with " << nTests << " entailment tests and " << nLoads << " load(s) of "
+		  << GuardedAxioms.size() << " guarded axioms; " << nReused << " reused, " << nPruned << " paths pruned";
+		if ( Stopped )
+			o << "; the search was interrupted";
+		o << "\n";
+	}
+}; // JustificationFinder
+
+#endif
@@ -16,6 +16,8 @@ License along with this library; if not, write to the Free Software
 Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <sstream>
+
 #include "Kernel.h"
 #include "tOntologyLoader.h"
 #include "tOntologyPrinterLISP.h"
@@ -24,6 +26,9 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "OntologyBasedModularizer.h"
 #include "eFPPSaveLoad.h"
 #include "SaveLoadManager.h"
+#include "JustificationFinder.h"
+#include "tSignatureUpdater.h"
+#include "Actor.h"
 
 const char* ReasoningKernel :: Version = "1.6.3";
 const char* ReasoningKernel :: SupportedDL = "SROIQ(D)";
@@ -40,23 +45,44 @@ static bool KernelFirstRun = true;
 ReasoningKernel :: ReasoningKernel ( void )
 	: pTBox (NULL)
 	, pET(NULL)
+	, JustificationsComplete(true)
 	, KE(NULL)
 	, AD(NULL)
+	, ADVersion(0)
+	, ADSemantic(false)
 	, ModSyn(NULL)
 	, ModSem(NULL)
+	, ModClassifier(NULL)
+	, pSummary(NULL)
+	, Realiser(NULL)
 	, JNICache(NULL)
 	, pSLManager(NULL)
+	, pModSLManager(NULL)
+	, pSchema(NULL)
 	, pMonitor(NULL)
 	, OpTimeout(0)
 	, verboseOutput(false)
 	, useUndefinedNames(true)
 	, cachedQuery(NULL)
 	, cachedQueryTree(NULL)
+	, nModule(0)
+	, nADModule(0)
+	, nIncUpdates(0)
+	, nIncChecked(0)
+	, nIncPlus(0)
+	, nIncMinus(0)
+	, nLazyModules(0)
+	, nLazyConcepts(0)
 	, reasoningFailed(false)
 	, NeedTracing(false)
 	, useAxiomSplitting(false)
 	, ignoreExprCache(false)
+	, bindEntities(true)
 	, useIncrementalReasoning(false)
+	, useModularClassification(false)
+	, useLazyClassification(false)
+	, useSummaryABox(false)
+	, useBulkRealisation(false)
 	, dumpOntology(false)
 {
 	// Intro
@@ -77,10 +103,13 @@ ReasoningKernel :: ReasoningKernel ( void )
 /// d'tor
 ReasoningKernel :: ~ReasoningKernel ( void )
 {
+	clearContexts();
 	clearTBox();
 	deleteTree(cachedQueryTree);
+	delete pSummary;
 	delete pMonitor;
 	delete pSLManager;
+	delete pModSLManager;
 	for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
 		delete p->second;
 }
@@ -101,6 +130,12 @@ ReasoningKernel :: clearTBox ( void )
 	ModSem = NULL;
 	delete ModSyn;
 	ModSyn = NULL;
+	delete ModClassifier;
+	ModClassifier = NULL;
+	delete Realiser;
+	Realiser = NULL;
+	// cached results refer to the TBox
+	QueryResults.clear();
 	// during preprocessing the TBox names were cached. clear that cache now.
 	getExpressionManager()->clearNameCache();
 }
@@ -117,6 +152,9 @@ ReasoningKernel :: needForceReload ( void ) const
 	// no incremental required -- nothing to do
 	if ( !useIncrementalReasoning )
 		return true;
+	// only a complete taxonomy can be updated incrementally
+	if ( pTBox->getStatus() < kbClassified )
+		return true;
 	return false;
 }
 
@@ -124,9 +162,18 @@ ReasoningKernel :: needForceReload ( void ) const
 void
 ReasoningKernel :: forceReload ( void )
 {
+	// the AD depends only on the axioms, so keep it over the reload of the same (non-split) ontology
+	AtomicDecomposer* keepAD = NULL;
+	if ( AD != NULL && ADVersion == Ontology.getVersion() && !useAxiomSplitting )
+	{
+		keepAD = AD;
+		AD = NULL;
+	}
+
 	// reset TBox
 	clearTBox();
 	newKB();
+	AD = keepAD;
 
 	// Protege (as the only user of non-trivial monitors with reload) does not accept multiple usage of a monitor
 	// so switch it off after the 1st usage
@@ -141,6 +188,7 @@ ReasoningKernel :: forceReload ( void )
 
 	// (re)load ontology
 	TOntologyLoader OntologyLoader(*getTBox());
+	OntologyLoader.setBindEntities(bindEntities);
 	OntologyLoader.visitOntology(Ontology);
 
 	if ( dumpOntology )
@@ -153,6 +201,13 @@ ReasoningKernel :: forceReload ( void )
 	if ( useIncrementalReasoning )
 		initIncremental();
 
+	// the incremental reclassification expects the individuals to be classified with the concepts
+	pTBox->setDeferIndividuals ( useBulkRealisation && !useIncrementalReasoning );
+
+	// use the shared schema classification only if the ontology has the very same schema
+	if ( pSchema != NULL )
+		pTBox->setSchemaTaxonomy ( pSchema->isSchemaOf(getSchemaAxioms()) ? pSchema : NULL );
+
 	// after loading ontology became processed completely
 	Ontology.setProcessed();
 }
@@ -179,12 +234,24 @@ ReasoningKernel :: ClassifyOrLoad ( bool needIndividuals )
 			}
 		}
 	}
+	// the classification of the modules answers the subsumption tests between the names
+	bool modular = useModularClassification && pSchema == NULL && classifyModules();
+
 	// perform the real classification
-	if ( needIndividuals )
+	if ( needIndividuals && useBulkRealisation && !useIncrementalReasoning )
+		realiseInBulk();
+	else if ( needIndividuals )
 		pTBox->performRealisation();
 	else
 		pTBox->performClassification();
 
+	// the subsumers found in the modules are not valid after the ontology changes
+	if ( modular )
+	{
+		pTBox->setSchemaTaxonomy(NULL);
+		ModClassifier->clear();
+	}
+
 	// save the result if necessary
 	if ( pSLManager != NULL )
 		Save();
@@ -208,11 +275,19 @@ ReasoningKernel :: processKB ( KBStatus status )
 		return;
 	}
 
+	// the KB is going to change, so the cached query results become invalid
+	QueryResults.clear();
+	clearQueryCache();
+	cacheLevel = csEmpty;
+
 	// here curStatus < kbRealised, and status >= kbChecked
 	if ( curStatus == kbEmpty || curStatus == kbLoading )
 	{	// load and preprocess KB -- here might be failures
 		reasoningFailed = true;
 
+		// keep the state of the innermost context's start to restore it when the context is closed
+		saveContextState();
+
 		// load the axioms from the ontology to the TBox
 		if ( needForceReload() )
 			forceReload();
@@ -250,16 +325,22 @@ ReasoningKernel :: processKB ( KBStatus status )
 void
 ReasoningKernel :: classifyQuery ( bool named )
 {
-	// make sure KB is classified
-	classifyKB();
+	// make sure KB is classified; a name classified in the lazy mode has all its subsumers in the taxonomy
+	if ( !named || !cachedConcept->isClassified() )
+		classifyKB();
 
 	if ( !named )	// general expression: classify query concept
 		getTBox()->classifyQueryConcept();
 
 	cachedVertex = cachedConcept->getTaxVertex();
 
-	if ( unlikely(cachedVertex == NULL) )	// fresh concept
-		cachedVertex = getCTaxonomy()->getFreshVertex(cachedConcept);
+	if ( unlikely(cachedVertex == NULL) )
+	{
+		if ( cachedConcept->isTaxInstance() )	// individual from the instance buckets
+			cachedVertex = getCTaxonomy()->getInstanceVertex(cachedConcept);
+		else	// fresh concept
+			cachedVertex = getCTaxonomy()->getFreshVertex(cachedConcept);
+	}
 }
 
 void
@@ -320,17 +401,43 @@ ReasoningKernel :: setUpCache ( TConceptExpr* query, cacheStatus level )
 		if ( level <= cacheLevel )
 			return;
 		else
-		{	// concept was defined but not classified yet
-			fpp_assert ( level == csClassified && cacheLevel != csClassified );
+		{	// concept was defined but not classified (or realised) yet
+			fpp_assert ( level >= csClassified && cacheLevel != level );
+			if ( cacheLevel == csClassified )	// already classified
+			{
+				realiseQuery();
+				cacheLevel = level;
+				return;
+			}
 			if ( cacheLevel == csSat )	// already check satisfiability
 			{
 				classifyQuery(isNameOrConst(cachedQuery));
+				saveQueryPosition(query);
+				if ( level == csInstances )
+					realiseQuery();
+				cacheLevel = level;
 				return;
 			}
 		}
 	}
-	else	// change current query
+	else
+	{
+		// check whether the position of a complex query is known already
+		if ( level == csClassified && useQueryResults(query) )
+		{
+			TaxonomyVertex* v = QueryResults.getPosition(query);
+			if ( v != NULL )
+			{	// no query concept is built, so the current query cache can't be used
+				clearQueryCache();
+				cacheLevel = csEmpty;
+				cachedConcept = NULL;
+				cachedVertex = v;
+				return;
+			}
+		}
+		// change current query
 		setQueryCache(query);
+	}
 
 	// clean cached info
 	cachedVertex = NULL;
@@ -347,8 +454,51 @@ ReasoningKernel :: setUpCache ( TConceptExpr* query, cacheStatus level )
 	if ( !isValid(cachedConcept->pName) )
 		getTBox()->preprocessQueryConcept(cachedConcept);
 
-	if ( level == csClassified )
+	if ( level >= csClassified )
+	{
 		classifyQuery(isNameOrConst(cachedQuery));
+		saveQueryPosition(query);
+		if ( level == csInstances )
+			realiseQuery();
+	}
+}
+
+/// classify the concepts of the BOT-module of a named concept C in the lazy mode
+bool
+ReasoningKernel :: classifyModuleOf ( const TConceptExpr* C )
+{
+	// the saved state and the splits are defined only for the whole taxonomy
+	if ( !useLazyClassification || useAxiomSplitting || pSLManager != NULL )
+		return false;
+	const TDLConceptName* name = dynamic_cast<const TDLConceptName*>(C);
+	if ( name == NULL || isKBClassified() )
+		return false;
+
+	preprocessKB();
+	TConcept* concept = getTBox()->getCI(TreeDeleter(e(C)));
+	if ( concept->getTaxVertex() == NULL )
+	{
+		// all the subsumers of C are in the signature of its BOT-module
+		TModuleExtractor* Extractor = getModExtractor(false)->getModuleExtractor();
+		TSignature sig;
+		sig.add(name);
+		Extractor->extract ( sig, M_BOT );
+		TBox::ConceptVector Concepts(1,concept);
+		const TSignature& ModSig = Extractor->getSignature();
+		for ( TSignature::iterator p = ModSig.begin(), p_end = ModSig.end(); p != p_end; ++p )
+			if ( const TDLConceptName* cName = dynamic_cast<const TDLConceptName*>(*p) )
+				Concepts.push_back(getTBox()->getCI(TreeDeleter(e(cName))));
+
+		// the query concept is removed from the DAG, so the query cache is invalid
+		clearQueryCache();
+		cacheLevel = csEmpty;
+		getTBox()->performPartialClassification(Concepts);
+		++nLazyModules;
+		nLazyConcepts += Concepts.size();
+	}
+
+	// all the classes are the subsumers of an unsatisfiable C
+	return concept->getTaxVertex() != NULL && concept->getTaxVertex() != getCTaxonomy()->getBottomVertex();
 }
 
 //-------------------------------------------------
@@ -392,11 +542,20 @@ ReasoningKernel :: checkSub ( TConcept* C, TConcept* D )
 	// check the obvious ones
 	if ( unlikely(D->isTop()) || unlikely(C->isBottom()) )
 		return true;
-	if ( getStatus() < kbClassified )	// unclassified => do via SAT test
+	if ( getStatus() < kbClassified && !C->isClassified() )	// unclassified => do via SAT test
 		return getTBox()->isSubHolds ( C, D );
 	// classified => do the taxonomy traversal
 	SupConceptActor actor(D);
 	Taxonomy* tax = getCTaxonomy();
+	// individuals are kept in the instance buckets of their types
+	if ( C->getTaxVertex() == NULL && C->isTaxInstance() )
+	{
+		try { tax->getTypesInfo</*onlyDirect=*/false> ( C, actor ); return false; }
+		catch (...) { tax->clearVisited(); return true; }
+	}
+	// BOTTOM is not linked to the leaves of the partial taxonomy
+	if ( C->getTaxVertex() == tax->getBottomVertex() )
+		return true;
 	try { tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/true> ( C->getTaxVertex(), actor ); return false; }
 	catch (...) { tax->clearVisited(); return true; }
 }
@@ -486,11 +645,12 @@ public:
 	RIActor ( void ) {}
 	~RIActor ( void ) {}
 
-	bool apply ( const TaxonomyVertex& v )
+	bool apply ( const TaxonomyVertex& v ) { return apply ( v.getPrimer(), v.begin_syn(), v.end_syn() ); }
+	bool apply ( const ClassifiableEntry* entry, TaxonomyVertex::syn_iterator begin, TaxonomyVertex::syn_iterator end )
 	{
-		bool ret = tryEntry(v.getPrimer());
+		bool ret = tryEntry(entry);
 
-		for ( TaxonomyVertex::syn_iterator p = v.begin_syn(), p_end = v.end_syn(); p != p_end; ++p )
+		for ( TaxonomyVertex::syn_iterator p = begin; p != end; ++p )
 			ret |= tryEntry(*p);
 
 		return ret;
@@ -585,12 +745,24 @@ ReasoningKernel :: isRelated ( const TIndividualExpr* I, const TORoleExpr* R, co
 unsigned int
 ReasoningKernel :: getAtomicDecompositionSize ( bool useSemantic, ModuleType moduleType )
 {
+	// use the AD in memory if it was built for the same ontology; the saved one otherwise
+	if ( AD != NULL && ADVersion == Ontology.getVersion() && ADSemantic == useSemantic && AD->getModuleType() == moduleType )
+		return AD->getAOS()->size();
+	if ( LoadModuleState(/*replaceAD=*/true) && AD != NULL && ADVersion == Ontology.getVersion()
+		 && ADSemantic == useSemantic && AD->getModuleType() == moduleType )
+		return AD->getAOS()->size();
+
 	// init AD field
 	if ( unlikely(AD != NULL) )
 		delete AD;
 
 	AD = new AtomicDecomposer(getModExtractor(useSemantic)->getModularizer());
-	return AD->getAOS ( &Ontology, moduleType )->size();
+	AD->setThreads(getOptions()->getInt("ADThreads"));
+	ADVersion = Ontology.getVersion();
+	ADSemantic = useSemantic;
+	unsigned int size = AD->getAOS ( &Ontology, moduleType )->size();
+	SaveModuleState();
+	return size;
 }
 	/// get a set of axioms that corresponds to the atom with the id INDEX
 const TOntologyAtom::AxiomSet&
@@ -625,13 +797,25 @@ ReasoningKernel :: getModExtractor ( bool useSemantic )
 	if ( useSemantic )
 	{
 		if ( unlikely(ModSem == NULL) )
-			ModSem = new OntologyBasedModularizer ( getOntology(), /*useSem=*/true );
+			ModSem = new OntologyBasedModularizer ( getOntology(), /*useSem=*/true, getOptions()->getInt("semanticLocalityThreads") );
 		return ModSem;
 	}
 	else
 	{
 		if ( unlikely(ModSyn == NULL) )
+		{
 			ModSyn = new OntologyBasedModularizer ( getOntology(), /*useSem=*/false);
+			// use the saved module index if possible; save the new one otherwise
+			if ( pModSLManager != NULL )
+			{
+				LoadModuleState(/*replaceAD=*/false);
+				if ( !ModSyn->hasModuleIndex() )
+				{
+					ModSyn->getModuleIndex();
+					SaveModuleState();
+				}
+			}
+		}
 		return ModSyn;
 	}
 }
@@ -689,6 +873,8 @@ ReasoningKernel :: setSaveLoadContext ( const std::string& name )
 {
 	delete pSLManager;
 	pSLManager = new SaveLoadManager(name);
+	delete pModSLManager;
+	pModSLManager = new SaveLoadManager(name,"modules");
 	return pSLManager->existsContent();
 }
 
@@ -696,12 +882,321 @@ ReasoningKernel :: setSaveLoadContext ( const std::string& name )
 bool
 ReasoningKernel :: clearSaveLoadContext ( const std::string& name ) const
 {
+	// modules and atoms are saved separately
+	SaveLoadManager Modules(name,"modules");
+	bool hasModules = Modules.existsContent();
+	if ( hasModules )
+		Modules.clearContent();
 	if ( checkSaveLoadContext(name) )
 	{
 		SaveLoadManager(name).clearContent();
 		return true;
 	}
-	return false;
+	return hasModules;
+}
+
+//----------------------------------------------------------------------------------
+// hypothetical contexts
+//----------------------------------------------------------------------------------
+
+/// open a context; the reasoner's state is set aside only when the context's changes are loaded
+void
+ReasoningKernel :: pushContext ( void )
+{
+	// make sure the state at the start of the context is complete
+	if ( getStatus() < kbClassified )
+		processKB(kbClassified);
+
+	KernelContext* C = new KernelContext;
+	C->nAxioms = Ontology.size();
+	C->Used.reserve(C->nAxioms);
+	for ( TOntology::iterator p = Ontology.begin(), p_end = Ontology.end(); p != p_end; ++p )
+		C->Used.push_back((*p)->isUsed());
+	Contexts.push_back(C);
+}
+
+/// close the innermost context; undo all its changes of the ontology
+void
+ReasoningKernel :: popContext ( void )
+{
+	if ( Contexts.empty() )
+		throw EFaCTPlusPlus("FaCT++ Kernel: no context to pop");
+
+	KernelContext* C = Contexts.back();
+	Contexts.pop_back();
+
+	// bring back the state of the context's start if its changes were loaded
+	if ( C->pTBox != NULL )
+	{
+		clearTBox();
+		for ( NameSigMap::iterator p = Name2Sig.begin(), p_end = Name2Sig.end(); p != p_end; ++p )
+			delete p->second;
+		Name2Sig.clear();
+		swapContextState(C);
+		initCacheAndFlags();
+		reasoningFailed = false;
+	}
+
+	// undo the usage changes of the old axioms; retract the context's ones
+	unsigned long version = Ontology.getVersion();
+	for ( size_t i = 0; i < C->nAxioms; ++i )
+	{
+		TDLAxiom* ax = Ontology[i];
+		if ( C->Used[i] && !ax->isUsed() )
+			Ontology.unretract(ax);
+		else if ( !C->Used[i] && ax->isUsed() )
+			Ontology.retract(ax);
+	}
+	for ( size_t i = C->nAxioms, n = Ontology.size(); i < n; ++i )
+		if ( Ontology[i]->isUsed() )
+			Ontology.retract(Ontology[i]);
+
+	// the TBox is loaded from the very same set of axioms, so the AD is valid as well
+	if ( AD != NULL && ADVersion == version )
+		ADVersion = Ontology.getVersion();
+	Ontology.setProcessed();
+	deleteContext(C);
+}
+
+/// delete context C together with the reasoner's state set aside in it
+void
+ReasoningKernel :: deleteContext ( KernelContext* C )
+{
+	delete C->pTBox;
+	delete C->pET;
+	delete C->KE;
+	delete C->AD;
+	delete C->ModSem;
+	delete C->ModSyn;
+	delete C->ModClassifier;
+	delete C->Realiser;
+	for ( NameSigMap::iterator p = C->Name2Sig.begin(), p_end = C->Name2Sig.end(); p != p_end; ++p )
+		delete p->second;
+	delete C;
+}
+
+/// delete all the contexts
+void
+ReasoningKernel :: clearContexts ( void )
+{
+	for ( ContextStack::iterator p = Contexts.begin(), p_end = Contexts.end(); p != p_end; ++p )
+		deleteContext(*p);
+	Contexts.clear();
+}
+
+/// exchange the reasoner's state with the one kept in the context C
+void
+ReasoningKernel :: swapContextState ( KernelContext* C )
+{
+	std::swap ( pTBox, C->pTBox );
+	std::swap ( pET, C->pET );
+	std::swap ( KE, C->KE );
+	std::swap ( AD, C->AD );
+	std::swap ( ADVersion, C->ADVersion );
+	std::swap ( ADSemantic, C->ADSemantic );
+	std::swap ( ModSyn, C->ModSyn );
+	std::swap ( ModSem, C->ModSem );
+	std::swap ( ModClassifier, C->ModClassifier );
+	std::swap ( Realiser, C->Realiser );
+	Name2Sig.swap(C->Name2Sig);
+	Sig2Names.swap(C->Sig2Names);
+	std::swap ( OntoSig, C->OntoSig );
+	// cached results refer to the TBox
+	QueryResults.clear();
+	// the names might be bound to the entries of the other TBox
+	getExpressionManager()->clearNameCache();
+}
+
+/// set the reasoner's state aside in the innermost context before its changes are loaded
+void
+ReasoningKernel :: saveContextState ( void )
+{
+	if ( Contexts.empty() || pTBox == NULL )
+		return;
+	KernelContext* C = Contexts.back();
+	// the state of the context's start is already kept; the current one belongs to the context
+	if ( C->pTBox != NULL )
+		return;
+	swapContextState(C);
+}
+
+//----------------------------------------------------------------------------------
+// shared schema classification
+//----------------------------------------------------------------------------------
+
+/// @return true iff axiom AX doesn't belong to the schema
+static bool
+isNonSchemaAxiom ( const TDLAxiom* ax )
+{
+	return dynamic_cast<const TDLAxiomDeclaration*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomInstanceOf*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomRelatedTo*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomRelatedToNot*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomValueOf*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomValueOfNot*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomSameIndividuals*>(ax) != NULL
+		|| dynamic_cast<const TDLAxiomDifferentIndividuals*>(ax) != NULL;
+}
+
+/// @return the schema axioms: sorted LISP forms of the used schema axioms and the names of the universal and empty roles
+TSchemaTaxonomy::SchemaAxioms
+ReasoningKernel :: getSchemaAxioms ( void )
+{
+	TSchemaTaxonomy::SchemaAxioms axioms;
+	// the universal and empty roles are parts of the schema
+	axioms.push_back("topObjectRole "+TopORoleName);
+	axioms.push_back("bottomObjectRole "+BotORoleName);
+	axioms.push_back("topDataRole "+TopDRoleName);
+	axioms.push_back("bottomDataRole "+BotDRoleName);
+	for ( TOntology::iterator p = Ontology.begin(), p_end = Ontology.end(); p != p_end; ++p )
+	{
+		if ( !(*p)->isUsed() || isNonSchemaAxiom(*p) )
+			continue;
+		std::ostringstream o;
+		TLISPOntologyPrinter LP(o);
+		(*p)->accept(LP);
+		axioms.push_back(o.str());
+	}
+	std::sort ( axioms.begin(), axioms.end() );
+	return axioms;
+}
+
+/// classify the modules of the concept names in parallel and use their subsumers in the TBox classification
+bool
+ReasoningKernel :: classifyModules ( void )
+{
+	pTBox->setSchemaTaxonomy(NULL);
+	delete ModClassifier;
+	ModClassifier = new ModularClassifier ( *getModExtractor(false)->getModuleIndex(), getOptions()->getInt("modularClassificationThreads"), OpTimeout );
+	// a single partition is as hard as the TBox itself
+	if ( ModClassifier->buildPartitions(*pTBox) < 2 )
+		return false;
+	pTBox->setSchemaTaxonomy(ModClassifier->classify());
+	return true;
+}
+
+/// classify the KB without the individuals and realise all of them at once
+void
+ReasoningKernel :: realiseInBulk ( void )
+{
+	if ( getStatus() < kbClassified )
+		pTBox->performClassification();
+	if ( Realiser == NULL )
+		Realiser = new BulkRealiser ( getOptions()->getInt("bulkRealisationThreads"), OpTimeout );
+	Realiser->realise ( *pTBox, Ontology.getAxioms() );
+}
+
+/// find the justifications of C [= D (of the unsatisfiability of C if D is NULL) in the STAR-module of their signature
+bool
+ReasoningKernel :: computeJustifications ( const TConceptExpr* C, const TConceptExpr* D, unsigned int maxCount, unsigned long timeLimit )
+{
+	TSignature Sig;
+	Sig.setLocality(false);
+	TExpressionSignatureUpdater Updater(Sig);
+	C->accept(Updater);
+	if ( D != NULL )
+		D->accept(Updater);
+
+	JustificationFinder Finder ( getModExtractor(false)->getModule ( Sig, M_STAR ), OpTimeout );
+	// the finder switches the axioms on under the top object role, so it needs the role names
+	if ( TopORoleName.empty() )
+		Finder.setTopBottomRoleNames ( "*UROLE*", "*EROLE*", "*UDROLE*", "*EDROLE*" );
+	else
+		Finder.setTopBottomRoleNames ( TopORoleName.c_str(), BotORoleName.c_str(), TopDRoleName.c_str(), BotDRoleName.c_str() );
+	JustificationsComplete = Finder.find ( C, D, maxCount, timeLimit );
+	Finder.getJustifications(Justifications);
+	if ( verboseOutput )
+		Finder.PrintStat(std::cerr);
+	return JustificationsComplete;
+}
+
+//----------------------------------------------------------------------------------
+// summary ABox
+//----------------------------------------------------------------------------------
+
+/// @return the summary of the ABox with the individuals of C kept apart; NULL if the summary is inconsistent
+SummaryABox*
+ReasoningKernel :: updateSummaryABox ( const TConceptExpr* C )
+{
+	bool rebuild = pSummary == NULL || pSummary->getVersion() != Ontology.getVersion();
+
+	// the individuals of the query are nominals, so they should not be merged with others
+	TSignature Sig;
+	TExpressionSignatureUpdater Updater(Sig);
+	C->accept(Updater);
+	for ( TSignature::iterator p = Sig.begin(), p_end = Sig.end(); p != p_end; ++p )
+		if ( const TDLIndividualName* I = dynamic_cast<const TDLIndividualName*>(*p) )
+			if ( SummaryPinned.insert(I).second && pSummary != NULL && !pSummary->isFixed(I) )
+				rebuild = true;
+
+	if ( rebuild )
+	{
+		delete pSummary;
+		pSummary = new SummaryABox ( Ontology, SummaryPinned, OpTimeout );
+		if ( verboseOutput )
+			pSummary->PrintStat(std::cerr);
+	}
+	return pSummary->isConsistent() ? pSummary : NULL;
+}
+
+/// @return true iff I is an instance of C; use the summary ABox and check its ambiguous answer against the whole KB
+bool
+ReasoningKernel :: isSummaryInstance ( const TIndividualExpr* I, const TConceptExpr* C )
+{
+	const TDLIndividualName* name = dynamic_cast<const TDLIndividualName*>(I);
+	SummaryABox* Summary = name != NULL ? updateSummaryABox(C) : NULL;
+	SummaryABox::Answer ans = Summary != NULL ? Summary->answer ( name, C ) : SummaryABox::saUnknown;
+	if ( ans != SummaryABox::saUnknown )
+		return ans == SummaryABox::saYes;
+
+	// the test against the whole KB doesn't need the realisation
+	preprocessKB();
+	getIndividual ( I, "individual name expected in the isInstance()" );
+	return isSubsumedBy ( getExpressionManager()->OneOf(I), C );
+}
+
+/// set RESULT into the names of all instances of given [complex] C; use the summary ABox if allowed
+void
+ReasoningKernel :: getInstanceNames ( const TConceptExpr* C, SummaryABox::IndividualVec& Result )
+{
+	Result.clear();
+	SummaryABox* Summary = useSummaryABox && !isKBRealised() ? updateSummaryABox(C) : NULL;
+
+	if ( Summary == NULL )
+	{
+		Actor actor;
+		actor.needIndividuals();
+		getInstances ( C, actor );
+		Actor::Array1D Found;
+		actor.getFoundData(Found);
+		for ( Actor::Array1D::const_iterator p = Found.begin(), p_end = Found.end(); p != p_end; ++p )
+			Result.push_back(getExpressionManager()->Individual((*p)->getName()));
+		return;
+	}
+
+	std::vector<SummaryABox::Answer> Answers;
+	Summary->answer ( C, Answers );
+	for ( unsigned int n = 0; n < Answers.size(); ++n )
+	{
+		const SummaryABox::IndividualVec& Members = Summary->getMembers(n);
+		if ( Answers[n] == SummaryABox::saYes )
+			Result.insert ( Result.end(), Members.begin(), Members.end() );
+		else if ( Answers[n] == SummaryABox::saUnknown )	// refine the ambiguous node by checking every individual
+			for ( SummaryABox::IndividualVec::const_iterator p = Members.begin(), p_end = Members.end(); p != p_end; ++p )
+				if ( isSubsumedBy ( getExpressionManager()->OneOf(*p), C ) )
+					Result.push_back(*p);
+	}
+}
+
+/// classify the schema ontology and @return its classification to share
+TSchemaTaxonomy*
+ReasoningKernel :: buildSchemaTaxonomy ( void )
+{
+	classifyKB();
+	// individuals in the schema (e.g., nominals) make its classification depend on the ABox
+	if ( getTBox()->i_begin() != getTBox()->i_end() )
+		throw EFaCTPlusPlus("FaCT++ Kernel: the schema to share should not contain individuals");
+	return new TSchemaTaxonomy ( getTBox()->c_begin(), getTBox()->c_end(), getSchemaAxioms() );
 }
 
 //******************************************
@@ -879,6 +1374,141 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "benchmarkNames" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkNames",
+		"Option 'benchmarkNames' forces FaCT++ to measure the memory per name and the lookup speed of the name tables and exit instead of performing classification",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "benchmarkModules" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkModules",
+		"Option 'benchmarkModules' forces FaCT++ to extract the BOT-module of every concept name with the old and the dense-ID module extractors, compare the timings and exit instead of performing classification",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "ADThreads" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"ADThreads",
+		"Option 'ADThreads' sets the number of threads used to build the modules of all axioms in the syntactic atomic decomposition. The sequential algorithm is used if it is 1.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
+	// register "semanticLocalityThreads" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"semanticLocalityThreads",
+		"Option 'semanticLocalityThreads' sets the number of reasoners that check semantic locality of axioms in parallel during the semantic module extraction.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
+	// register "useModularClassification" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useModularClassification",
+		"Option 'useModularClassification' allows one to classify the BOT-modules of the concept names by separate reasoners in parallel, and to use their results in the classification of the whole ontology.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "useLazyClassification" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useLazyClassification",
+		"Option 'useLazyClassification' allows one to answer the queries about the subsumers of a concept name by classifying only the concepts from its BOT-module. The rest of the concepts are classified when the whole taxonomy is needed.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "useSummaryABox" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useSummaryABox",
+		"Option 'useSummaryABox' allows one to answer the instance queries without the realisation. The individuals with the same told types and role assertions are merged into the nodes of a summary ABox; only the individuals of the nodes with ambiguous answers are checked against the whole ontology.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "modularClassificationThreads" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"modularClassificationThreads",
+		"Option 'modularClassificationThreads' sets the number of reasoners that classify the modules in parallel if the modular classification is used.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
+	// register "benchmarkClassification" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkClassification",
+		"Option 'benchmarkClassification' forces FaCT++ to classify the ontology with and without the modular classification, compare the timings and the taxonomies and exit",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "benchmarkInstances" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkInstances",
+		"Option 'benchmarkInstances' forces FaCT++ to add a generated LUBM-style ABox to the ontology, answer the instance queries with and without the summary ABox, compare the timings and the answers and exit",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "benchmarkInstancesScale" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkInstancesScale",
+		"Option 'benchmarkInstancesScale' sets the number of the universities in the ABox generated for the instance benchmark.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
+	// register "useBulkRealisation" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"useBulkRealisation",
+		"Option 'useBulkRealisation' allows one to realise all the individuals at once after the classification of the concepts. The candidate types are answered by the cached models of the individuals where possible, the rest are checked for the groups of individuals together.",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "bulkRealisationThreads" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"bulkRealisationThreads",
+		"Option 'bulkRealisationThreads' sets the number of reasoners (at most the number of processors) that check the groups of individuals in parallel if the bulk realisation is used.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
+	// register "benchmarkRealisation" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkRealisation",
+		"Option 'benchmarkRealisation' forces FaCT++ to add a generated LUBM-style ABox to the ontology, realise it with and without the bulk realisation, compare the timings and the types of the individuals and exit",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
+	// register "benchmarkJustifications" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"benchmarkJustifications",
+		"Option 'benchmarkJustifications' forces FaCT++ to find the justifications of a sample of the direct subsumptions of the ontology, check every justification from scratch and exit",
+		ifOption::iotBool,
+		"false"
+		) )
+		return true;
+
 	// register "dumpOntology" option (28/03/2013)
 	if ( KernelOptions.RegisterOption (
 		"dumpOntology",
@@ -897,6 +1527,15 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "incrementalModuleThreads" option (19/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"incrementalModuleThreads",
+		"Option 'incrementalModuleThreads' sets the number of threads used to build the modules of the concept names when the incremental reasoning is initialised. The sequential algorithm is used if it is 1.",
+		ifOption::iotInt,
+		"1"
+		) )
+		return true;
+
 	// register "allowUndefinedNames" option (03/11/2013)
 	if ( KernelOptions.RegisterOption (
 		"allowUndefinedNames",
@@ -906,6 +1545,16 @@ bool ReasoningKernel :: initOptions ( void )
 		) )
 		return true;
 
+	// register "queryCacheSize" option (18/10/2026)
+	if ( KernelOptions.RegisterOption (
+		"queryCacheSize",
+		"Option 'queryCacheSize' sets the number of recent complex queries whose results (satisfiability, "
+		"subsumption, taxonomy position) are kept by the reasoner. 0 switches the cache off.",
+		ifOption::iotInt,
+		"64"
+		) )
+		return true;
+
 	// register "queryAnswering" option (03/11/2013)
 	if ( KernelOptions.RegisterOption (
 		"queryAnswering",
@@ -31,14 +31,23 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "KnowledgeExplorer.h"
 #include "tOntologyAtom.h"	// types for AD
 #include "ModuleType.h"
+#include "tQueryResultCache.h"
+#include "ModularClassifier.h"
+#include "SummaryABox.h"
+#include "BulkRealiser.h"
+#include "procTimer.h"
 
 class OntologyBasedModularizer;
 class AtomicDecomposer;
+class LocalityChecker;
 class TJNICache;	// cached JNI information
 class SaveLoadManager;
 
 class ReasoningKernel
 {
+	friend class ModularClassifier;	// reads the TBoxes of the partition kernels
+	friend class BulkRealiser;	// reads the TBoxes of the parallel kernels
+
 public:	// types interface
 	/*
 		The type system for DL expressions used in the input language:
@@ -86,6 +95,8 @@ public:	// types interface
 
 		/// set of arbitrary named expressions
 	typedef std::vector<const TNamedEntry*> NamesVector;
+		/// vector of concept expressions (used in batch queries)
+	typedef std::vector<TConceptExpr*> ConceptExprVec;
 		// IndividualSet is just set of named individual expressions
 	typedef NamesVector IndividualSet;
 
@@ -108,6 +119,60 @@ protected:	// types
 	typedef const std::vector<const TDLExpression*> TExprVec;
 		/// names to module signature map
 	typedef TBox::NameSigMap NameSigMap;
+		/// hypothetical reasoning context: undo log of the ontology changes and the reasoner's state at its start
+	struct KernelContext
+	{
+			/// number of ontology axioms at the start of the context
+		size_t nAxioms;
+			/// usage flags of these axioms at the start of the context
+		std::vector<bool> Used;
+
+		// reasoner's state at the start of the context; set aside when the context's changes are loaded
+
+			/// TBox of the context's start
+		TBox* pTBox;
+			/// expression translator for that TBox
+		TExpressionTranslator* pET;
+			/// knowledge explorer
+		KnowledgeExplorer* KE;
+			/// atomic decomposer
+		AtomicDecomposer* AD;
+			/// ontology version the AD was built for
+		unsigned long ADVersion;
+			/// true iff the AD was built using semantic locality
+		bool ADSemantic;
+			/// syntactic locality based module extractor
+		OntologyBasedModularizer* ModSyn;
+			/// semantic locality based module extractor
+		OntologyBasedModularizer* ModSem;
+			/// classifier of the modules of the concept names
+		ModularClassifier* ModClassifier;
+			/// bulk realiser
+		BulkRealiser* Realiser;
+			/// incremental reasoning: name-signature map
+		NameSigMap Name2Sig;
+			/// incremental reasoning: reverse index of Name2Sig
+		std::vector<std::vector<const TNamedEntity*> > Sig2Names;
+			/// incremental reasoning: ontology signature
+		TSignature OntoSig;
+
+			/// empty c'tor
+		KernelContext ( void )
+			: nAxioms(0)
+			, pTBox(NULL)
+			, pET(NULL)
+			, KE(NULL)
+			, AD(NULL)
+			, ADVersion(0)
+			, ADSemantic(false)
+			, ModSyn(NULL)
+			, ModSem(NULL)
+			, ModClassifier(NULL)
+			, Realiser(NULL)
+			{}
+	}; // KernelContext
+		/// stack of contexts
+	typedef std::vector<KernelContext*> ContextStack;
 
 private:
 		/// options for the kernel and all related substructures
@@ -120,10 +185,12 @@ private:
 	static const char* ReleaseDate;
 		/// header of the file with internal state; defined in SaveLoad.cpp
 	static const char* InternalStateFileHeader;
+		/// header of the file with modules and atoms; defined in SaveLoad.cpp
+	static const char* ModuleStateFileHeader;
 
 protected:	// types
 		/// enumeration for the cache
-	enum cacheStatus { csEmpty, csSat, csClassified };
+	enum cacheStatus { csEmpty, csSat, csClassified, csInstances };
 		/// set of TreeNE
 /*	class TreeNESet: public TNameSet<TTreeNamedEntry>
 	{
@@ -146,24 +213,49 @@ protected:	// members
 	TExpressionTranslator* pET;
 		/// name-signature map
 	NameSigMap Name2Sig;
+		/// reverse index of Name2Sig: names whose module signatures contain an entity (by the entity's dense ID).
+		/// Might contain stale entries that are checked against Name2Sig on use
+	std::vector<std::vector<const TNamedEntity*> > Sig2Names;
 		/// ontology signature (used in incremental)
 	TSignature OntoSig;
 		/// trace vector for the last operation (set from the TBox trace-sets)
 	AxiomVec TraceVec;
+		/// justifications found by the last computeJustifications() call
+	std::vector<AxiomVec> Justifications;
+		/// true iff the last computeJustifications() call found all the justifications
+	bool JustificationsComplete;
 		/// knowledge exploration support
 	KnowledgeExplorer* KE;
 		/// atomic decomposer
 	AtomicDecomposer* AD;
+		/// version of the ontology the AD was built for
+	unsigned long ADVersion;
+		/// true iff the AD was built using semantic locality
+	bool ADSemantic;
 		/// syntactic locality based module extractor
 	OntologyBasedModularizer* ModSyn;
 		/// semantic locality based module extractor
 	OntologyBasedModularizer* ModSem;
+		/// classifier of the modules of the concept names
+	ModularClassifier* ModClassifier;
+		/// summary of the ABox to answer the instance queries without the realisation
+	SummaryABox* pSummary;
+		/// individuals to keep apart in the summary ABox (the ones used in the instance queries)
+	SummaryABox::IndividualSet SummaryPinned;
+		/// realiser of all the individuals at once
+	BulkRealiser* Realiser;
 		/// set to return by the locality checking procedure
 	AxiomVec Result;
 		/// JNI cache corresponding to a kernel. External, created and deleted outside
 	TJNICache* JNICache;
 		/// name of an S/L context. do nothing if empty
 	SaveLoadManager* pSLManager;
+		/// S/L manager for the modules and atoms of the S/L context
+	SaveLoadManager* pModSLManager;
+		/// open hypothetical contexts, the innermost last
+	ContextStack Contexts;
+		/// shared classification of the schema of the ontology (not owned)
+	const TSchemaTaxonomy* pSchema;
 
 	// Top/Bottom role names: if set, they will appear in all hierarchy-related output
 
@@ -199,6 +291,34 @@ protected:	// members
 	TConcept* cachedConcept;
 		/// cached query result (taxonomy position)
 	TaxonomyVertex* cachedVertex;
+		/// LRU cache of the results of recent complex queries
+	TQueryResultCache QueryResults;
+
+	// incremental reasoning statistics
+
+		/// number of the modules computed for the incremental reasoning
+	unsigned long nModule;
+		/// number of the modules computed with the help of the AD
+	unsigned long nADModule;
+		/// number of incremental updates
+	unsigned long nIncUpdates;
+		/// number of concepts checked for the impact of the changes
+	unsigned long nIncChecked;
+		/// number of concepts affected by the added axioms (M^+)
+	unsigned long nIncPlus;
+		/// number of concepts affected by the retracted axioms (M^-)
+	unsigned long nIncMinus;
+		/// time spent building the dense module index
+	TsProcTimer moduleIndexTimer;
+		/// time spent extracting the modules and filling their signatures
+	TsProcTimer moduleTimer;
+
+	// lazy classification statistics
+
+		/// number of the modules classified in the lazy mode
+	unsigned long nLazyModules;
+		/// number of the concepts in these modules
+	unsigned long nLazyConcepts;
 
 	// internal flags
 
@@ -210,8 +330,18 @@ protected:	// members
 	bool useAxiomSplitting;
 		/// ignore cache for the TExpr* (useful for semantic AD)
 	bool ignoreExprCache;
+		/// let the named entities remember their KB entries; false if the entities are shared with another kernel
+	bool bindEntities;
 		/// use incremental reasoning
 	bool useIncrementalReasoning;
+		/// classify the modules of the concept names before the TBox classification
+	bool useModularClassification;
+		/// classify only the module of a named concept to answer a query about its subsumers
+	bool useLazyClassification;
+		/// answer the instance queries using the summary ABox instead of the realisation
+	bool useSummaryABox;
+		/// realise the individuals in bulk rather than one by one
+	bool useBulkRealisation;
 		/// flag to dump LISP-like ontology
 	bool dumpOntology;
 
@@ -271,12 +401,54 @@ protected:	// methods
 	bool checkQueryCache ( TConceptExpr* query ) const { return ignoreExprCache ? false : cachedQuery == query; }
 		/// check whether query cache is the same as QUERY
 	bool checkQueryCache ( DLTree* query ) const { return equalTrees ( cachedQueryTree, query ); }
+		/// @return true iff results of queries about C could be kept in the query result cache
+	bool useQueryResults ( TConceptExpr* C ) const { return !ignoreExprCache && QueryResults.isActive() && !isNameOrConst(C); }
+		/// save the classified position of a QUERY in the query result cache
+	void saveQueryPosition ( TConceptExpr* query )
+	{
+		if ( useQueryResults(query) )
+			QueryResults.setPosition ( query, cachedVertex, getCTaxonomy()->isTemporary(cachedVertex) );
+	}
 		/// classify query; cache is ready at the point. NAMED means whether concept is just a name
 	void classifyQuery ( bool named );
+		/// put the direct instances of the classified complex query into its bucket; named ones have it already
+	void realiseQuery ( void )
+	{
+		if ( cachedVertex == getCTaxonomy()->getCurrent() )
+			getTBox()->realiseQueryConcept();
+	}
+		/// classify the concepts of the BOT-module of a named concept C in the lazy mode; @return true iff the taxonomy knows all the subsumers of C
+	bool classifyModuleOf ( const TConceptExpr* C );
+		/// ensure that all the subsumers of C are in the taxonomy: classify the module of C in the lazy mode, or the whole KB
+	void classifyKBFor ( const TConceptExpr* C )
+	{
+		if ( !classifyModuleOf(C) )
+			classifyKB();
+	}
+		/// @return the summary of the ABox with the individuals of C kept apart; NULL if the summary is inconsistent
+	SummaryABox* updateSummaryABox ( const TConceptExpr* C );
+		/// @return true iff I is an instance of C; use the summary ABox and check its ambiguous answer against the whole KB
+	bool isSummaryInstance ( const TIndividualExpr* I, const TConceptExpr* C );
 		/// set up cache for query, performing additional (re-)classification if necessary
 	void setUpCache ( DLTree* query, cacheStatus level );
 		/// set up cache for query, performing additional (re-)classification if necessary
 	void setUpCache ( TConceptExpr* query, cacheStatus level );
+		/// start processing several queries sharing their DAG entries
+	void startQueryBatch ( void )
+	{
+		clearQueryCache();
+		cacheLevel = csEmpty;
+		getTBox()->startQueryBatch();
+	}
+		/// finish processing of a query batch; the query cache is invalid afterwards
+	void finishQueryBatch ( void )
+	{
+		getTBox()->finishQueryBatch();
+		clearQueryCache();
+		cacheLevel = csEmpty;
+		cachedConcept = NULL;
+		cachedVertex = NULL;
+	}
 		/// clear cache and flags
 	void initCacheAndFlags ( void )
 	{
@@ -329,8 +501,18 @@ protected:	// methods
 		/// @return true iff C is satisfiable
 	bool checkSat ( const TConceptExpr* C )
 	{
+		bool useResults = useQueryResults(C);
+		if ( useResults )
+		{
+			TQueryResultCache::Answer ans = QueryResults.getAnswer(C);
+			if ( ans != TQueryResultCache::qaUnknown )
+				return ans == TQueryResultCache::qaTrue;
+		}
 		setUpCache ( C, csSat );
-		return getTBox()->isSatisfiable(cachedConcept);
+		bool ret = getTBox()->isSatisfiable(cachedConcept);
+		if ( useResults )
+			QueryResults.setAnswer ( C, NULL, ret );
+		return ret;
 	}
 		/// @return true iff C [= D holds
 	bool checkSub ( TConcept* C, TConcept* D );
@@ -498,12 +680,20 @@ protected:	// methods
 	//-- incremental reasoning support; implementation in Incremental.cpp
 	//----------------------------------------------
 
+		/// @return true iff the AD can be used to speed up the BOT-modules extraction
+	bool canUseADInModules ( void ) const;
+		/// setup Name2Sig for a given ENTITY; look for a module in Module (in the whole ontology if NULL)
+	void setupSig ( const TNamedEntity* entity, const AxiomVec* Module );
 		/// setup Name2Sig for a given ENTITY
-	void setupSig ( const TNamedEntity* entity, const AxiomVec& Module );
-		/// setup Name2Sig for a given ENTITY
-	void setupSig ( const TNamedEntity* entity ) { setupSig ( entity, Ontology.getAxioms() ); }
-		/// build signature for ENTITY and all dependent entities from toProcess; look for modules in Module;
-	void buildSignature ( const TNamedEntity* entity, const AxiomVec& Module, std::set<const TNamedEntity*>& toProcess );
+	void setupSig ( const TNamedEntity* entity ) { setupSig ( entity, NULL ); }
+		/// build signature for ENTITY and all dependent entities from toProcess; look for modules in Module (in the whole ontology if NULL)
+	void buildSignature ( const TNamedEntity* entity, const AxiomVec* Module, std::set<const TNamedEntity*>& toProcess );
+		/// build signatures of the modules of all NAMES with NTHREADS independent extractors; USEATOMS allows them to use the AD
+	void buildSignaturesParallel ( const std::vector<const TNamedEntity*>& Names, unsigned int nThreads, bool useAtoms );
+		/// add ENTITY to the reverse index for all the elements of SIG that are not in OLDSIG (if any)
+	void addSig2Names ( const TNamedEntity* entity, const TSignature& sig, const TSignature* oldSig );
+		/// add to CANDIDATES all the names whose module signatures might make the axiom AX non-local wrt LC
+	void addAffectedNames ( TDLAxiom* ax, LocalityChecker* lc, std::set<const TNamedEntity*>& Candidates );
 		/// initialise the incremental bits on full reload
 	void initIncremental ( void );
 		/// incrementally classify changes
@@ -537,6 +727,38 @@ protected:	// methods
 	void Save ( void );
 		/// load internal state of the Kernel using S/L Manager
 	void Load ( void );
+		/// save all the parts of the internal state of the Kernel
+	void SaveState ( SaveLoadManager& m );
+		/// load all the parts of the internal state of the Kernel
+	void LoadState ( SaveLoadManager& m );
+		/// save the module index and the AD built for the current ontology
+	void SaveModules ( SaveLoadManager& m );
+		/// load the module index and the AD; keep the current AD unless REPLACEAD is true. @throw EFPPSaveLoad if the ontology was changed
+	void LoadModules ( SaveLoadManager& m, bool replaceAD );
+		/// save the module index and the AD using the modules S/L Manager (if any)
+	void SaveModuleState ( void );
+		/// load the module index and the AD using the modules S/L Manager (if any); drop the out-of-date state. @return true if loaded
+	bool LoadModuleState ( bool replaceAD );
+
+	//----------------------------------------------
+	//-- hypothetical contexts support
+	//----------------------------------------------
+
+		/// delete context C together with the reasoner's state set aside in it
+	static void deleteContext ( KernelContext* C );
+		/// delete all the contexts
+	void clearContexts ( void );
+		/// exchange the reasoner's state with the one kept in the context C
+	void swapContextState ( KernelContext* C );
+		/// set the reasoner's state aside in the innermost context before its changes are loaded
+	void saveContextState ( void );
+
+		/// @return the schema (non-ABox) axioms of the ontology
+	TSchemaTaxonomy::SchemaAxioms getSchemaAxioms ( void );
+		/// classify the modules of the concept names for the TBox classification; @return true iff there are several of them
+	bool classifyModules ( void );
+		/// realise all the individuals of the KB at once
+	void realiseInBulk ( void );
 
 	//----------------------------------------------------------------------------------
 	// knowledge exploration queries
@@ -604,6 +826,27 @@ public:	// general staff
 	{
 		getTBox()->clearQueryConcept();	// get rid of the query leftovers
 		getTBox()->writeReasoningResult ( o, time );
+		if ( QueryResults.getHits() + QueryResults.getMisses() > 0 )
+			QueryResults.PrintStat(o);
+		if ( nModule > 0 )
+			PrintModuleStat(o);
+		if ( ModClassifier != NULL )
+			ModClassifier->PrintStat(o);
+		if ( pSummary != NULL )
+			pSummary->PrintStat(o);
+		if ( Realiser != NULL )
+			Realiser->PrintStat(o);
+		if ( nLazyModules > 0 )
+			o << "Lazy classification: " << nLazyModules << " modules with " << nLazyConcepts << " concepts classified on demand\n";
+	}
+		/// print the statistics of the incremental module computations
+	void PrintModuleStat ( std::ostream& o ) const
+	{
+		o << "Incremental modules: " << nModule << " modules (" << nADModule << " using AD); index built in "
+		  << moduleIndexTimer << " seconds, modules and signatures computed in " << moduleTimer << " seconds\n";
+		if ( nIncUpdates > 0 )
+			o << "Incremental updates: " << nIncUpdates << "; " << nIncChecked << " concepts checked, "
+			  << nIncPlus << " in M+, " << nIncMinus << " in M-\n";
 	}
 
 		/// set timeout value to VALUE
@@ -617,8 +860,24 @@ public:	// general staff
 	void setAxiomSplitting ( bool value ) { useAxiomSplitting = value; }
 		/// choose whether TExpr cache should be ignored
 	void setIgnoreExprCache ( bool value ) { ignoreExprCache = value; }
+		/// choose whether the named entities should remember their KB entries; should be set before the KB is created
+	void setBindEntities ( bool value ) { bindEntities = value; }
 		/// choose whether inctemental reasoning should be used
 	void setUseIncrementalReasoning ( bool value ) { useIncrementalReasoning = value; }
+		/// choose whether the modules of the concept names should be classified in parallel before the TBox classification
+	void setUseModularClassification ( bool value ) { useModularClassification = value; }
+		/// choose whether the queries about the subsumers of a name should classify only its module
+	void setUseLazyClassification ( bool value ) { useLazyClassification = value; }
+		/// choose whether the instance queries should be answered using the summary ABox instead of the realisation
+	void setUseSummaryABox ( bool value ) { useSummaryABox = value; }
+		/// @return the summary ABox used in the last instance query; NULL if there is none
+	const SummaryABox* getSummaryABox ( void ) const { return pSummary; }
+		/// @return the classifier of the modules used in the last classification; NULL if there is none
+	const ModularClassifier* getModularClassifier ( void ) const { return ModClassifier; }
+		/// choose whether the individuals should be realised in bulk (ignored with the incremental reasoning)
+	void setUseBulkRealisation ( bool value ) { useBulkRealisation = value; }
+		/// @return the bulk realiser used in the last realisation; NULL if there is none
+	const BulkRealiser* getBulkRealiser ( void ) const { return Realiser; }
 		/// set the signature of the expression translator
 	void setSignature ( const TSignature* sig ) { if ( pET != NULL ) pET->setSignature(sig); }
 		/// choose whether the loaded ontology should be dumped as a LISP one
@@ -637,6 +896,18 @@ public:	// general staff
 		return TraceVec;
 	}
 
+	//----------------------------------------------
+	//-- Justifications support
+	//----------------------------------------------
+
+		/// find at most MAXCOUNT (0 for all) justifications of C [= D, or of the unsatisfiability of C if D is NULL,
+		/// in TIMELIMIT milliseconds (0 for no limit); @return true iff all the justifications were found
+	bool computeJustifications ( const TConceptExpr* C, const TConceptExpr* D, unsigned int maxCount, unsigned long timeLimit );
+		/// @return the justifications found by the last computeJustifications() call
+	const std::vector<AxiomVec>& getJustifications ( void ) const { return Justifications; }
+		/// @return true iff the last computeJustifications() call found all the justifications
+	bool areJustificationsComplete ( void ) const { return JustificationsComplete; }
+
 		/// get access to an expression manager
 	TExpressionManager* getExpressionManager ( void ) { return Ontology.getExpressionManager(); }
 		/// get RW access to the ontology
@@ -648,6 +919,8 @@ public:	// general staff
 	void setJNICache ( TJNICache* cache ) { JNICache = cache; }
 		/// get JNI cache
 	TJNICache* getJNICache ( void ) const { return JNICache; }
+		/// get RO access to the query result cache (e.g., for its statistics)
+	const TQueryResultCache& getQueryResults ( void ) const { return QueryResults; }
 
 public:
 	//******************************************
@@ -666,13 +939,21 @@ public:
 		pTBox->setVerboseOutput(verboseOutput);
 		pTBox->setUseUndefinedNames(useUndefinedNames);
 		pET = new TExpressionTranslator(*pTBox);
+		pET->setBindEntities(bindEntities);
+		QueryResults.setMaxSize(getOptions()->getInt("queryCacheSize"));
 		initCacheAndFlags();
 		return false;
 	}
 		/// delete existed KB
 	bool releaseKB ( void )
 	{
+		clearContexts();
 		clearTBox();
+		Justifications.clear();
+		JustificationsComplete = true;
+		delete pSummary;
+		pSummary = NULL;
+		SummaryPinned.clear();
 		Ontology.clear();
 		// the new KB is coming so the failures of the precious one doesn't matter
 		reasoningFailed = false;
@@ -687,6 +968,23 @@ public:
 		return releaseKB () || newKB ();
 	}
 
+	// hypothetical contexts
+
+		/// open a context: all the changes of the ontology made after it are undone by the matching popContext()
+	void pushContext ( void );
+		/// close the innermost context: retract its axioms, bring back the ones it retracted and restore the reasoner's state from its start.
+		/// The context's axioms are kept in the ontology, so their handles remain valid
+	void popContext ( void );
+		/// @return the number of open contexts
+	size_t getContextDepth ( void ) const { return Contexts.size(); }
+
+	// shared schema classification
+
+		/// classify the ontology (which should have no individuals) and @return its classification to be shared; the caller owns it
+	TSchemaTaxonomy* buildSchemaTaxonomy ( void );
+		/// use classification SCHEMA of the ontology without ABox in the classification; it is ignored if the schema axioms differ
+	void setSchemaTaxonomy ( const TSchemaTaxonomy* schema ) { pSchema = schema; }
+
 	//----------------------------------------------------
 	//	TELLS interface
 	//----------------------------------------------------
@@ -1055,9 +1353,22 @@ public:
 	{
 		preprocessKB();
 		if ( isNameOrConst(D) && likely(isNameOrConst(C)) )
+		{
+			classifyModuleOf(C);	// the subsumers of C are in the taxonomy in the lazy mode
 			return checkSub ( getTBox()->getCI(TreeDeleter(e(C))), getTBox()->getCI(TreeDeleter(e(D))) );
+		}
+		bool useResults = !ignoreExprCache && QueryResults.isActive();
+		if ( useResults )
+		{
+			TQueryResultCache::Answer ans = QueryResults.getAnswer(C,D);
+			if ( ans != TQueryResultCache::qaUnknown )
+				return ans == TQueryResultCache::qaTrue;
+		}
 		DLTree* nD = createSNFNot(e(D));
-		return !checkSatTree ( createSNFAnd (e(C), nD) );
+		bool ret = !checkSatTree ( createSNFAnd (e(C), nD) );
+		if ( useResults )
+			QueryResults.setAnswer ( C, D, ret );
+		return ret;
 	}
 		/// @return true iff C is disjoint with D; that is, (C and D) is unsatisfiable
 	bool isDisjoint ( const TConceptExpr* C, const TConceptExpr* D ) { return !isSatisfiable(getExpressionManager()->And(C,D)); }
@@ -1087,7 +1398,7 @@ public:
 	template<class Actor>
 	void getSupConcepts ( const TConceptExpr* C, bool direct, Actor& actor )
 	{
-		classifyKB();	// ensure KB is ready to answer the query
+		classifyKBFor(C);	// ensure KB is ready to answer the query
 		setUpCache ( C, csClassified );
 		actor.clear();
 		Taxonomy* tax = getCTaxonomy();
@@ -1113,7 +1424,7 @@ public:
 	template<class Actor>
 	void getEquivalentConcepts ( const TConceptExpr* C, Actor& actor )
 	{
-		classifyKB();	// ensure KB is ready to answer the query
+		classifyKBFor(C);	// ensure KB is ready to answer the query
 		setUpCache ( C, csClassified );
 		actor.clear();
 		actor.apply(*cachedVertex);
@@ -1129,6 +1440,41 @@ public:
 		// we are looking for all sub-concepts of (not C) (including synonyms to it)
 		tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/false> ( cachedVertex, actor );
 	}
+		/// classify all [complex] concepts from CS together; apply Parents[i] to all DIRECT super-concepts of CS[i] and Equivalents[i] to its synonyms
+	template<class Actor>
+	void getConceptPositions ( const ConceptExprVec& Cs, const std::vector<Actor*>& Parents, const std::vector<Actor*>& Equivalents )
+	{
+		fpp_assert ( Parents.size() == Cs.size() && Equivalents.size() == Cs.size() );
+		classifyKB();	// ensure KB is ready to answer the query
+		// the same expression is classified only once
+		std::map<TConceptExpr*, size_t> Processed;
+		startQueryBatch();
+		try
+		{
+			for ( size_t i = 0; i < Cs.size(); ++i )
+			{
+				std::map<TConceptExpr*, size_t>::const_iterator found = Processed.find(Cs[i]);
+				if ( found != Processed.end() )
+				{
+					*Parents[i] = *Parents[found->second];
+					*Equivalents[i] = *Equivalents[found->second];
+					continue;
+				}
+				Processed[Cs[i]] = i;
+				setUpCache ( Cs[i], csClassified );
+				Parents[i]->clear();
+				getCTaxonomy()->getRelativesInfo</*needCurrent=*/false, /*onlyDirect=*/true, /*upDirection=*/true> ( cachedVertex, *Parents[i] );
+				Equivalents[i]->clear();
+				Equivalents[i]->apply(*cachedVertex);
+			}
+		}
+		catch (...)
+		{
+			finishQueryBatch();
+			throw;
+		}
+		finishQueryBatch();
+	}
 
 	// role hierarchy
 
@@ -1208,20 +1554,9 @@ public:
 	void getDirectInstances ( const TConceptExpr* C, Actor& actor )
 	{
 		realiseKB();	// ensure KB is ready to answer the query
-		setUpCache ( C, csClassified );
+		setUpCache ( C, csInstances );
 		actor.clear();
-
-		// implement 1-level check by hand
-
-		// if the root vertex contains individuals -- we are done
-		if ( actor.apply(*cachedVertex) )
-			return;
-
-		// if not, just go 1 level down and apply the actor regardless of what's found
-		// FIXME!! check again after bucket-method will be implemented
-		for ( TaxonomyVertex::iterator p = cachedVertex->begin(/*upDirection=*/false),
-				p_end = cachedVertex->end(/*upDirection=*/false); p != p_end; ++p )
-			actor.apply(**p);
+		getCTaxonomy()->getInstancesInfo</*onlyDirect=*/true> ( cachedVertex, actor );
 	}
 
 		/// apply actor::apply() to all instances of given [complex] C
@@ -1229,20 +1564,32 @@ public:
 	void getInstances ( const TConceptExpr* C, Actor& actor )
 	{	// FIXME!! check for Racer's/IS approach
 		realiseKB();	// ensure KB is ready to answer the query
-		setUpCache ( C, csClassified );
+		setUpCache ( C, csInstances );
 		actor.clear();
-		Taxonomy* tax = getCTaxonomy();
-		tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/false, /*upDirection=*/false> ( cachedVertex, actor );
+		getCTaxonomy()->getInstancesInfo</*onlyDirect=*/false> ( cachedVertex, actor );
 	}
 
+		/// set RESULT into the names of all instances of given [complex] C; use the summary ABox if allowed
+	void getInstanceNames ( const TConceptExpr* C, SummaryABox::IndividualVec& Result );
+
 		/// apply actor::apply() to all DIRECT concepts that are types of an individual I
 	template<class Actor>
 	void getTypes ( const TIndividualExpr* I, bool direct, Actor& actor )
 	{
 		realiseKB();	// ensure KB is ready to answer the query
+		Taxonomy* tax = getCTaxonomy();
+		TIndividual* ind = getIndividual ( I, "Only known individuals are allowed in the getTypes()" );
+		if ( ind->getTaxVertex() == NULL && ind->isTaxInstance() )
+		{	// individual is in the instance buckets of its direct types
+			actor.clear();
+			if ( direct )
+				tax->getTypesInfo</*onlyDirect=*/true> ( ind, actor );
+			else
+				tax->getTypesInfo</*onlyDirect=*/false> ( ind, actor );
+			return;
+		}
 		setUpCache ( getExpressionManager()->OneOf(I), csClassified );
 		actor.clear();
-		Taxonomy* tax = getCTaxonomy();
 		if ( direct )
 			tax->getRelativesInfo</*needCurrent=*/true, /*onlyDirect=*/true, /*upDirection=*/true> ( cachedVertex, actor );
 		else
@@ -1253,8 +1600,19 @@ public:
 	void getSameAs ( const TIndividualExpr* I, Actor& actor )
 	{
 		realiseKB();	// ensure KB is ready to answer the query
+		TIndividual* ind = getIndividual ( I, "Only known individuals are allowed in the getSameAs()" );
+		if ( ind->getTaxVertex() == NULL && ind->isTaxInstance() )
+		{	// individual is in the instance buckets together with its synonyms
+			actor.clear();
+			getCTaxonomy()->getSameInfo ( ind, actor );
+			return;
+		}
 		getEquivalentConcepts ( getExpressionManager()->OneOf(I), actor );
 	}
+		/// fill NAMES with the names of all the entities of the kind of ACTOR, indexed by their IDs in Actor::getFoundIds()
+	template<class Actor>
+	void getEntityNames ( const Actor& actor, std::vector<const char*>& names ) const
+		{ actor.getEntityNames ( *getTBox(), names ); }
 		/// @return true iff I and J refer to the same individual
 	bool isSameIndividuals ( const TIndividualExpr* I, const TIndividualExpr* J )
 	{
@@ -1266,6 +1624,8 @@ public:
 		/// @return true iff individual I is instance of given [complex] C
 	bool isInstance ( const TIndividualExpr* I, const TConceptExpr* C )
 	{
+		if ( useSummaryABox && !isKBRealised() )
+			return isSummaryInstance ( I, C );
 		realiseKB();	// ensure KB is ready to answer the query
 		getIndividual ( I, "individual name expected in the isInstance()" );
 		// FIXME!! this way a new concept is created; could be done more optimal
@@ -1337,7 +1697,7 @@ public:
 
 		/// check whether  @return true if a file with reasoner state with a given NAME exists.
 	bool checkSaveLoadContext ( const std::string& name ) const;
-		/// set a save/load file to a given NAME
+		/// set a save/load file to a given NAME; modules and atoms are saved to a separate file with the same NAME
 	bool setSaveLoadContext ( const std::string& name );
 		/// clear a cache for a given name
 	bool clearSaveLoadContext ( const std::string& name ) const;
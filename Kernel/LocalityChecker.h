@@ -20,6 +20,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define LOCALITYCHECKER_H
 
 #include "tSignature.h"
+#include "tDenseSignature.h"
+#include "tOntology.h"
 
 /// helper class to set signature and locality class
 class SigAccessor
@@ -27,21 +29,25 @@ class SigAccessor
 protected:	// members
 		/// signature of a module
 	const TSignature* sig;
+		/// signature of a module as a bitset; if not NULL then it is used instead of SIG
+	const TDenseSignature* denseSig;
 
 public:		// interface
 		/// init c'tor
-	SigAccessor ( const TSignature* s ) : sig(s) {}
+	SigAccessor ( const TSignature* s ) : sig(s), denseSig(NULL) {}
+		/// init c'tor for the bitset signatures
+	SigAccessor ( const TDenseSignature* s ) : sig(NULL), denseSig(s) {}
 		/// empty d'tor
 	virtual ~SigAccessor ( void ) {}
 
 	// locality flags
 
 		/// @return true iff concepts not in the signature are treated as TOPs
-	bool topCLocal ( void ) const { return sig->topCLocal(); }
+	bool topCLocal ( void ) const { return denseSig ? denseSig->topCLocal() : sig->topCLocal(); }
 		/// @return true iff concepts not in the signature are treated as BOTTOMs
 	bool botCLocal ( void ) const { return !topCLocal(); }
 		/// @return true iff roles not in the signature are treated as TOPs
-	bool topRLocal ( void ) const { return sig->topRLocal(); }
+	bool topRLocal ( void ) const { return denseSig ? denseSig->topRLocal() : sig->topRLocal(); }
 		/// @return true iff roles not in the signature are treated as BOTTOMs
 	bool botRLocal ( void ) const { return !topRLocal(); }
 
@@ -49,7 +55,7 @@ public:		// interface
 		/// @return the signature
 	const TSignature* getSignature ( void ) const { return sig; }
 		/// @return true iff SIGnature does NOT contain given entity
-	bool nc ( const TNamedEntity* entity ) const { return !sig->contains(entity); }
+	bool nc ( const TNamedEntity* entity ) const { return denseSig ? !denseSig->contains(entity) : !sig->contains(entity); }
 }; // SigAccessor
 
 /// base class for checking locality of a DL axiom
@@ -62,6 +68,8 @@ protected:	// members
 public:		// interface
 		/// init c'tor
 	LocalityChecker ( const TSignature* s ) : SigAccessor(s), isLocal(true) {}
+		/// init c'tor for the bitset signatures
+	LocalityChecker ( const TDenseSignature* s ) : SigAccessor(s), isLocal(true) {}
 		/// empty d'tor
 	virtual ~LocalityChecker ( void ) {}
 
@@ -70,6 +78,13 @@ public:		// interface
 	{
 		axiom->accept(*this);
 		return isLocal;
+	}
+		/// check locality of all the AXIOMS wrt signature; put the results to RESULT
+	virtual void checkLocality ( const AxiomVec& Axioms, std::vector<bool>& Result )
+	{
+		Result.resize(Axioms.size());
+		for ( size_t i = 0; i < Axioms.size(); ++i )
+			Result[i] = local(Axioms[i]);
 	}
 		/// fake method to match the semantic checker's interface
 	virtual void preprocessOntology ( const AxiomVec& s ATTR_UNUSED ) {}
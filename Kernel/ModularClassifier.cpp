@@ -0,0 +1,364 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <map>
+#include <algorithm>
+
+#include "ModularClassifier.h"
+#include "Kernel.h"
+
+/// minimal number of axioms in a partition
+static const size_t MinPartitionSize = 100;
+/// number of partitions per thread to balance the load
+static const size_t PartitionsPerThread = 4;
+
+struct ModularClassifier::Partition
+{
+		/// local indices of the axioms of the partition in the module index
+	std::vector<unsigned int> Axioms;
+		/// names to classify in the partition
+	EntityVec Names;
+		/// subsumers of every name; empty if the name was not classified
+	std::vector<EntityVec> Subsumers;
+		/// error message if the classification fails
+	std::string Error;
+}; // Partition
+
+/// told depth of the concepts
+typedef std::map<const ClassifiableEntry*, unsigned int> DepthMap;
+/// names of a vertex and all its ancestors
+typedef std::map<const TaxonomyVertex*, std::vector<const TNamedEntity*> > VertexNameMap;
+
+/// @return the depth of a concept C in the told subsumers hierarchy; cache it in DEPTH
+static unsigned int
+toldDepth ( const ClassifiableEntry* C, DepthMap& Depth )
+{
+	DepthMap::iterator p = Depth.find(C);
+	if ( p != Depth.end() )
+		return p->second;
+	Depth[C] = 0;	// break the told cycles
+	unsigned int depth = 0;
+	for ( ClassifiableEntry::const_iterator q = C->told_begin(), q_end = C->told_end(); q != q_end; ++q )
+		depth = std::max ( depth, toldDepth(*q,Depth)+1 );
+	Depth[C] = depth;
+	return depth;
+}
+
+/// compare the seeds by their told depth, the deepest first
+static bool
+deeperSeed ( const std::pair<unsigned int, const TNamedEntity*>& a, const std::pair<unsigned int, const TNamedEntity*>& b )
+{
+	return a.first > b.first;
+}
+
+/// @return the representative of the component of an axiom I in the union-find forest PARENT
+static unsigned int
+findRoot ( std::vector<unsigned int>& Parent, unsigned int i )
+{
+	while ( Parent[i] != i )
+	{
+		Parent[i] = Parent[Parent[i]];	// halve the path
+		i = Parent[i];
+	}
+	return i;
+}
+
+/// @return the names of a vertex V and all its ancestors; cache them in MAP
+static const std::vector<const TNamedEntity*>&
+vertexSubsumers ( const TaxonomyVertex* v, VertexNameMap& Map )
+{
+	VertexNameMap::iterator p = Map.find(v);
+	if ( p != Map.end() )
+		return p->second;
+
+	std::vector<const TNamedEntity*> subs;
+	for ( TaxonomyVertex::const_iterator q = v->begin(/*upDirection=*/true), q_end = v->end(/*upDirection=*/true); q != q_end; ++q )
+	{
+		const std::vector<const TNamedEntity*>& up = vertexSubsumers ( *q, Map );
+		subs.insert ( subs.end(), up.begin(), up.end() );
+	}
+	if ( v->getPrimer()->getEntity() != NULL )
+		subs.push_back(v->getPrimer()->getEntity());
+	for ( TaxonomyVertex::syn_iterator q = v->begin_syn(), q_end = v->end_syn(); q != q_end; ++q )
+		if ( (*q)->getEntity() != NULL )
+			subs.push_back((*q)->getEntity());
+	std::sort ( subs.begin(), subs.end() );
+	subs.erase ( std::unique ( subs.begin(), subs.end() ), subs.end() );
+
+	std::vector<const TNamedEntity*>& ret = Map[v];
+	ret.swap(subs);
+	return ret;
+}
+
+ModularClassifier :: ModularClassifier ( const TModuleIndex& index, unsigned int threads, unsigned long timeout )
+	: Index(index)
+	, Result(NULL)
+	, NextPartition(0)
+	, nThreads(threads > 0 ? threads : 1)
+	, Timeout(timeout)
+	, nNames(0)
+	, nPartitions(0)
+	, nIsolated(0)
+	, nClassified(0)
+	, nFailed(0)
+{
+	pthread_mutex_init ( &Lock, NULL );
+}
+
+ModularClassifier :: ~ModularClassifier ( void )
+{
+	clear();
+	pthread_mutex_destroy(&Lock);
+}
+
+void
+ModularClassifier :: clearPartitions ( void )
+{
+	for ( PartitionVec::iterator p = Partitions.begin(), p_end = Partitions.end(); p != p_end; ++p )
+		delete *p;
+	Partitions.clear();
+	Isolated.clear();
+}
+
+size_t
+ModularClassifier :: buildPartitions ( TBox& KB )
+{
+	clearPartitions();
+
+	// the names with the deepest told subsumers are likely to have the largest modules, so they are the first seeds
+	std::vector<std::pair<unsigned int, const TNamedEntity*> > Seeds;
+	DepthMap Depth;
+	unsigned int maxId = Index.maxEntityId();
+	for ( TBox::c_iterator p = KB.c_begin(), p_end = KB.c_end(); p != p_end; ++p )
+	{
+		const TNamedEntity* entity = (*p)->getEntity();
+		if ( entity == NULL || entity->getId() == 0 )
+			continue;
+		Seeds.push_back(std::make_pair(toldDepth(*p,Depth),entity));
+		maxId = std::max ( maxId, entity->getId()+1 );
+	}
+	std::stable_sort ( Seeds.begin(), Seeds.end(), deeperSeed );
+	nNames = Seeds.size();
+
+	// the modules of the seeds are joined into components whenever they share an axiom
+	std::vector<bool> Assigned(maxId,false);
+	std::vector<bool> InModule(Index.size(),false);
+	std::vector<unsigned int> Parent(Index.size());
+	for ( unsigned int i = 0; i < Parent.size(); ++i )
+		Parent[i] = i;
+	// names of every seed and an axiom of its module
+	std::vector<std::pair<unsigned int, EntityVec> > Groups;
+	TModuleExtractor Extractor(Index);
+
+	for ( size_t i = 0; i < Seeds.size(); ++i )
+	{
+		const TNamedEntity* seed = Seeds[i].second;
+		if ( Assigned[seed->getId()] )
+			continue;
+		Assigned[seed->getId()] = true;
+
+		TSignature sig;
+		sig.add(seed);
+		Extractor.extract ( sig, M_BOT );
+		const std::vector<unsigned int>& Module = Extractor.getModuleIds();
+		if ( Module.empty() )
+		{
+			Isolated.push_back(seed);
+			continue;
+		}
+
+		Groups.push_back(std::make_pair(Module.front(),EntityVec(1,seed)));
+		// the module of the seed contains the modules of all the names from its signature
+		const TDenseSignature& Sig = Extractor.getDenseSignature();
+		for ( TDenseSignature::iterator p = Sig.begin(), p_end = Sig.end(); p != p_end; ++p )
+		{
+			const TNamedEntity* entity = Index.getEntity(*p);
+			if ( !Assigned[*p] && dynamic_cast<const TDLConceptName*>(entity) != NULL )
+			{
+				Assigned[*p] = true;
+				Groups.back().second.push_back(entity);
+			}
+		}
+		unsigned int root = findRoot ( Parent, Module.front() );
+		for ( std::vector<unsigned int>::const_iterator p = Module.begin(), p_end = Module.end(); p != p_end; ++p )
+		{
+			InModule[*p] = true;
+			Parent[findRoot(Parent,*p)] = root;
+		}
+	}
+
+	// every component is classified as a whole, as it contains the modules of all its names
+	std::map<unsigned int, Partition*> Components;
+	std::vector<Partition*> Order;
+	for ( std::vector<std::pair<unsigned int, EntityVec> >::const_iterator p = Groups.begin(), p_end = Groups.end(); p != p_end; ++p )
+	{
+		Partition*& C = Components[findRoot(Parent,p->first)];
+		if ( C == NULL )
+		{
+			C = new Partition();
+			Order.push_back(C);
+		}
+		C->Names.insert ( C->Names.end(), p->second.begin(), p->second.end() );
+	}
+	for ( unsigned int i = 0; i < Index.size(); ++i )
+		if ( InModule[i] )
+			Components[findRoot(Parent,i)]->Axioms.push_back(i);
+
+	// small components are packed together until every thread has a few partitions
+	const size_t partitionSize = std::max ( MinPartitionSize, Index.size()/(nThreads*PartitionsPerThread) );
+	Partition* cur = NULL;
+	for ( std::vector<Partition*>::iterator p = Order.begin(), p_end = Order.end(); p != p_end; ++p )
+	{
+		if ( cur == NULL )
+		{
+			cur = *p;
+			continue;
+		}
+		if ( cur->Axioms.size() >= partitionSize )
+		{
+			Partitions.push_back(cur);
+			cur = *p;
+			continue;
+		}
+		cur->Names.insert ( cur->Names.end(), (*p)->Names.begin(), (*p)->Names.end() );
+		cur->Axioms.insert ( cur->Axioms.end(), (*p)->Axioms.begin(), (*p)->Axioms.end() );
+		delete *p;
+	}
+	if ( cur != NULL )
+		Partitions.push_back(cur);
+
+	nPartitions = Partitions.size();
+	nIsolated = Isolated.size();
+	return nPartitions;
+}
+
+void*
+ModularClassifier :: runWorker ( void* arg )
+{
+	static_cast<ModularClassifier*>(arg)->classifyPartitions();
+	return NULL;
+}
+
+ModularClassifier::Partition*
+ModularClassifier :: nextPartition ( void )
+{
+	pthread_mutex_lock(&Lock);
+	Partition* ret = NextPartition < Partitions.size() ? Partitions[NextPartition++] : NULL;
+	pthread_mutex_unlock(&Lock);
+	return ret;
+}
+
+void
+ModularClassifier :: classifyPartitions ( void )
+{
+	for ( Partition* P = nextPartition(); P != NULL; P = nextPartition() )
+		classifyPartition(*P);
+}
+
+void
+ModularClassifier :: classifyPartition ( Partition& P )
+{
+	ReasoningKernel Kernel;
+	// the entities of the axioms are shared with the main kernel and with the other partitions
+	Kernel.setBindEntities(false);
+	Kernel.setOperationTimeout(Timeout);
+	TOntology& Ontology = Kernel.getOntology();
+	for ( std::vector<unsigned int>::const_iterator p = P.Axioms.begin(), p_end = P.Axioms.end(); p != p_end; ++p )
+		Ontology.addShared(Index.getAxiom(*p));
+
+	try
+	{
+		Kernel.classifyKB();
+		collectSubsumers ( *Kernel.getTBox(), P );
+	}
+	catch ( const EFaCTPlusPlus& e )
+	{
+		P.Error = e.what();
+	}
+
+	// the axioms belong to the main ontology
+	Ontology.safeClear();
+}
+
+void
+ModularClassifier :: collectSubsumers ( TBox& KB, Partition& P )
+{
+	std::map<const TNamedEntity*, size_t> Pos;
+	for ( size_t i = 0; i < P.Names.size(); ++i )
+		Pos[P.Names[i]] = i;
+	P.Subsumers.resize(P.Names.size());
+
+	const TaxonomyVertex* bottom = KB.getTaxonomy()->getBottomVertex();
+	VertexNameMap Map;
+	for ( TBox::c_iterator p = KB.c_begin(), p_end = KB.c_end(); p != p_end; ++p )
+	{
+		std::map<const TNamedEntity*, size_t>::const_iterator found = Pos.find((*p)->getEntity());
+		if ( found == Pos.end() )
+			continue;
+		const TaxonomyVertex* v = resolveSynonym(*p)->getTaxVertex();
+		// unsatisfiable names are left for the tableaux
+		if ( v != NULL && v != bottom )
+			P.Subsumers[found->second] = vertexSubsumers ( v, Map );
+	}
+}
+
+const TSchemaTaxonomy*
+ModularClassifier :: classify ( void )
+{
+	// the classifier is the first worker
+	NextPartition = 0;
+	size_t nWorkers = std::min ( (size_t)nThreads, Partitions.size() );
+	std::vector<pthread_t> Threads(nWorkers);
+	size_t i, nStarted = 1;
+	for ( i = 1; i < nWorkers; ++i, ++nStarted )
+		if ( pthread_create ( &Threads[i], NULL, runWorker, this ) != 0 )
+			break;	// the started workers will do the rest
+	classifyPartitions();
+	for ( i = 1; i < nStarted; ++i )
+		pthread_join ( Threads[i], NULL );
+
+	// merge the subsumers; all the names are added to make the missing subsumers known as non-subsumers
+	delete Result;
+	Result = new TSchemaTaxonomy();
+	nClassified = nFailed = 0;
+	std::vector<std::string> Names;
+	for ( EntityVec::const_iterator p = Isolated.begin(), p_end = Isolated.end(); p != p_end; ++p, ++nClassified )
+		Result->setSubsumers ( (*p)->getName(), Names );
+	for ( PartitionVec::const_iterator p = Partitions.begin(), p_end = Partitions.end(); p != p_end; ++p )
+	{
+		const Partition& P = **p;
+		if ( !P.Error.empty() )
+			++nFailed;
+		for ( i = 0; i < P.Names.size(); ++i )
+		{
+			const std::string& name = P.Names[i]->getName();
+			if ( i >= P.Subsumers.size() || P.Subsumers[i].empty() )
+			{
+				Result->addName(name);
+				continue;
+			}
+			Names.clear();
+			for ( EntityVec::const_iterator q = P.Subsumers[i].begin(), q_end = P.Subsumers[i].end(); q != q_end; ++q )
+				Names.push_back((*q)->getName());
+			Result->setSubsumers ( name, Names );
+			++nClassified;
+		}
+	}
+	clearPartitions();
+	return Result;
+}
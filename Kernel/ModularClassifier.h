@@ -0,0 +1,122 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef MODULARCLASSIFIER_H
+#define MODULARCLASSIFIER_H
+
+#include <pthread.h>
+#include <vector>
+#include <ostream>
+
+#include "tModuleIndex.h"
+#include "tSchemaTaxonomy.h"
+
+class TBox;
+
+/// classification of the concept names of an ontology by partitions made of their BOT-modules.
+/// The BOT-module of a name A entails all the subsumers of A, and it contains the module of any
+/// name from its signature; moreover, any set of axioms between the module and the whole ontology
+/// entails the same subsumers of A. So the modules of the names are joined into components whenever
+/// they share an axiom, small components are grouped into one partition, and the partitions
+/// are classified by separate kernels in parallel. The subsumers of the names are merged into
+/// a TSchemaTaxonomy, that answers the subsumption tests between the names during the usual
+/// classification of the TBox. The rest of the tests (e.g., with the unsatisfiable names or
+/// with the names of the failed partitions) are verified there by the tableaux.
+class ModularClassifier
+{
+protected:	// types
+		/// partition with its axioms, names and their subsumers; defined in the .cpp
+	struct Partition;
+		/// all the partitions
+	typedef std::vector<Partition*> PartitionVec;
+		/// set of entities
+	typedef std::vector<const TNamedEntity*> EntityVec;
+
+protected:	// members
+		/// index of the ontology; the modules are taken from there
+	const TModuleIndex& Index;
+		/// all the partitions
+	PartitionVec Partitions;
+		/// names with empty modules: they are subsumed only by themselves
+	EntityVec Isolated;
+		/// subsumers of the classified names
+	TSchemaTaxonomy* Result;
+		/// lock of the next partition to classify
+	pthread_mutex_t Lock;
+		/// index of the next partition to classify
+	size_t NextPartition;
+		/// number of kernels that classify the partitions in parallel
+	unsigned int nThreads;
+		/// timeout of a single test in the partitions
+	unsigned long Timeout;
+		/// number of the names to classify
+	size_t nNames;
+		/// number of the partitions
+	size_t nPartitions;
+		/// number of the names with empty modules
+	size_t nIsolated;
+		/// number of the names with known subsumers
+	size_t nClassified;
+		/// number of failed partitions
+	size_t nFailed;
+
+private:	// no copy
+		/// no copy c'tor
+	ModularClassifier ( const ModularClassifier& );
+		/// no assignment
+	ModularClassifier& operator = ( const ModularClassifier& );
+
+protected:	// methods
+		/// thread body: classify partitions of the classifier ARG until they are over
+	static void* runWorker ( void* arg );
+		/// @return the next partition to classify; NULL if there are no more
+	Partition* nextPartition ( void );
+		/// classify partitions until they are over
+	void classifyPartitions ( void );
+		/// classify the partition P with a separate kernel
+	void classifyPartition ( Partition& P );
+		/// fill the subsumers of the names of P from the classified KB
+	void collectSubsumers ( TBox& KB, Partition& P );
+		/// delete all the partitions
+	void clearPartitions ( void );
+
+public:		// interface
+		/// init c'tor: use the modules from INDEX, THREADS kernels and the TIMEOUT of a test
+	ModularClassifier ( const TModuleIndex& index, unsigned int threads, unsigned long timeout );
+		/// d'tor
+	~ModularClassifier ( void );
+
+		/// split the concept names of KB into partitions; @return the number of partitions
+	size_t buildPartitions ( TBox& KB );
+		/// classify all the partitions and @return the subsumers of the classified names
+	const TSchemaTaxonomy* classify ( void );
+		/// free the memory of the partitions and of the result; the statistics is kept
+	void clear ( void ) { clearPartitions(); delete Result; Result = NULL; }
+
+		/// print the statistics of the modular classification
+	void PrintStat ( std::ostream& o ) const
+	{
+		o << "Modular classification: " << nNames << " names in " << nPartitions << " partitions and "
+		  << nIsolated << " empty modules; subsumers of " << nClassified << " names are found";
+		if ( nFailed > 0 )
+			o << ", " << nFailed << " partitions failed";
+		o << "\n";
+	}
+}; // ModularClassifier
+
+#endif
@@ -60,6 +60,8 @@ protected:	// members
 	unsigned long long nNonLocal;
 		/// true if no atoms are processed ATM
 	bool noAtomsProcessing;
+		/// true if the axioms of an index entry are checked by the checker as a batch
+	bool useBatches;
 
 protected:	// methods
 		/// update SIG wrt the axiom signature
@@ -110,9 +112,36 @@ protected:	// methods
 		/// add all the non-local axioms from given axiom-set AxSet
 	void addNonLocal ( const AxiomVec& AxSet, bool noCheck )
 	{
+		if ( useBatches && !noCheck )
+		{
+			addNonLocalBatch(AxSet);
+			return;
+		}
 		for ( SigIndex::const_iterator q = AxSet.begin(), q_end = AxSet.end(); q != q_end; ++q )
 			if ( !(*q)->isInModule() && (*q)->isInSS() ) // in the given range but not in module yet
 				addNonLocal ( *q, noCheck );
+	}
+		/// add all the non-local axioms from given axiom-set AxSet checking them as a batch wrt the current signature.
+		/// The locality of an axiom depends only on its own part of the signature, so the axioms that became
+		/// non-local due to the signature changes are checked again when the new entities are processed
+	void addNonLocalBatch ( const AxiomVec& AxSet )
+	{
+		AxiomVec Batch;
+		for ( SigIndex::const_iterator q = AxSet.begin(), q_end = AxSet.end(); q != q_end; ++q )
+			if ( !(*q)->isInModule() && (*q)->isInSS() ) // in the given range but not in module yet
+				Batch.push_back(*q);
+		if ( Batch.empty() )
+			return;
+		std::vector<bool> Local;
+		Checker->checkLocality ( Batch, Local );
+		nChecks += Batch.size();
+		for ( size_t i = 0; i < Batch.size(); ++i )
+			if ( !Local[i] )
+			{
+				++nNonLocal;
+				if ( !Batch[i]->isInModule() )
+					addNonLocal ( Batch[i], /*noCheck=*/true );
+			}
 	}
 		/// build a module traversing axioms by a signature
 	void extractModuleQueue ( void )
@@ -149,13 +178,14 @@ protected:	// methods
 	}
 
 public:		// interface
-		/// init c'tor
-	TModularizer ( bool useSem )
-		: Checker ( useSem ? (LocalityChecker*) new SemanticLocalityChecker(&sig) : (LocalityChecker*) new SyntacticLocalityChecker(&sig) )
+		/// init c'tor; semantic checker uses NTHREADS threads
+	TModularizer ( bool useSem, unsigned int nThreads = 1 )
+		: Checker ( useSem ? (LocalityChecker*) new SemanticLocalityChecker(&sig,nThreads) : (LocalityChecker*) new SyntacticLocalityChecker(&sig) )
 		, sigIndex(Checker)
 		, nChecks(0)
 		, nNonLocal(0)
 		, noAtomsProcessing(true)
+		, useBatches(useSem)
 		{}
 		// d'tor
 	~TModularizer ( void ) { delete Checker; }
@@ -20,6 +20,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define ONTOLOGYBASEDMODULARIZER_H
 
 #include "Modularity.h"
+#include "tModuleIndex.h"
 #include "tOntology.h"
 
 class OntologyBasedModularizer
@@ -27,31 +28,93 @@ class OntologyBasedModularizer
 protected:	// members
 		/// ontology to work with
 	const TOntology& Ontology;
-		/// pointer to a modularizer
+		/// pointer to a modularizer (built on demand)
 	TModularizer* Modularizer;
+		/// dense index of the ontology (syntactic locality only; built on demand)
+	TModuleIndex* Index;
+		/// extractor over the dense index
+	TModuleExtractor* Extractor;
+		/// version of the ontology the index was built for
+	unsigned long IndexVersion;
+		/// number of threads for the semantic locality checks
+	unsigned int nThreads;
+		/// true iff semantic locality is used
+	bool useSemantic;
 
 public:		// interface
-		/// init c'tor
-	OntologyBasedModularizer ( const TOntology& ontology, bool useSemantic )
+		/// init c'tor; semantic locality checks use THREADS threads
+	OntologyBasedModularizer ( const TOntology& ontology, bool useSem, unsigned int threads = 1 )
 		: Ontology(ontology)
+		, Modularizer(NULL)
+		, Index(NULL)
+		, Extractor(NULL)
+		, IndexVersion(0)
+		, nThreads(threads)
+		, useSemantic(useSem)
+		{}
+		/// d'tor
+	~OntologyBasedModularizer ( void )
 	{
-		Modularizer = new TModularizer(useSemantic);
-		Modularizer->preprocessOntology(Ontology.getAxioms());
+		delete Extractor;
+		delete Index;
+		delete Modularizer;
 	}
-		/// d'tor
-	~OntologyBasedModularizer ( void ) { delete Modularizer; }
 
 		/// get module
 	const AxiomVec& getModule ( const AxiomVec& From, const TSignature& sig, ModuleType type )
 	{
-		Modularizer->extract ( From, sig, type );
+		getModularizer()->extract ( From, sig, type );
 		return Modularizer->getModule();
 	}
 		/// get module
 	const AxiomVec& getModule ( const TSignature& sig, ModuleType type )
-		{ return getModule ( Ontology.getAxioms(), sig, type ); }
-		/// get access to a modularizer
-	TModularizer* getModularizer ( void ) { return Modularizer; }
+	{
+		if ( useSemantic )
+			return getModule ( Ontology.getAxioms(), sig, type );
+		getModuleExtractor()->extract ( sig, type );
+		return Extractor->getModule();
+	}
+		/// get access to a modularizer; build it if necessary
+	TModularizer* getModularizer ( void )
+	{
+		if ( unlikely(Modularizer == NULL) )
+		{
+			Modularizer = new TModularizer(useSemantic,nThreads);
+			Modularizer->preprocessOntology(Ontology.getAxioms());
+		}
+		return Modularizer;
+	}
+		/// @return true iff the dense module index is already built for the current ontology
+	bool hasModuleIndex ( void ) const { return Index != NULL && IndexVersion == Ontology.getVersion(); }
+		/// set the dense module index to a (loaded) INDEX; it will be deleted in d'tor
+	void setModuleIndex ( TModuleIndex* index )
+	{
+		fpp_assert ( !useSemantic );
+		delete Extractor;
+		Extractor = NULL;
+		delete Index;
+		Index = index;
+		IndexVersion = Ontology.getVersion();
+	}
+		/// get access to a dense module index; build it if necessary. Only syntactic locality is supported
+	const TModuleIndex* getModuleIndex ( void )
+	{
+		if ( unlikely(Index == NULL) )
+		{
+			fpp_assert ( !useSemantic );
+			Index = new TModuleIndex();
+			Index->preprocessOntology(Ontology.getAxioms());
+			IndexVersion = Ontology.getVersion();
+		}
+		return Index;
+	}
+		/// get access to an extractor over the dense module index
+	TModuleExtractor* getModuleExtractor ( void )
+	{
+		if ( unlikely(Extractor == NULL) )
+			Extractor = new TModuleExtractor(*getModuleIndex());
+		return Extractor;
+	}
 }; // OntologyBasedModularizer
 
 #endif
@@ -27,10 +27,6 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 // comment the line out for flushing LL after dumping significant piece of info
 //#define __DEBUG_FLUSH_LL
 
-#ifdef USE_REASONING_STATISTICS
-AccumulatedStatistic* AccumulatedStatistic::root = NULL;
-#endif
-
 DlSatTester :: DlSatTester ( TBox& tbox )
 	: tBox(tbox)
 	, DLHeap(tbox.DLHeap)
@@ -45,6 +41,39 @@ DlSatTester :: DlSatTester ( TBox& tbox )
 	, bContext(NULL)
 	, tryLevel(InitBranchingLevelValue)
 	, nonDetShift(0)
+#ifdef USE_REASONING_STATISTICS
+	, statRoot(NULL)
+	, nTacticCalls(statRoot)
+	, nUseless(statRoot)
+	, nIdCalls(statRoot)
+	, nSingletonCalls(statRoot)
+	, nOrCalls(statRoot)
+	, nOrBrCalls(statRoot)
+	, nAndCalls(statRoot)
+	, nSomeCalls(statRoot)
+	, nAllCalls(statRoot)
+	, nFuncCalls(statRoot)
+	, nLeCalls(statRoot)
+	, nGeCalls(statRoot)
+	, nNNCalls(statRoot)
+	, nMergeCalls(statRoot)
+	, nAutoEmptyLookups(statRoot)
+	, nAutoTransLookups(statRoot)
+	, nSRuleAdd(statRoot)
+	, nSRuleFire(statRoot)
+	, nStateSaves(statRoot)
+	, nStateRestores(statRoot)
+	, nNodeSaves(statRoot)
+	, nNodeRestores(statRoot)
+	, nLookups(statRoot)
+	, nFairnessViolations(statRoot)
+	, nCacheTry(statRoot)
+	, nCacheFailedNoCache(statRoot)
+	, nCacheFailedShallow(statRoot)
+	, nCacheFailed(statRoot)
+	, nCachedSat(statRoot)
+	, nCachedUnsat(statRoot)
+#endif
 	, curNode(NULL)
 	, dagSize(0)
 {
@@ -56,6 +85,8 @@ DlSatTester :: DlSatTester ( TBox& tbox )
 	tBox.getORM()->fillReflexiveRoles(ReflexiveRoles);
 	// init blocking statistics
 	clearBlockingStat();
+	// a test is run by a single thread; other reasoners might run in parallel
+	testTimer.setThreadTime(true);
 
 	resetSessionFlags();
 }
@@ -424,7 +455,7 @@ DlSatTester :: finaliseStatistic ( void )
 		logStatisticData ( LL, /*needLocal=*/true );
 
 	// merge local statistics with the global one
-	AccumulatedStatistic::accumulateAll();
+	AccumulatedStatistic::accumulateAll(statRoot);
 #endif
 
 	// clear global statistics
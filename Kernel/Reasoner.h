@@ -45,13 +45,10 @@ private:	// prohibit copy
 		/// assignment (unimplemented)
 	AccumulatedStatistic& operator = ( const AccumulatedStatistic& );
 
-protected:	// static members
-		/// all members are linked together
-	static AccumulatedStatistic* root;
-
 public:		// static methods
-		/// accumulate all registered statistic elements
-	static void accumulateAll ( void )
+		/// accumulate all the statistic elements of the list ROOT. The elements of a reasoner are
+		/// linked in a list of their own, as other reasoners might update theirs in parallel
+	static void accumulateAll ( AccumulatedStatistic* root )
 	{
 		for ( AccumulatedStatistic* cur = root; cur; cur = cur->next )
 			cur->accumulate();
@@ -66,25 +63,10 @@ protected:	// members
 	AccumulatedStatistic* next;
 
 public:		// interface
-		/// c'tor: link itself to the list
-	AccumulatedStatistic ( void ) : total(0), local(0), next(root) { root = this; }
-		/// d'tor: remove link from the list
-	~AccumulatedStatistic ( void )
-	{
-		// all statistic elements are deleted in the inversed creation order
-		if ( root == this )
-		{
-			root = next;
-			return;
-		}
-		// we are here if it's multi-environment and arbitrary deletion order was chosen
-		AccumulatedStatistic *prev = root, *cur = root->next;
-		// find a pointer to current node
-		for ( ; cur && cur != this; prev = cur, cur = cur->next )
-			(void)NULL;
-		if ( cur == this )
-			prev->next = next;
-	}
+		/// c'tor: link itself to the list ROOT of its owner
+	AccumulatedStatistic ( AccumulatedStatistic*& root ) : total(0), local(0), next(root) { root = this; }
+		/// empty d'tor: the elements of a list are deleted together with their owner
+	~AccumulatedStatistic ( void ) {}
 
 	// access to the elements
 
@@ -241,7 +223,8 @@ protected:	// members
 	TsProcTimer satTimer;
 		/// timer for the SUB tests (ie, general subsumption)
 	TsProcTimer subTimer;
-		/// timer for a single test; use it as a timeout checker
+		/// timer for a single test; use it as a timeout checker. It measures the CPU time of the thread
+		/// that runs the test, so the reasoners of other threads do not make the test time out
 	TsProcTimer testTimer;
 
 	// save/restore option
@@ -260,6 +243,8 @@ protected:	// members
 	// statistic elements
 
 #ifdef USE_REASONING_STATISTICS
+		/// list of all the statistic elements below
+	AccumulatedStatistic* statRoot;
 	AccumulatedStatistic
 		nTacticCalls,
 		nUseless,
@@ -991,7 +976,7 @@ public:
 	void writeTotalStatistic ( std::ostream& o )
 	{
 #	ifdef USE_REASONING_STATISTICS
-		AccumulatedStatistic::accumulateAll();	// ensure that the last reasoning results are in
+		AccumulatedStatistic::accumulateAll(statRoot);	// ensure that the last reasoning results are in
 		logStatisticData ( o, /*needLocal=*/false );
 #	endif
 		printBlockingStat (o);
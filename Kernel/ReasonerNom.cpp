@@ -100,6 +100,27 @@ NominalReasoner :: consistentNominalCloud ( void )
 	return true;
 }
 
+/// check whether the ontology is consistent with the concept NC in the labels of all the individuals from INDS
+bool
+NominalReasoner :: consistentWithTypes ( const SingletonVector& Inds, BipolarPointer NC )
+{
+	prepareReasoner();
+
+	// the concept goes directly to the nodes the individuals are merged to
+	for ( SingletonVector::const_iterator p = Inds.begin(), p_end = Inds.end(); p != p_end; ++p )
+	{
+		DepSet dep;
+		DlCompletionTree* node = resolveSynonym(*p)->node->resolvePBlocker(dep);
+		if ( addToDoEntry ( node, NC, dep, "bt" ) )
+			return false;	// clash during initialisation
+	}
+
+	subTimer.Start();
+	bool result = runSat();
+	subTimer.Stop();
+	return result;
+}
+
 /// create nominal nodes for all individuals in TBox
 bool
 NominalReasoner :: initNominalCloud ( void )
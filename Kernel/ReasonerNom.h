@@ -88,6 +88,8 @@ public:
 
 		/// check an extra conditions (for query answering)
 	bool checkExtraCond ( void );
+		/// check whether the ontology is consistent with the concept NC in the labels of all the individuals from INDS
+	bool consistentWithTypes ( const SingletonVector& Inds, BipolarPointer NC );
 }; // NominalReasoner
 
 //-----------------------------------------------------------------------------
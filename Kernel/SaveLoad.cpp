@@ -20,11 +20,18 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 //-- Saving/restoring internal state of the FaCT++
 //-------------------------------------------------------
 
+#include <sstream>
+#include <algorithm>
+
 #include "Kernel.h"
 #include "ReasonerNom.h"	// for initReasoner()
 #include "SaveLoadManager.h"
+#include "AtomicDecomposer.h"
+#include "OntologyBasedModularizer.h"
+#include "tOntologyPrinterLISP.h"	// for the ontology fingerprint
 
-const char* ReasoningKernel :: InternalStateFileHeader = "FaCT++InternalStateDump1.0";
+const char* ReasoningKernel :: InternalStateFileHeader = "FaCT++InternalStateDump1.1";
+const char* ReasoningKernel :: ModuleStateFileHeader = "FaCT++ModuleStateDump1.0";
 
 const int bytesInInt = sizeof(int);
 
@@ -74,15 +81,7 @@ ReasoningKernel :: Save ( SaveLoadManager& m )
 {
 	TsProcTimer t;
 	t.Start();
-	m.checkStream();
-	SaveHeader(m);
-	m.checkStream();
-	SaveOptions(m);
-	m.checkStream();
-	SaveKB(m);
-	m.checkStream();
-	SaveIncremental(m);
-	m.checkStream();
+	SaveState(m);
 	t.Stop();
 	std::cout << "Reasoner internal state saved in " << t << " sec" << std::endl;
 }
@@ -100,16 +99,7 @@ ReasoningKernel :: Load ( SaveLoadManager& m )
 {
 	TsProcTimer t;
 	t.Start();
-	m.checkStream();
-//	releaseKB();	// we'll start a new one if necessary
-	LoadHeader(m);
-	m.checkStream();
-	LoadOptions(m);
-	m.checkStream();
-	LoadKB(m);
-	m.checkStream();
-	LoadIncremental(m);
-	m.checkStream();
+	LoadState(m);
 	t.Stop();
 	std::cout << "Reasoner internal state loaded in " << t << " sec" << std::endl;
 }
@@ -122,6 +112,35 @@ ReasoningKernel :: Load ( void )
 	Load(*pSLManager);
 }
 
+void
+ReasoningKernel :: SaveState ( SaveLoadManager& m )
+{
+	m.checkStream();
+	SaveHeader(m);
+	m.checkStream();
+	SaveOptions(m);
+	m.checkStream();
+	SaveKB(m);
+	m.checkStream();
+	SaveIncremental(m);
+	m.checkStream();
+}
+
+void
+ReasoningKernel :: LoadState ( SaveLoadManager& m )
+{
+	m.checkStream();
+//	releaseKB();	// we'll start a new one if necessary
+	LoadHeader(m);
+	m.checkStream();
+	LoadOptions(m);
+	m.checkStream();
+	LoadKB(m);
+	m.checkStream();
+	LoadIncremental(m);
+	m.checkStream();
+}
+
 //-- save/load header (Kernel.h)
 
 void
@@ -653,6 +672,7 @@ ReasoningKernel :: LoadIncremental ( SaveLoadManager& m )
 		return;
 	m.expectChar('Q');
 	Name2Sig.clear();
+	Sig2Names.clear();
 	unsigned int size = m.loadUInt();
 	for ( unsigned int j = 0; j < size; j++ )
 	{
@@ -662,9 +682,412 @@ ReasoningKernel :: LoadIncremental ( SaveLoadManager& m )
 		for ( unsigned int k = 0; k < sigSize; k++ )
 			sig->add(m.loadEntity());
 		Name2Sig[entity] = sig;
+		addSig2Names ( entity, *sig, NULL );
 	}
 }
 
+//----------------------------------------------------------
+//-- Save/Load modules and atoms (Kernel.h)
+//----------------------------------------------------------
+
+/// update FNV-1a hash H with N bytes at P
+static inline void
+hashBytes ( unsigned long long& h, const char* p, size_t n )
+{
+	for ( size_t i = 0; i < n; ++i )
+	{
+		h ^= (unsigned char)p[i];
+		h *= 1099511628211ULL;
+	}
+}
+
+/// @return fingerprint of the used axioms of the ontology O: their text and the dense IDs of their entities
+static unsigned long long
+OntologyFingerprint ( TOntology& O )
+{
+	unsigned long long h = 14695981039346656037ULL;
+	std::ostringstream text;
+	TLISPOntologyPrinter printer(text);
+	std::vector<unsigned int> ids;
+	for ( TOntology::iterator p = O.begin(), p_end = O.end(); p != p_end; ++p )
+		if ( (*p)->isUsed() )
+		{
+			text.str("");
+			(*p)->accept(printer);
+			const std::string s = text.str();
+			hashBytes ( h, s.data(), s.size() );
+			// the saved index refers to the dense IDs, so they should be the same
+			ids.clear();
+			const TSignature& sig = (*p)->getSignature();
+			for ( TSignature::iterator q = sig.begin(), q_end = sig.end(); q != q_end; ++q )
+				ids.push_back((*q)->getId());
+			std::sort ( ids.begin(), ids.end() );
+			ids.push_back(0);	// end marker
+			hashBytes ( h, reinterpret_cast<const char*>(&ids[0]), ids.size()*sizeof(unsigned int) );
+		}
+	return h;
+}
+
+/// register all the used axioms of the ontology O in M; @return their number
+static unsigned int
+registerAxioms ( TOntology& O, SaveLoadManager& m )
+{
+	m.clearPointerMaps();
+	unsigned int n = 0;
+	for ( TOntology::iterator p = O.begin(), p_end = O.end(); p != p_end; ++p )
+		if ( (*p)->isUsed() )
+		{
+			m.registerA(*p);
+			++n;
+		}
+	return n;
+}
+
+void
+ReasoningKernel :: SaveModules ( SaveLoadManager& m )
+{
+	m.o() << ModuleStateFileHeader << "\n" << bytesInInt << "\n" << OntologyFingerprint(Ontology) << "\n";
+	m.saveUInt(registerAxioms(Ontology,m));
+
+	// dense module index
+	bool saveIndex = ModSyn != NULL && ModSyn->hasModuleIndex();
+	m.o() << "\nMI";
+	m.saveUInt(saveIndex);
+	if ( saveIndex )
+		ModSyn->getModuleIndex()->Save(m);
+
+	// atomic decomposition
+	bool saveAD = AD != NULL && ADVersion == Ontology.getVersion() && AD->getAOS() != NULL;
+	m.o() << "\nAD";
+	m.saveUInt(saveAD);
+	if ( saveAD )
+	{
+		m.saveUInt(ADSemantic);
+		AD->Save(m);
+	}
+}
+
+void
+ReasoningKernel :: LoadModules ( SaveLoadManager& m, bool replaceAD )
+{
+	std::string str;
+	m.i() >> str;
+	if ( str != ModuleStateFileHeader )
+		throw EFPPSaveLoad("Incompatible save/load header");
+	int n;
+	m.i() >> n;
+	if ( n != bytesInInt )
+		throw EFPPSaveLoad("Saved file differ in word size");
+	unsigned long long fingerprint;
+	m.i() >> fingerprint;
+	if ( fingerprint != OntologyFingerprint(Ontology) || m.loadUInt() != registerAxioms(Ontology,m) )
+		throw EFPPSaveLoad("Saved modules are built for a different ontology");
+
+	// dense module index
+	m.expectChar('M');
+	m.expectChar('I');
+	if ( m.loadUInt() )
+	{
+		TModuleIndex* Index = new TModuleIndex();
+		try
+		{
+			Index->Load(m);
+		}
+		catch ( const EFPPSaveLoad& )
+		{
+			delete Index;
+			throw;
+		}
+		if ( ModSyn == NULL )
+			ModSyn = new OntologyBasedModularizer ( getOntology(), /*useSem=*/false );
+		if ( ModSyn->hasModuleIndex() )
+			delete Index;
+		else
+			ModSyn->setModuleIndex(Index);
+	}
+
+	// atomic decomposition
+	m.expectChar('A');
+	m.expectChar('D');
+	if ( m.loadUInt() )
+	{
+		bool semantic = m.loadUInt();
+		// the modularizer is not needed for the loaded AD
+		AtomicDecomposer* ad = new AtomicDecomposer(NULL);
+		try
+		{
+			ad->Load(m);
+		}
+		catch ( const EFPPSaveLoad& )
+		{
+			delete ad;
+			throw;
+		}
+		// keep the current AD unless asked otherwise
+		if ( replaceAD || AD == NULL || ADVersion != Ontology.getVersion() )
+		{
+			delete AD;
+			AD = ad;
+			ADVersion = Ontology.getVersion();
+			ADSemantic = semantic;
+		}
+		else
+			delete ad;
+	}
+}
+
+void
+ReasoningKernel :: SaveModuleState ( void )
+{
+	if ( pModSLManager == NULL )
+		return;
+	pModSLManager->prepare(/*input=*/false);
+	pModSLManager->checkStream();
+	SaveModules(*pModSLManager);
+	// the state should survive the restart of the process
+	pModSLManager->o().flush();
+	pModSLManager->checkStream();
+}
+
+bool
+ReasoningKernel :: LoadModuleState ( bool replaceAD )
+{
+	if ( pModSLManager == NULL || !pModSLManager->existsContent() )
+		return false;
+	try
+	{
+		pModSLManager->prepare(/*input=*/true);
+		pModSLManager->checkStream();
+		LoadModules ( *pModSLManager, replaceAD );
+		return true;
+	}
+	catch ( const EFPPSaveLoad& )
+	{
+		// the state is out of date or broken: drop it
+		pModSLManager->clearContent();
+		return false;
+	}
+}
+
+/// save the vector V of unsigned integers
+static void
+SaveUIntVec ( const std::vector<unsigned int>& v, SaveLoadManager& m )
+{
+	m.saveUInt(v.size());
+	for ( std::vector<unsigned int>::const_iterator p = v.begin(), p_end = v.end(); p != p_end; ++p )
+		m.saveUInt(*p);
+}
+
+/// load the vector V of unsigned integers
+static void
+LoadUIntVec ( std::vector<unsigned int>& v, SaveLoadManager& m )
+{
+	// the size is not trusted: the elements are read one by one
+	v.clear();
+	for ( unsigned int n = m.loadUInt(); n > 0; --n )
+		v.push_back(m.loadUInt());
+}
+
+/// @throw an exception about WHAT unless V is a non-decreasing sequence of offsets from 0 to SIZE
+static void
+CheckOffsets ( const std::vector<unsigned int>& v, size_t size, const char* what )
+{
+	if ( v.empty() || v.front() != 0 || v.back() != size )
+		throw EFPPSaveLoad(what);
+	for ( size_t i = 1; i < v.size(); ++i )
+		if ( v[i] < v[i-1] )
+			throw EFPPSaveLoad(what);
+}
+
+/// @throw an exception about WHAT unless all the elements of V are less than BOUND
+static void
+CheckBound ( const std::vector<unsigned int>& v, size_t bound, const char* what )
+{
+	for ( std::vector<unsigned int>::const_iterator p = v.begin(), p_end = v.end(); p != p_end; ++p )
+		if ( *p >= bound )
+			throw EFPPSaveLoad(what);
+}
+
+//----------------------------------------------------------
+//-- Implementation of the TLocalityConditions methods (tLocalityConditions.h)
+//----------------------------------------------------------
+
+void
+TLocalityConditions :: Save ( SaveLoadManager& m ) const
+{
+	for ( int k = 0; k < 4; ++k )
+	{
+		SaveUIntVec ( Start[k], m );
+		SaveUIntVec ( AllCode[k], m );
+	}
+}
+
+void
+TLocalityConditions :: Load ( SaveLoadManager& m )
+{
+	for ( int k = 0; k < 4; ++k )
+	{
+		LoadUIntVec ( Start[k], m );
+		LoadUIntVec ( AllCode[k], m );
+		CheckOffsets ( Start[k], AllCode[k].size(), "Inconsistent locality conditions" );
+		if ( Start[k].size() != Start[0].size() )
+			throw EFPPSaveLoad("Inconsistent locality conditions");
+		// every condition should be a single well-formed node
+		for ( size_t i = 0; i+1 < Start[k].size(); ++i )
+		{
+			if ( Start[k][i] == Start[k][i+1] )
+				throw EFPPSaveLoad("Malformed locality condition");
+			const unsigned int* p = &AllCode[k][0] + Start[k][i];
+			const unsigned int* end = &AllCode[k][0] + Start[k][i+1];
+			if ( !isValid ( p, end ) || p != end )
+				throw EFPPSaveLoad("Malformed locality condition");
+		}
+	}
+}
+
+//----------------------------------------------------------
+//-- Implementation of the TModuleIndex methods (tModuleIndex.h)
+//----------------------------------------------------------
+
+void
+TModuleIndex :: Save ( SaveLoadManager& m ) const
+{
+	m.o() << "\nMA";
+	m.saveUInt(Axioms.size());
+	for ( AxiomVec::const_iterator p = Axioms.begin(), p_end = Axioms.end(); p != p_end; ++p )
+		m.savePointer(*p);
+	m.o() << "\nMS";
+	SaveUIntVec ( SigStart, m );
+	SaveUIntVec ( SigIds, m );
+	m.o() << "\nME";
+	SaveUIntVec ( EntStart, m );
+	SaveUIntVec ( EntAxioms, m );
+	m.o() << "\nMN";
+	SaveUIntVec ( NonLocal[0], m );
+	SaveUIntVec ( NonLocal[1], m );
+	m.o() << "\nMC";
+	Conditions.Save(m);
+}
+
+void
+TModuleIndex :: Load ( SaveLoadManager& m )
+{
+	m.expectChar('M');
+	m.expectChar('A');
+	Axioms.clear();
+	ByAxiomId.clear();
+	for ( unsigned int n = m.loadUInt(); n > 0; --n )
+	{
+		TDLAxiom* ax = m.loadAxiom();
+		if ( ax->getId() >= ByAxiomId.size() )
+			ByAxiomId.resize ( ax->getId()+1, 0 );
+		Axioms.push_back(ax);
+		ByAxiomId[ax->getId()] = Axioms.size();
+	}
+	m.expectChar('M');
+	m.expectChar('S');
+	LoadUIntVec ( SigStart, m );
+	LoadUIntVec ( SigIds, m );
+	m.expectChar('M');
+	m.expectChar('E');
+	LoadUIntVec ( EntStart, m );
+	LoadUIntVec ( EntAxioms, m );
+	m.expectChar('M');
+	m.expectChar('N');
+	LoadUIntVec ( NonLocal[0], m );
+	LoadUIntVec ( NonLocal[1], m );
+	m.expectChar('M');
+	m.expectChar('C');
+	Conditions.Load(m);
+	if ( SigStart.size() != Axioms.size()+1 || EntStart.size() < 2 || Conditions.size() != Axioms.size() )
+		throw EFPPSaveLoad("Inconsistent module index");
+	// all the offsets and indices should be in range
+	CheckOffsets ( SigStart, SigIds.size(), "Inconsistent module index" );
+	CheckOffsets ( EntStart, EntAxioms.size(), "Inconsistent module index" );
+	CheckBound ( SigIds, EntStart.size()-1, "Entity ID out of range in module index" );
+	CheckBound ( EntAxioms, Axioms.size(), "Axiom index out of range in module index" );
+	CheckBound ( NonLocal[0], Axioms.size(), "Axiom index out of range in module index" );
+	CheckBound ( NonLocal[1], Axioms.size(), "Axiom index out of range in module index" );
+
+	// entities are restored from the axiom signatures
+	Entities.assign ( EntStart.size()-1, NULL );
+	for ( AxiomVec::const_iterator p = Axioms.begin(), p_end = Axioms.end(); p != p_end; ++p )
+	{
+		const TSignature& sig = (*p)->getSignature();
+		for ( TSignature::iterator q = sig.begin(), q_end = sig.end(); q != q_end; ++q )
+			if ( (*q)->getId() != 0 && (*q)->getId() < Entities.size() )
+				Entities[(*q)->getId()] = *q;
+	}
+}
+
+//----------------------------------------------------------
+//-- Implementation of the AtomicDecomposer methods (AtomicDecomposer.h)
+//----------------------------------------------------------
+
+/// save the axiom set AXIOMS
+static void
+SaveAxiomSet ( const TOntologyAtom::AxiomSet& Axioms, SaveLoadManager& m )
+{
+	m.saveUInt(Axioms.size());
+	for ( TOntologyAtom::AxiomSet::const_iterator p = Axioms.begin(), p_end = Axioms.end(); p != p_end; ++p )
+		m.savePointer(*p);
+}
+
+void
+AtomicDecomposer :: Save ( SaveLoadManager& m ) const
+{
+	m.saveUInt(type);
+	m.o() << "(" << nChecks << ")";
+	m.saveUInt(AOS->size());
+	for ( unsigned int i = 0; i < AOS->size(); ++i )
+	{
+		const TOntologyAtom* atom = (*AOS)[i];
+		m.o() << "\nA";
+		SaveAxiomSet ( atom->getAtomAxioms(), m );
+		SaveAxiomSet ( atom->getModule(), m );
+		const TOntologyAtom::AtomSet& Dep = atom->getDepAtoms();
+		m.saveUInt(Dep.size());
+		for ( TOntologyAtom::AtomSet::const_iterator p = Dep.begin(), p_end = Dep.end(); p != p_end; ++p )
+			m.saveUInt((*p)->getId());
+	}
+}
+
+void
+AtomicDecomposer :: Load ( SaveLoadManager& m )
+{
+	unsigned int t = m.loadUInt();
+	if ( t > M_STAR )
+		throw EFPPSaveLoad("Unknown module type of the atomic decomposition");
+	type = (ModuleType)t;
+	m.expectChar('(');
+	m.i() >> nChecks;
+	m.expectChar(')');
+	delete AOS;
+	AOS = new AOStructure();
+	unsigned int size = m.loadUInt(), n;
+	for ( n = 0; n < size; ++n )
+		AOS->newAtom();
+	for ( unsigned int i = 0; i < size; ++i )
+	{
+		TOntologyAtom* atom = (*AOS)[i];
+		m.expectChar('A');
+		for ( n = m.loadUInt(); n > 0; --n )
+			atom->addAxiom(m.loadAxiom());
+		TOntologyAtom::AxiomSet Module;
+		for ( n = m.loadUInt(); n > 0; --n )
+			Module.push_back(m.loadAxiom());
+		atom->setModule(Module);
+		for ( n = m.loadUInt(); n > 0; --n )
+		{
+			unsigned int dep = m.loadUInt();
+			if ( dep >= size )
+				throw EFPPSaveLoad("Cannot load unregistered atom");
+			atom->addDepAtom((*AOS)[dep]);
+		}
+	}
+	AOS->reduceGraph();
+}
+
 //----------------------------------------------------------
 //-- Implementation of the TNamedEntry methods (tNamedEntry.h)
 //----------------------------------------------------------
@@ -819,6 +1242,28 @@ Taxonomy :: Save ( SaveLoadManager& m, const std::set<const TNamedEntry*>& exclu
 	for ( p = p_beg; p != p_end; ++p )
 //		if ( excluded.count((*p)->getPrimer()) == 0 )
 			(*p)->SaveNeighbours(m);
+
+	// save the instance buckets
+	for ( p = p_beg; p != p_end; ++p )
+	{
+		const InstanceVec* bucket = getInstances(*p);
+		m.saveUInt ( bucket == NULL ? 0 : bucket->size() );
+		if ( bucket != NULL )
+			for ( InstanceVec::const_iterator q = bucket->begin(), q_end = bucket->end(); q != q_end; ++q )
+				m.savePointer(*q);
+		m.o() << "\n";
+	}
+
+	// save the synonyms of the instances
+	m.saveUInt(InstanceSynonyms.size());
+	for ( InstanceSynMap::const_iterator q = InstanceSynonyms.begin(), q_end = InstanceSynonyms.end(); q != q_end; ++q )
+	{
+		m.savePointer(q->first);
+		m.saveUInt(q->second.size());
+		for ( InstanceVec::const_iterator r = q->second.begin(), r_end = q->second.end(); r != r_end; ++r )
+			m.savePointer(*r);
+		m.o() << "\n";
+	}
 }
 
 void
@@ -840,6 +1285,33 @@ Taxonomy :: Load ( SaveLoadManager& m )
 	// load the hierarchy
 	for ( TaxVertexVec::iterator p = Graph.begin(), p_end = Graph.end(); p < p_end; ++p )
 		(*p)->LoadNeighbours(m);
+
+	// load the instance buckets; every individual there gets its parents
+	Instances.clear();
+	InstanceSynonyms.clear();
+	for ( TaxVertexVec::iterator p = Graph.begin(), p_end = Graph.end(); p < p_end; ++p )
+		for ( unsigned int j = m.loadUInt(); j > 0; --j )
+		{
+			ClassifiableEntry* entry = static_cast<ClassifiableEntry*>(m.loadEntry());
+			entry->addTaxParent(*p);
+			Instances[*p].push_back(entry);
+		}
+
+	// load the synonyms of the instances; they have the same parents as their host
+	for ( unsigned int j = m.loadUInt(); j > 0; --j )
+	{
+		const ClassifiableEntry* host = static_cast<ClassifiableEntry*>(m.loadEntry());
+		for ( unsigned int k = m.loadUInt(); k > 0; --k )
+		{
+			ClassifiableEntry* entry = static_cast<ClassifiableEntry*>(m.loadEntry());
+			InstanceSynonyms[host].push_back(entry);
+			for ( ClassifiableEntry::parent_iterator q = host->parent_begin(), q_end = host->parent_end(); q != q_end; ++q )
+				entry->addTaxParent(*q);
+		}
+	}
+
+	// the saved taxonomy is finalised, so the queries should not be inserted there
+	willInsertIntoTaxonomy = false;
 }
 
 //----------------------------------------------------------
@@ -30,6 +30,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 class TNamedEntity;
 class TNamedEntry;
 class TaxonomyVertex;
+class TDLAxiom;
 
 class SaveLoadManager
 {
@@ -110,10 +111,14 @@ protected:	// members
 	PointerMap<TNamedEntry> neMap;
 		// uint <-> TaxonomyVertex map to update the taxonomy
 	PointerMap<TaxonomyVertex> tvMap;
+		// uint <-> axiom map for the modules and atoms
+	PointerMap<TDLAxiom> axMap;
 
 public:		// methods
 		/// init c'tor: remember the S/L name
 	SaveLoadManager ( const std::string& name ) : dirname(name), ip(NULL), op(NULL) { filename = name+".fpp.state"; }
+		/// init c'tor: remember the S/L name; use KIND as a file extension
+	SaveLoadManager ( const std::string& name, const std::string& kind ) : dirname(name), ip(NULL), op(NULL) { filename = name+".fpp."+kind; }
 		/// empty d'tor
 	~SaveLoadManager ( void )
 	{
@@ -189,11 +194,14 @@ public:		// methods
 		neMap.clear();
 		eMap.clear();
 		tvMap.clear();
+		axMap.clear();
 	}
 		/// register named entry together with entity (if available)
 	void registerE ( const TNamedEntry* p );
 		/// register taxonomy vertex
 	void registerV ( TaxonomyVertex* v ) { tvMap.add(v); }
+		/// register axiom
+	void registerA ( TDLAxiom* ax ) { axMap.add(ax); }
 
 		/// save Entry pointer
 	void savePointer ( const TNamedEntry* p ) { saveUInt(neMap.getI(p)); }
@@ -201,6 +209,8 @@ public:		// methods
 	void savePointer ( const TNamedEntity* p ) { saveUInt(eMap.getI(const_cast<TNamedEntity*>(p))); }
 		/// save Vertex pointer
 	void savePointer ( const TaxonomyVertex* p ) { saveUInt(tvMap.getI(const_cast<TaxonomyVertex*>(p))); }
+		/// save Axiom pointer
+	void savePointer ( const TDLAxiom* p ) { saveUInt(axMap.getI(p)); }
 
 		/// load Entry pointer
 	TNamedEntry* loadEntry ( void ) { return neMap.getP(loadUInt()); }
@@ -208,6 +218,8 @@ public:		// methods
 	TNamedEntity* loadEntity ( void ) { return eMap.getP(loadUInt()); }
 		/// load Vetrex pointer
 	TaxonomyVertex* loadVertex ( void ) { return tvMap.getP(loadUInt()); }
+		/// load Axiom pointer
+	TDLAxiom* loadAxiom ( void ) { return axMap.getP(loadUInt()); }
 }; // SaveLoadManager
 
 #endif
@@ -0,0 +1,196 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <pthread.h>
+#include <algorithm>
+
+#include "SemanticLocalityChecker.h"
+
+/// helper checker for the parallel batch checks
+struct SemanticLocalityChecker::Helper
+{
+		/// signature of the helper; a copy of the main one during the batch checks
+	TSignature Sig;
+		/// the checker itself
+	SemanticLocalityChecker Checker;
+		/// owner of the helper
+	SemanticLocalityChecker* Owner;
+		/// index of the first axiom of the batch to check
+	size_t First;
+		/// distance between the checked axioms
+	size_t Step;
+		/// error message if the checks fail
+	std::string Error;
+
+		/// init c'tor
+	Helper ( SemanticLocalityChecker* owner ) : Checker(&Sig), Owner(owner), First(0), Step(1) {}
+}; // Helper
+
+/// check every Step-th axiom of the owner's batch, starting from First
+void*
+SemanticLocalityChecker :: runHelper ( void* arg )
+{
+	Helper* helper = static_cast<Helper*>(arg);
+	try
+	{
+		helper->Owner->checkBatchPart ( helper->Checker, helper->First, helper->Step );
+	}
+	catch ( const EFaCTPlusPlus& e )
+	{
+		helper->Error = e.what();
+	}
+	return NULL;
+}
+
+SemanticLocalityChecker :: SemanticLocalityChecker ( const TSignature* sig, unsigned int nThreads )
+	: LocalityChecker(sig)
+	, nBatchChecks(0)
+	, nCacheHits(0)
+{
+	initKernel();
+	for ( unsigned int i = 1; i < nThreads; ++i )
+		Helpers.push_back(new Helper(this));
+}
+
+SemanticLocalityChecker :: ~SemanticLocalityChecker ( void )
+{
+	for ( std::vector<Helper*>::iterator p = Helpers.begin(), p_end = Helpers.end(); p != p_end; ++p )
+		delete *p;
+}
+
+void
+SemanticLocalityChecker :: preprocessOntology ( const AxiomVec& Axioms )
+{
+	loadOntology(Axioms);
+	Cache.clear();
+	// helpers are preprocessed here as the reasoners could not be created in parallel
+	for ( std::vector<Helper*>::iterator p = Helpers.begin(), p_end = Helpers.end(); p != p_end; ++p )
+		(*p)->Checker.loadOntology(Axioms);
+}
+
+bool
+SemanticLocalityChecker :: getCacheKey ( const TDLAxiom* axiom, CacheKey& key ) const
+{
+	// the locality depends only on the part of the signature related to the axiom
+	const TSignature& AxSig = const_cast<TDLAxiom*>(axiom)->getSignature();
+	if ( AxSig.size() > 62 )
+		return false;
+	unsigned long long mask = 0, bit = 1;
+	for ( TSignature::iterator p = AxSig.begin(), p_end = AxSig.end(); p != p_end; ++p, bit <<= 1 )
+		if ( !nc(*p) )
+			mask |= bit;
+	if ( topCLocal() )
+		mask |= 1ULL << 62;
+	if ( topRLocal() )
+		mask |= 1ULL << 63;
+	key = CacheKey(axiom,mask);
+	return true;
+}
+
+void
+SemanticLocalityChecker :: checkBatchPart ( SemanticLocalityChecker& checker, size_t first, size_t step )
+{
+	for ( size_t i = first; i < Batch.size(); i += step )
+		BatchResult[i] = checker.local(Batch[i]);
+}
+
+void
+SemanticLocalityChecker :: checkBatch ( void )
+{
+	BatchResult.assign ( Batch.size(), false );
+	size_t nWorkers = std::min ( Helpers.size()+1, Batch.size() );
+	std::vector<pthread_t> Threads(nWorkers);
+	size_t i;
+
+	// start helpers; every one of them checks every nWorkers-th axiom
+	for ( i = 1; i < nWorkers; ++i )
+	{
+		Helper* helper = Helpers[i-1];
+		helper->Sig = *getSignature();
+		helper->First = i;
+		helper->Step = nWorkers;
+		helper->Error.clear();
+		if ( pthread_create ( &Threads[i], NULL, runHelper, helper ) != 0 )
+			throw EFaCTPlusPlus("Semantic locality checker: can not create a thread");
+	}
+
+	// the checker is the first worker
+	Error.clear();
+	try
+	{
+		checkBatchPart ( *this, 0, nWorkers );
+	}
+	catch ( const EFaCTPlusPlus& e )
+	{
+		Error = e.what();
+	}
+
+	for ( i = 1; i < nWorkers; ++i )
+	{
+		pthread_join ( Threads[i], NULL );
+		if ( Error.empty() )
+			Error = Helpers[i-1]->Error;
+	}
+
+	// the message should live while the exception is processed
+	if ( !Error.empty() )
+		throw EFaCTPlusPlus(Error.c_str());
+}
+
+void
+SemanticLocalityChecker :: checkLocality ( const AxiomVec& Axioms, std::vector<bool>& Result )
+{
+	Result.resize(Axioms.size());
+	nBatchChecks += Axioms.size();
+
+	// use cached results where possible
+	std::vector<CacheKey> Keys(Axioms.size());
+	std::vector<size_t> BatchPos;
+	Batch.clear();
+	for ( size_t i = 0; i < Axioms.size(); ++i )
+	{
+		if ( getCacheKey ( Axioms[i], Keys[i] ) )
+		{
+			LocalityCache::const_iterator p = Cache.find(Keys[i]);
+			if ( p != Cache.end() )
+			{
+				++nCacheHits;
+				Result[i] = p->second;
+				continue;
+			}
+		}
+		else
+			Keys[i].first = NULL;
+		Batch.push_back(Axioms[i]);
+		BatchPos.push_back(i);
+	}
+
+	if ( Batch.empty() )
+		return;
+
+	checkBatch();
+
+	// save the results
+	for ( size_t j = 0; j < Batch.size(); ++j )
+	{
+		size_t i = BatchPos[j];
+		Result[i] = BatchResult[j];
+		if ( Keys[i].first != NULL )
+			Cache[Keys[i]] = Result[i];
+	}
+}
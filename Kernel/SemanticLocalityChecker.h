@@ -19,12 +19,25 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef SEMLOCCHECKER_H
 #define SEMLOCCHECKER_H
 
+#include <map>
+#include <string>
+
 #include "LocalityChecker.h"
 #include "Kernel.h"
 
-/// semantic locality checker for DL axioms
+/// semantic locality checker for DL axioms.
+/// Batches of axioms (see checkLocality()) are checked using a pool of helper checkers
+/// that work in parallel, each with its own reasoner; the results are cached.
 class SemanticLocalityChecker: public LocalityChecker
 {
+protected:	// types
+		/// key of a cached result: an axiom and the mask of the checked signature over the axiom signature
+	typedef std::pair<const TDLAxiom*, unsigned long long> CacheKey;
+		/// cached results of the locality checks
+	typedef std::map<CacheKey, bool> LocalityCache;
+		/// helper checker with its own signature; defined in the .cpp
+	struct Helper;
+
 protected:	// members
 		/// Reasoner to detect the tautology
 	ReasoningKernel Kernel;
@@ -32,6 +45,20 @@ protected:	// members
 	TExpressionManager* pEM;
 		/// map between axioms and concept expressions
 	std::map<const TDLAxiom*, const TDLConceptExpression*> ExprMap;
+		/// results of the batch checks
+	LocalityCache Cache;
+		/// helpers for the parallel checks (the checker itself is the first worker)
+	std::vector<Helper*> Helpers;
+		/// axioms of the current batch that are not in the cache
+	AxiomVec Batch;
+		/// results for the Batch
+	std::vector<char> BatchResult;
+		/// error message of a failed helper
+	std::string Error;
+		/// number of axioms checked in batches
+	unsigned long long nBatchChecks;
+		/// number of batch checks answered by the cache
+	unsigned long long nCacheHits;
 
 protected:	// methods
 		/// @return expression necessary to build query for a given type of an axiom; @return NULL if none necessary
@@ -56,11 +83,43 @@ protected:	// methods
 		// everything else doesn't require expression to be build
 		return NULL;
 	}
+		/// @return the expression of AXIOM built by getExpr()
+	const TDLConceptExpression* getAxiomExpr ( const TDLAxiom& axiom ) const
+	{
+		std::map<const TDLAxiom*, const TDLConceptExpression*>::const_iterator p = ExprMap.find(&axiom);
+		return p == ExprMap.end() ? NULL : p->second;
+	}
+		/// fill the cache KEY of an AXIOM wrt the current signature; @return false if the axiom is too large to be cached
+	bool getCacheKey ( const TDLAxiom* axiom, CacheKey& key ) const;
+		/// check every STEP-th axiom of the Batch starting from FIRST by a CHECKER
+	void checkBatchPart ( SemanticLocalityChecker& checker, size_t first, size_t step );
+		/// thread function of a helper
+	static void* runHelper ( void* arg );
+		/// check all the axioms of the Batch, using the helpers in parallel
+	void checkBatch ( void );
 
 public:		// interface
-		/// init c'tor
-	SemanticLocalityChecker ( const TSignature* sig ) : LocalityChecker(sig)
+		/// init c'tor; use NTHREADS threads for the batch checks
+	SemanticLocalityChecker ( const TSignature* sig, unsigned int nThreads = 1 );
+		/// d'tor
+	virtual ~SemanticLocalityChecker ( void );
+
+		/// init kernel with the ontology signature and init expression map
+	virtual void preprocessOntology ( const AxiomVec& Axioms );
+		/// check locality of all the AXIOMS wrt signature; put the results to RESULT
+	virtual void checkLocality ( const AxiomVec& Axioms, std::vector<bool>& Result );
+
+		/// get number of axioms checked in batches
+	unsigned long long getNBatchChecks ( void ) const { return nBatchChecks; }
+		/// get number of batch checks answered by the cache
+	unsigned long long getNCacheHits ( void ) const { return nCacheHits; }
+
+protected:	// methods
+		/// init the kernel
+	void initKernel ( void )
 	{
+		// the entities of the checked axioms are shared with other kernels
+		Kernel.setBindEntities(false);
 		pEM = Kernel.getExpressionManager();
 		// for tests we will need TB names to be from the OWL 2 namespace
 		pEM->setTopBottomRoles(
@@ -69,11 +128,8 @@ public:		// interface
 			"http://www.w3.org/2002/07/owl#topDataProperty",
 			"http://www.w3.org/2002/07/owl#bottomDataProperty");
 	}
-		/// empty d'tor
-	virtual ~SemanticLocalityChecker ( void ) {}
-
-		/// init kernel with the ontology signature and init expression map
-	virtual void preprocessOntology ( const AxiomVec& Axioms )
+		/// load the signature of the AXIOMS to the kernel and init expression map
+	void loadOntology ( const AxiomVec& Axioms )
 	{
 		TSignature s;
 		ExprMap.clear();
@@ -200,11 +256,11 @@ public:		// visitor interface
 	}
 	virtual void visit ( const TDLAxiomDRoleSubsumption& axiom ) { isLocal = Kernel.isSubRoles ( axiom.getSubRole(), axiom.getRole() ); }
 		// Domain(R) = C is tautology iff ER.Top [= C
-	virtual void visit ( const TDLAxiomORoleDomain& axiom ) { isLocal = Kernel.isSubsumedBy ( ExprMap[&axiom], axiom.getDomain() ); }
-	virtual void visit ( const TDLAxiomDRoleDomain& axiom ) { isLocal = Kernel.isSubsumedBy ( ExprMap[&axiom], axiom.getDomain() ); }
+	virtual void visit ( const TDLAxiomORoleDomain& axiom ) { isLocal = Kernel.isSubsumedBy ( getAxiomExpr(axiom), axiom.getDomain() ); }
+	virtual void visit ( const TDLAxiomDRoleDomain& axiom ) { isLocal = Kernel.isSubsumedBy ( getAxiomExpr(axiom), axiom.getDomain() ); }
 		// Range(R) = C is tautology iff ER.~C is unsatisfiable
-	virtual void visit ( const TDLAxiomORoleRange& axiom ) { isLocal = !Kernel.isSatisfiable(ExprMap[&axiom]); }
-	virtual void visit ( const TDLAxiomDRoleRange& axiom ) { isLocal = !Kernel.isSatisfiable(ExprMap[&axiom]); }
+	virtual void visit ( const TDLAxiomORoleRange& axiom ) { isLocal = !Kernel.isSatisfiable(getAxiomExpr(axiom)); }
+	virtual void visit ( const TDLAxiomDRoleRange& axiom ) { isLocal = !Kernel.isSatisfiable(getAxiomExpr(axiom)); }
 	virtual void visit ( const TDLAxiomRoleTransitive& axiom ) { isLocal = Kernel.isTransitive(axiom.getRole()); }
 	virtual void visit ( const TDLAxiomRoleReflexive& axiom ) { isLocal = Kernel.isReflexive(axiom.getRole()); }
 	virtual void visit ( const TDLAxiomRoleIrreflexive& axiom ) { isLocal = Kernel.isIrreflexive(axiom.getRole()); }
@@ -218,13 +274,13 @@ public:		// visitor interface
 		// for top locality, this might be local
 	virtual void visit ( const TDLAxiomInstanceOf& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), axiom.getC() ); }
 		// R(i,j) holds if {i} [= \ER.{j}
-	virtual void visit ( const TDLAxiomRelatedTo& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	virtual void visit ( const TDLAxiomRelatedTo& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(axiom) ); }
 		///!R(i,j) holds if {i} [= \AR.!{j}=!\ER.{j}
-	virtual void visit ( const TDLAxiomRelatedToNot& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	virtual void visit ( const TDLAxiomRelatedToNot& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(axiom) ); }
 		// R(i,v) holds if {i} [= \ER.{v}
-	virtual void visit ( const TDLAxiomValueOf& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	virtual void visit ( const TDLAxiomValueOf& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(axiom) ); }
 		// !R(i,v) holds if {i} [= !\ER.{v}
-	virtual void visit ( const TDLAxiomValueOfNot& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), ExprMap[&axiom] ); }
+	virtual void visit ( const TDLAxiomValueOfNot& axiom ) { isLocal = Kernel.isInstance ( axiom.getIndividual(), getAxiomExpr(axiom) ); }
 }; // SemanticLocalityChecker
 
 #endif
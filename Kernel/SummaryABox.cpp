@@ -0,0 +1,372 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+
+#include "SummaryABox.h"
+#include "Kernel.h"
+#include "Actor.h"
+#include "tSignatureUpdater.h"
+
+/// key of a group of individuals: pointers and numbers describing the group
+typedef std::vector<size_t> SummaryKey;
+
+/// role assertion as seen from one of its individuals
+struct TRoleLink
+{
+		/// the individual
+	unsigned int I;
+		/// the role
+	const TDLObjectRoleExpression* R;
+		/// true iff the assertion is R(I,J); false iff it is R(J,I)
+	bool out;
+		/// the other individual
+	unsigned int J;
+
+		/// init c'tor
+	TRoleLink ( unsigned int i, const TDLObjectRoleExpression* r, bool o, unsigned int j ) : I(i), R(r), out(o), J(j) {}
+		/// order the links by the individual, then by the role, then by the direction
+	bool operator < ( const TRoleLink& l ) const
+	{
+		if ( I != l.I )
+			return I < l.I;
+		if ( R != l.R )
+			return R < l.R;
+		if ( out != l.out )
+			return out < l.out;
+		return J < l.J;
+	}
+		/// equality
+	bool operator == ( const TRoleLink& l ) const { return I == l.I && R == l.R && out == l.out && J == l.J; }
+};
+
+/// data assertion: individual with a data role and a value
+typedef std::pair<unsigned int, std::pair<const TDLDataRoleExpression*, const TDLDataValue*> > TDataLink;
+
+/// local indices of the individuals of an ABox
+class TABoxIndex
+{
+protected:	// members
+		/// map from the dense ID of an individual to its index + 1
+	std::vector<unsigned int> Local;
+
+public:		// members
+		/// all the individuals by their indices
+	SummaryABox::IndividualVec Inds;
+		/// true for the individuals that should not be merged with others
+	std::vector<bool> Fixed;
+
+public:		// interface
+		/// init c'tor: there are no more than N named entities
+	TABoxIndex ( unsigned int n ) : Local(n,0) {}
+
+		/// @return the index of the individual I; register it if necessary
+	unsigned int get ( const TDLIndividualExpression* I )
+	{
+		const TDLIndividualName* name = dynamic_cast<const TDLIndividualName*>(I);
+		fpp_assert ( name != NULL );
+		unsigned int& id = Local[name->getId()];
+		if ( id == 0 )
+		{
+			Inds.push_back(name);
+			Fixed.push_back(false);
+			id = Inds.size();
+		}
+		return id-1;
+	}
+		/// forbid merging the individual I with others
+	void fix ( const TDLIndividualExpression* I ) { Fixed[get(I)] = true; }
+		/// forbid merging all the individuals from the signature of the axiom AX
+	void fix ( TDLAxiom* ax )
+	{
+		const TSignature& sig = ax->getSignature();
+		for ( TSignature::iterator p = sig.begin(), p_end = sig.end(); p != p_end; ++p )
+			if ( const TDLIndividualName* I = dynamic_cast<const TDLIndividualName*>(*p) )
+				fix(I);
+	}
+		/// @return true iff the individual I is registered
+	bool known ( const TDLIndividualName* I ) const { return I->getId() < Local.size() && Local[I->getId()] != 0; }
+};
+
+/// @return the conjunction of ARGS built by the expression manager EM
+static const TDLConceptExpression*
+conjunction ( TExpressionManager* pEM, const std::vector<const TDLConceptExpression*>& Args )
+{
+	if ( Args.empty() )
+		return pEM->Top();
+	if ( Args.size() == 1 )
+		return Args.front();
+	pEM->newArgList();
+	for ( std::vector<const TDLConceptExpression*>::const_iterator p = Args.begin(), p_end = Args.end(); p != p_end; ++p )
+		pEM->addArg(*p);
+	return pEM->And();
+}
+
+SummaryABox :: SummaryABox ( TOntology& Ontology, const IndividualSet& Pinned, unsigned long timeout )
+	: pEM(Ontology.getExpressionManager())
+	, Summary(new ReasoningKernel())
+	, Schema(new ReasoningKernel())
+	, Version(Ontology.getVersion())
+	, nIndividuals(0)
+	, Consistent(false)
+	, nQueries(0)
+	, nYes(0)
+	, nNo(0)
+	, nUnknown(0)
+{
+	// the entities of the axioms are shared with the main kernel
+	Summary->setBindEntities(false);
+	Summary->setOperationTimeout(timeout);
+	Schema->setBindEntities(false);
+	Schema->setOperationTimeout(timeout);
+
+	BuildTimer.Start();
+	build ( Ontology, Pinned );
+	Consistent = Summary->isKBConsistent();
+	BuildTimer.Stop();
+}
+
+SummaryABox :: ~SummaryABox ( void )
+{
+	// the TBox axioms belong to the main ontology
+	Summary->getOntology().safeClear();
+	Schema->getOntology().safeClear();
+	delete Summary;
+	delete Schema;
+	for ( AxiomVec::iterator p = SummaryAxioms.begin(), p_end = SummaryAxioms.end(); p != p_end; ++p )
+		delete *p;
+}
+
+void
+SummaryABox :: build ( TOntology& Ontology, const IndividualSet& Pinned )
+{
+	TABoxIndex Index(pEM->maxEntityId());
+	AxiomVec TBoxAxioms, KeptAxioms;
+	std::vector<std::pair<unsigned int, const TDLConceptExpression*> > Types;
+	std::vector<TDataLink> Values;
+	std::vector<TRoleLink> Links;
+	unsigned int maxId = 0;
+
+	// split the ontology into the TBox and the assertions about the individuals
+	for ( TOntology::iterator p = Ontology.begin(), p_end = Ontology.end(); p != p_end; ++p )
+	{
+		TDLAxiom* ax = *p;
+		if ( !ax->isUsed() )
+			continue;
+		maxId = std::max ( maxId, ax->getId() );
+		if ( const TDLAxiomInstanceOf* a = dynamic_cast<const TDLAxiomInstanceOf*>(ax) )
+			Types.push_back(std::make_pair(Index.get(a->getIndividual()), a->getC()));
+		else if ( const TDLAxiomRelatedTo* a = dynamic_cast<const TDLAxiomRelatedTo*>(ax) )
+		{
+			unsigned int i = Index.get(a->getIndividual()), j = Index.get(a->getRelatedIndividual());
+			Links.push_back(TRoleLink(i,a->getRelation(),true,j));
+			Links.push_back(TRoleLink(j,a->getRelation(),false,i));
+		}
+		else if ( const TDLAxiomValueOf* a = dynamic_cast<const TDLAxiomValueOf*>(ax) )
+			Values.push_back(std::make_pair(Index.get(a->getIndividual()), std::make_pair(a->getAttribute(), a->getValue())));
+		else if ( const TDLAxiomDeclaration* a = dynamic_cast<const TDLAxiomDeclaration*>(ax) )
+		{
+			if ( const TDLIndividualName* I = dynamic_cast<const TDLIndividualName*>(a->getDeclaration()) )
+				Index.get(I);
+			else
+				TBoxAxioms.push_back(ax);
+		}
+		else if ( dynamic_cast<const TDLAxiomRelatedToNot*>(ax) != NULL
+				  || dynamic_cast<const TDLAxiomValueOfNot*>(ax) != NULL
+				  || dynamic_cast<const TDLAxiomSameIndividuals*>(ax) != NULL
+				  || dynamic_cast<const TDLAxiomDifferentIndividuals*>(ax) != NULL )
+		{
+			// merging of these individuals could make the summary inconsistent
+			Index.fix(ax);
+			KeptAxioms.push_back(ax);
+		}
+		else
+		{
+			// the individuals of the TBox are nominals, so they keep their identity
+			Index.fix(ax);
+			TBoxAxioms.push_back(ax);
+		}
+	}
+	for ( IndividualSet::const_iterator p = Pinned.begin(), p_end = Pinned.end(); p != p_end; ++p )
+		if ( Index.known(*p) )
+			Index.fix(*p);
+
+	nIndividuals = Index.Inds.size();
+	std::sort ( Types.begin(), Types.end() );
+	Types.erase ( std::unique ( Types.begin(), Types.end() ), Types.end() );
+	std::sort ( Values.begin(), Values.end() );
+	Values.erase ( std::unique ( Values.begin(), Values.end() ), Values.end() );
+	std::sort ( Links.begin(), Links.end() );
+	Links.erase ( std::unique ( Links.begin(), Links.end() ), Links.end() );
+
+	// group the individuals by the told types and the data values
+	std::vector<unsigned int> Group(nIndividuals);
+	std::vector<const TDLConceptExpression*> GroupDescription;
+	std::map<SummaryKey, unsigned int> Groups;
+	size_t t = 0, v = 0;
+	for ( unsigned int i = 0; i < nIndividuals; ++i )
+	{
+		SummaryKey key;
+		std::vector<const TDLConceptExpression*> Args;
+		for ( ; t < Types.size() && Types[t].first == i; ++t )
+		{
+			key.push_back((size_t)Types[t].second);
+			Args.push_back(Types[t].second);
+		}
+		key.push_back(0);
+		for ( ; v < Values.size() && Values[v].first == i; ++v )
+		{
+			key.push_back((size_t)Values[v].second.first);
+			key.push_back((size_t)Values[v].second.second);
+			Args.push_back(pEM->Value(Values[v].second.first,Values[v].second.second));
+		}
+		std::pair<std::map<SummaryKey, unsigned int>::iterator, bool> ins = Groups.insert(std::make_pair(key,GroupDescription.size()));
+		if ( ins.second )
+			GroupDescription.push_back(conjunction(pEM,Args));
+		Group[i] = ins.first->second;
+	}
+
+	// merge the individuals of the same group with the same role links to the same groups;
+	// the fixed individuals are targets on their own, with the numbers after the groups
+	unsigned int nGroups = GroupDescription.size();
+	for ( unsigned int i = 0; i < nIndividuals; ++i )
+		if ( Index.Fixed[i] )
+			GroupDescription.push_back(pEM->And(GroupDescription[Group[i]],pEM->OneOf(Index.Inds[i])));
+	NodeOf.assign(pEM->maxEntityId(),0);
+	std::map<SummaryKey, unsigned int> Shapes;
+	std::vector<unsigned int> NodeOfLocal(nIndividuals), Target(nIndividuals);
+	for ( unsigned int i = 0, f = nGroups; i < nIndividuals; ++i )
+		Target[i] = Index.Fixed[i] ? f++ : Group[i];
+	size_t l = 0;
+	for ( unsigned int i = 0; i < nIndividuals; ++i )
+	{
+		std::vector<TRoleLink> Shape;
+		for ( ; l < Links.size() && Links[l].I == i; ++l )
+			Shape.push_back(TRoleLink(0,Links[l].R,Links[l].out,Target[Links[l].J]));
+		std::sort ( Shape.begin(), Shape.end() );
+		Shape.erase ( std::unique ( Shape.begin(), Shape.end() ), Shape.end() );
+
+		unsigned int n = Nodes.size();
+		if ( !Index.Fixed[i] )
+		{
+			SummaryKey key(1,Group[i]);
+			for ( std::vector<TRoleLink>::const_iterator p = Shape.begin(), p_end = Shape.end(); p != p_end; ++p )
+			{
+				key.push_back((size_t)p->R);
+				key.push_back(p->out);
+				key.push_back(p->J);
+			}
+			n = Shapes.insert(std::make_pair(key,n)).first->second;
+		}
+		if ( n == Nodes.size() )	// new node
+		{
+			std::vector<const TDLConceptExpression*> Args(1,GroupDescription[Group[i]]);
+			for ( std::vector<TRoleLink>::const_iterator p = Shape.begin(), p_end = Shape.end(); p != p_end; ++p )
+				Args.push_back(pEM->Exists ( p->out ? p->R : pEM->Inverse(p->R), GroupDescription[p->J] ));
+			Nodes.push_back(Node());
+			Nodes.back().Description = conjunction(pEM,Args);
+			Nodes.back().Fixed = Index.Fixed[i];
+			RepIndex[Index.Inds[i]->getName()] = n;
+		}
+		Nodes[n].Members.push_back(Index.Inds[i]);
+		NodeOf[Index.Inds[i]->getId()] = n+1;
+		NodeOfLocal[i] = n;
+	}
+
+	// the summary ABox is the image of the ABox: assertions about the representatives of the nodes
+	// the fixed individuals might appear in the descriptions, so the TBox kernel should know them
+	AxiomVec SchemaAxioms(TBoxAxioms);
+	for ( std::vector<Node>::const_iterator p = Nodes.begin(), p_end = Nodes.end(); p != p_end; ++p )
+	{
+		SummaryAxioms.push_back(new TDLAxiomDeclaration(p->Members.front()));
+		if ( p->Fixed )
+			SchemaAxioms.push_back(SummaryAxioms.back());
+	}
+	// the roles and the concepts of the assertions might not appear in the TBox, but they are in the descriptions
+	TSignature Sig;
+	TExpressionSignatureUpdater Updater(Sig);
+	for ( std::vector<Node>::const_iterator p = Nodes.begin(), p_end = Nodes.end(); p != p_end; ++p )
+		p->Description->accept(Updater);
+	for ( TSignature::iterator p = Sig.begin(), p_end = Sig.end(); p != p_end; ++p )
+		if ( dynamic_cast<const TDLIndividualName*>(*p) == NULL )
+		{
+			SummaryAxioms.push_back(new TDLAxiomDeclaration(dynamic_cast<const TDLExpression*>(*p)));
+			SchemaAxioms.push_back(SummaryAxioms.back());
+		}
+	for ( size_t i = 0; i < Types.size(); ++i )
+		if ( Nodes[NodeOfLocal[Types[i].first]].Members.front() == Index.Inds[Types[i].first] )
+			SummaryAxioms.push_back(new TDLAxiomInstanceOf(Index.Inds[Types[i].first],Types[i].second));
+	for ( size_t i = 0; i < Values.size(); ++i )
+		if ( Nodes[NodeOfLocal[Values[i].first]].Members.front() == Index.Inds[Values[i].first] )
+			SummaryAxioms.push_back(new TDLAxiomValueOf(Index.Inds[Values[i].first],Values[i].second.first,Values[i].second.second));
+	std::vector<TRoleLink> NodeLinks;
+	for ( std::vector<TRoleLink>::const_iterator p = Links.begin(), p_end = Links.end(); p != p_end; ++p )
+		if ( p->out )
+			NodeLinks.push_back(TRoleLink(NodeOfLocal[p->I],p->R,true,NodeOfLocal[p->J]));
+	std::sort ( NodeLinks.begin(), NodeLinks.end() );
+	NodeLinks.erase ( std::unique ( NodeLinks.begin(), NodeLinks.end() ), NodeLinks.end() );
+	for ( std::vector<TRoleLink>::const_iterator p = NodeLinks.begin(), p_end = NodeLinks.end(); p != p_end; ++p )
+		SummaryAxioms.push_back(new TDLAxiomRelatedTo(Nodes[p->I].Members.front(),p->R,Nodes[p->J].Members.front()));
+	for ( AxiomVec::iterator p = SummaryAxioms.begin(), p_end = SummaryAxioms.end(); p != p_end; ++p )
+		(*p)->setId(++maxId);
+
+	AxiomVec All(TBoxAxioms);
+	All.insert ( All.end(), KeptAxioms.begin(), KeptAxioms.end() );
+	All.insert ( All.end(), SummaryAxioms.begin(), SummaryAxioms.end() );
+	Summary->getOntology().setShared(All);
+	Schema->getOntology().setShared(SchemaAxioms);
+}
+
+SummaryABox::Answer
+SummaryABox :: checkDescription ( unsigned int n, const TDLConceptExpression* C )
+{
+	return Schema->isSubsumedBy ( Nodes[n].Description, C ) ? saYes : saUnknown;
+}
+
+void
+SummaryABox :: answer ( const TDLConceptExpression* C, std::vector<Answer>& Answers )
+{
+	++nQueries;
+	Answers.assign ( Nodes.size(), saNo );
+	Actor actor;
+	actor.needIndividuals();
+	Summary->getInstances ( C, actor );
+	Actor::Array1D Found;
+	actor.getFoundData(Found);
+	for ( Actor::Array1D::const_iterator p = Found.begin(), p_end = Found.end(); p != p_end; ++p )
+	{
+		std::map<std::string, unsigned int>::const_iterator q = RepIndex.find((*p)->getName());
+		if ( q != RepIndex.end() )
+			Answers[q->second] = checkDescription ( q->second, C );
+	}
+	for ( unsigned int n = 0; n < Nodes.size(); ++n )
+		count ( Answers[n], Nodes[n].Members.size() );
+}
+
+SummaryABox::Answer
+SummaryABox :: answer ( const TDLIndividualName* I, const TDLConceptExpression* C )
+{
+	unsigned int id = I->getId();
+	if ( id >= NodeOf.size() || NodeOf[id] == 0 )
+		return saUnknown;
+	++nQueries;
+	unsigned int n = NodeOf[id]-1;
+	Answer ret = Summary->isSubsumedBy ( pEM->OneOf(Nodes[n].Members.front()), C ) ? checkDescription ( n, C ) : saNo;
+	count ( ret, 1 );
+	return ret;
+}
@@ -0,0 +1,169 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef SUMMARYABOX_H
+#define SUMMARYABOX_H
+
+#include <vector>
+#include <set>
+#include <map>
+#include <string>
+#include <ostream>
+
+#include "tDLAxiom.h"
+#include "tDLExpression.h"
+#include "procTimer.h"
+
+class ReasoningKernel;
+class TOntology;
+class TExpressionManager;
+
+/// summary of the ABox of an ontology. The individuals with the same told types, the same data values
+/// and the same shape of the role assertions (roles and told types of the neighbours) are merged into
+/// one summary node. The summary ABox is the image of the ABox under this mapping, so every model of
+/// the summary ABox is a model of the ontology. Hence the ontology is consistent if the summary is,
+/// and an individual is not an instance of C if its summary node is not. A positive answer for a node
+/// is exact if the description of the node (its told types and the existential restrictions given by
+/// its role assertions) is subsumed by C wrt the TBox; otherwise the node is ambiguous and its
+/// individuals should be checked against the whole ontology. The individuals that are used in the
+/// TBox, in the negative and equality assertions and in the queries are never merged, and the role
+/// assertions with them are told apart by the individual rather than by its told types.
+class SummaryABox
+{
+public:		// types
+		/// vector of the individual names
+	typedef std::vector<const TDLIndividualName*> IndividualVec;
+		/// set of the individual names
+	typedef std::set<const TDLIndividualName*> IndividualSet;
+		/// answer of the summary to an instance query
+	enum Answer { saNo, saYes, saUnknown };
+
+protected:	// types
+		/// summary node
+	struct Node
+	{
+			/// merged individuals; the first one represents the node in the summary ABox
+		IndividualVec Members;
+			/// description that holds for every member of the node
+		const TDLConceptExpression* Description;
+			/// true iff the individual of the node should not be merged with others
+		bool Fixed;
+	};
+
+protected:	// members
+		/// expression manager of the ontology
+	TExpressionManager* pEM;
+		/// kernel with the TBox and the summary ABox
+	ReasoningKernel* Summary;
+		/// kernel with the TBox only
+	ReasoningKernel* Schema;
+		/// axioms of the summary ABox (owned)
+	AxiomVec SummaryAxioms;
+		/// summary nodes
+	std::vector<Node> Nodes;
+		/// map from the dense ID of an individual to its node + 1; 0 if the individual is not in the ABox
+	std::vector<unsigned int> NodeOf;
+		/// map from the name of the representative of a node to the node
+	std::map<std::string, unsigned int> RepIndex;
+		/// version of the ontology the summary was built for
+	unsigned long Version;
+		/// number of the individuals in the ABox
+	size_t nIndividuals;
+		/// true iff the summary ABox is consistent
+	bool Consistent;
+		/// time of building the summary and checking its consistency
+	TsProcTimer BuildTimer;
+
+	// statistics of the queries
+
+		/// number of the answered instance queries
+	unsigned long nQueries;
+		/// number of the individuals answered positively by the summary
+	unsigned long nYes;
+		/// number of the individuals answered negatively by the summary
+	unsigned long nNo;
+		/// number of the individuals from the ambiguous nodes
+	unsigned long nUnknown;
+
+private:	// no copy
+		/// no copy c'tor
+	SummaryABox ( const SummaryABox& );
+		/// no assignment
+	SummaryABox& operator = ( const SummaryABox& );
+
+protected:	// methods
+		/// build the summary of the ONTOLOGY where individuals from PINNED are not merged
+	void build ( TOntology& Ontology, const IndividualSet& Pinned );
+		/// @return the answer for a node N that is an instance of C in the summary ABox
+	Answer checkDescription ( unsigned int n, const TDLConceptExpression* C );
+		/// count N individuals with the answer ANS in the statistics
+	void count ( Answer ans, size_t n )
+	{
+		switch ( ans )
+		{
+		case saYes: nYes += n; break;
+		case saNo: nNo += n; break;
+		default: nUnknown += n; break;
+		}
+	}
+
+public:		// interface
+		/// init c'tor: summarise the ABox of the ONTOLOGY keeping the PINNED individuals apart; TIMEOUT is for the single tests
+	SummaryABox ( TOntology& Ontology, const IndividualSet& Pinned, unsigned long timeout );
+		/// d'tor
+	~SummaryABox ( void );
+
+		/// @return the version of the ontology the summary was built for
+	unsigned long getVersion ( void ) const { return Version; }
+		/// @return true iff the summary ABox is consistent (and so is the ontology)
+	bool isConsistent ( void ) const { return Consistent; }
+		/// @return true iff the individual I is kept apart from others (or it is not in the ABox)
+	bool isFixed ( const TDLIndividualName* I ) const
+	{
+		unsigned int id = I->getId();
+		return id >= NodeOf.size() || NodeOf[id] == 0 || Nodes[NodeOf[id]-1].Fixed;
+	}
+		/// @return number of the summary nodes
+	size_t size ( void ) const { return Nodes.size(); }
+		/// @return the individuals merged into the node N
+	const IndividualVec& getMembers ( unsigned int n ) const { return Nodes[n].Members; }
+
+		/// set ANSWERS to the answer of every node to the instance query C
+	void answer ( const TDLConceptExpression* C, std::vector<Answer>& Answers );
+		/// @return the answer to the query whether I is an instance of C
+	Answer answer ( const TDLIndividualName* I, const TDLConceptExpression* C );
+
+		/// print the statistics of the summary
+	void PrintStat ( std::ostream& o ) const
+	{
+		size_t nFixed = 0;
+		for ( std::vector<Node>::const_iterator p = Nodes.begin(), p_end = Nodes.end(); p != p_end; ++p )
+			if ( p->Fixed )
+				++nFixed;
+		o << "Summary ABox: " << nIndividuals << " individuals in " << Nodes.size() << " nodes (" << nFixed
+		  << " fixed); built in " << BuildTimer << " seconds";
+		if ( !Consistent )
+			o << "; the summary is inconsistent";
+		o << "\n";
+		if ( nQueries > 0 )
+			o << "Summary ABox queries: " << nQueries << "; " << nYes << " individuals answered positively, "
+			  << nNo << " negatively, " << nUnknown << " ambiguous\n";
+	}
+}; // SummaryABox
+
+#endif
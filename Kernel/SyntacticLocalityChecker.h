@@ -87,6 +87,8 @@ protected:	// methods
 public:		// interface
 		/// init c'tor
 	BotEquivalenceEvaluator ( const TSignature* s ) : SigAccessor(s), isBotEq(false) {}
+		/// init c'tor for the bitset signatures
+	BotEquivalenceEvaluator ( const TDenseSignature* s ) : SigAccessor(s), isBotEq(false) {}
 		/// empty d'tor
 	virtual ~BotEquivalenceEvaluator ( void ) {}
 
@@ -270,6 +272,8 @@ protected:	// methods
 public:		// interface
 		/// init c'tor
 	TopEquivalenceEvaluator ( const TSignature* s ) : SigAccessor(s), isTopEq(false) {}
+		/// init c'tor for the bitset signatures
+	TopEquivalenceEvaluator ( const TDenseSignature* s ) : SigAccessor(s), isTopEq(false) {}
 		/// empty d'tor
 	virtual ~TopEquivalenceEvaluator ( void ) {}
 
@@ -421,6 +425,15 @@ public:		// interface
 	{
 		TopEval.setBotEval(&BotEval);
 		BotEval.setTopEval(&TopEval);
+	}
+		/// init c'tor for the bitset signatures
+	SyntacticLocalityChecker ( const TDenseSignature* s )
+		: GeneralSyntacticLocalityChecker(s)
+		, TopEval(s)
+		, BotEval(s)
+	{
+		TopEval.setBotEval(&BotEval);
+		BotEval.setTopEval(&TopEval);
 	}
 		/// empty d'tor
 	virtual ~SyntacticLocalityChecker ( void ) {}
@@ -20,6 +20,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 |* Implementation of taxonomy building for the FaCT++  *|
 \*******************************************************/
 
+#include <algorithm>
+
 #include "Taxonomy.h"
 #include "logging.h"
 
@@ -44,6 +46,50 @@ void Taxonomy :: print ( std::ostream& o ) const
 		if ( likely((*p)->isInUse()) )
 			(*p)->print(o);
 	getBottomVertex()->print(o);
+
+	if ( Instances.empty() )
+		return;
+
+	o << "\nInstance buckets are in format:\n\"entry\" [k: instance_1 ... instance_k]\n\n";
+
+	printInstances ( o, getTopVertex() );
+	for ( TVSet::const_iterator p = sorted.begin(), p_end = sorted.end(); p != p_end; ++p )
+		if ( likely((*p)->isInUse()) )
+			printInstances ( o, *p );
+}
+
+/// structure to sort entries by name
+struct EntryNameLess
+{
+	bool operator()(const ClassifiableEntry* e1, const ClassifiableEntry* e2) const
+		{ return strcmp(e1->getName(), e2->getName()) < 0; }
+};
+
+void Taxonomy :: printInstances ( std::ostream& o, const TaxonomyVertex* v ) const
+{
+	const InstanceVec* bucket = getInstances(v);
+	if ( bucket == NULL )
+		return;
+
+	o << '"' << v->getPrimer()->getName() << "\" [" << bucket->size() << ":";
+
+	InstanceVec sorted(*bucket);
+	std::sort ( sorted.begin(), sorted.end(), EntryNameLess() );
+	for ( InstanceVec::const_iterator p = sorted.begin(), p_end = sorted.end(); p != p_end; ++p )
+	{
+		InstanceSynMap::const_iterator syn = InstanceSynonyms.find(*p);
+		if ( syn == InstanceSynonyms.end() )
+			o << " \"" << (*p)->getName() << '"';
+		else
+		{
+			o << " (\"" << (*p)->getName();
+			for ( InstanceVec::const_iterator q = syn->second.begin(), q_end = syn->second.end(); q != q_end; ++q )
+				o << "\"=\"" << (*q)->getName();
+			o << "\")";
+		}
+	}
+
+	o << "]\n";
 }
 
 //---------------------------------------------------
@@ -64,6 +110,27 @@ Taxonomy :: addCurrentToSynonym ( TaxonomyVertex* syn )
 	}
 }
 
+void
+Taxonomy :: addCurrentToSynonymOf ( const ClassifiableEntry* syn )
+{
+	if ( syn->getTaxVertex() != NULL )
+	{
+		addCurrentToSynonym(syn->getTaxVertex());
+		return;
+	}
+
+	// SYN is in the instance buckets: the current entry is not a part of the graph as well
+	const ClassifiableEntry* curEntry = Current->getPrimer();
+	const_cast<ClassifiableEntry*>(curEntry)->setTaxVertex(NULL);
+	if ( !queryMode() )
+	{
+		addInstanceSynonym ( syn, curEntry );
+
+		if ( LLM.isWritable(llTaxInsert) )
+			LL << "\nTAX:set instance " << curEntry->getName() << " equal " << syn->getName();
+	}
+}
+
 /// insert current node either directly or as a synonym
 void
 Taxonomy :: finishCurrentNode ( void )
@@ -80,6 +147,30 @@ Taxonomy :: finishCurrentNode ( void )
 	}
 }
 
+/// put current entry into the instance buckets of the current's parents
+void
+Taxonomy :: finishCurrentInstance ( void )
+{
+	const ClassifiableEntry* curEntry = Current->getPrimer();
+	// the entry is not a part of the graph, so it doesn't need the current node after that
+	const_cast<ClassifiableEntry*>(curEntry)->setTaxVertex(NULL);
+	if ( queryMode() )
+		return;
+
+	fpp_assert ( Current->noNeighbours(/*upDirection=*/false) );
+	if ( Current->noNeighbours(/*upDirection=*/true) )	// every individual is an instance of TOP
+		Current->addNeighbour ( /*upDirection=*/true, getTopVertex() );
+	addInstance ( curEntry, Current->begin(/*upDirection=*/true), Current->end(/*upDirection=*/true) );
+
+	CHECK_LL_RETURN(llTaxInsert);
+
+	LL << "\nTAX:inserting instance '" << curEntry->getName() << "' with up = {";
+
+	for ( TaxonomyVertex::const_iterator u = Current->begin(/*upDirection=*/true), u_end = Current->end(/*upDirection=*/true); u != u_end; ++u )
+		LL << ( u == Current->begin(/*upDirection=*/true) ? "" : "," ) << (*u)->getPrimer()->getName();
+	LL << "}";
+}
+
 bool Taxonomy :: processSynonym ( void )
 {
 	const ClassifiableEntry* curEntry = Current->getPrimer();
@@ -88,9 +179,9 @@ bool Taxonomy :: processSynonym ( void )
 	if ( syn == curEntry )
 		return false;	// not a synonym
 
-	// update synonym vertex:
-	fpp_assert ( syn->getTaxVertex() != NULL );
-	addCurrentToSynonym(syn->getTaxVertex());
+	// update synonym vertex (or the synonyms in the instance buckets):
+	fpp_assert ( syn->isClassified() );
+	addCurrentToSynonymOf(syn);
 
 	return true;
 }
@@ -120,3 +211,117 @@ Taxonomy :: deFinalise ( void )
 	bot->clearLinks(upDirection);
 	willInsertIntoTaxonomy = true;	// it's possible again to add entries
 }
+
+//---------------------------------------------------
+// instance buckets
+//---------------------------------------------------
+
+/// add ENTRY to the synonyms of HOST from the instance buckets
+void
+Taxonomy :: addInstanceSynonym ( const ClassifiableEntry* host, const ClassifiableEntry* entry )
+{
+	host = getInstanceHost(host);
+	InstanceSynonyms[host].push_back(entry);
+	// the synonym has the same types as its host, but it is not in the buckets itself
+	for ( ClassifiableEntry::parent_iterator p = host->parent_begin(), p_end = host->parent_end(); p != p_end; ++p )
+		const_cast<ClassifiableEntry*>(entry)->addTaxParent(*p);
+}
+
+/// remove ENTRY from the instance bucket V
+static void
+removeFromBucket ( std::vector<const ClassifiableEntry*>& bucket, const ClassifiableEntry* entry )
+{
+	std::vector<const ClassifiableEntry*>::iterator p = std::find ( bucket.begin(), bucket.end(), entry );
+	if ( p != bucket.end() )
+	{
+		*p = bucket.back();
+		bucket.pop_back();
+	}
+}
+
+/// remove ENTRY from the instance buckets
+void
+Taxonomy :: removeInstance ( const ClassifiableEntry* entry )
+{
+	const ClassifiableEntry* host = getInstanceHost(entry);
+	InstanceSynMap::iterator syn = InstanceSynonyms.find(host);
+
+	if ( host != entry )	// just a synonym: remove it from the host's list
+	{
+		removeFromBucket ( syn->second, entry );
+		if ( syn->second.empty() )
+			InstanceSynonyms.erase(syn);
+	}
+	else
+	{
+		// the first synonym (if any) replaces ENTRY in the buckets
+		const ClassifiableEntry* next = NULL;
+		if ( syn != InstanceSynonyms.end() )
+		{
+			InstanceVec rest;
+			rest.swap(syn->second);
+			InstanceSynonyms.erase(syn);
+			next = rest.front();
+			if ( rest.size() > 1 )
+				InstanceSynonyms[next].assign ( rest.begin()+1, rest.end() );
+		}
+		for ( ClassifiableEntry::parent_iterator p = entry->parent_begin(), p_end = entry->parent_end(); p != p_end; ++p )
+		{
+			InstanceVec& bucket = Instances[*p];
+			removeFromBucket ( bucket, entry );
+			if ( next != NULL )
+				bucket.push_back(next);
+			else if ( bucket.empty() )
+				Instances.erase(*p);
+		}
+	}
+
+	const_cast<ClassifiableEntry*>(entry)->clearTaxParents();
+}
+
+/// move the instances of the vertex FROM into the instance bucket of the vertex TO
+void
+Taxonomy :: moveInstances ( TaxonomyVertex* from, TaxonomyVertex* to )
+{
+	InstanceMap::iterator p = Instances.find(from);
+	if ( p == Instances.end() )
+		return;
+
+	InstanceVec moved;
+	moved.swap(p->second);
+	Instances.erase(p);
+
+	for ( InstanceVec::const_iterator q = moved.begin(), q_end = moved.end(); q != q_end; ++q )
+	{
+		// replace FROM with TO in the parents of the entry and of all its synonyms
+		InstanceVec group(1,*q);
+		InstanceSynMap::const_iterator syn = InstanceSynonyms.find(*q);
+		if ( syn != InstanceSynonyms.end() )
+			group.insert ( group.end(), syn->second.begin(), syn->second.end() );
+		bool hasTo = std::find ( (*q)->parent_begin(), (*q)->parent_end(), to ) != (*q)->parent_end();
+		for ( InstanceVec::const_iterator e = group.begin(), e_end = group.end(); e != e_end; ++e )
+		{
+			ClassifiableEntry* entry = const_cast<ClassifiableEntry*>(*e);
+			ClassifiableEntry::parentSet parents ( entry->parent_begin(), entry->parent_end() );
+			entry->clearTaxParents();
+			for ( ClassifiableEntry::parent_iterator r = parents.begin(), r_end = parents.end(); r != r_end; ++r )
+				if ( *r != from )
+					entry->addTaxParent(*r);
+			if ( !hasTo )
+				entry->addTaxParent(to);
+		}
+		if ( !hasTo )
+			Instances[to].push_back(*q);
+	}
+}
+
+/// @return the entry that represents ENTRY and its synonyms in the instance buckets
+const ClassifiableEntry*
+Taxonomy :: getInstanceHost ( const ClassifiableEntry* entry ) const
+{
+	// same individuals are rare, so just look through all of them
+	for ( InstanceSynMap::const_iterator p = InstanceSynonyms.begin(), p_end = InstanceSynonyms.end(); p != p_end; ++p )
+		if ( std::find ( p->second.begin(), p->second.end(), entry ) != p->second.end() )
+			return p->first;
+	return entry;
+}
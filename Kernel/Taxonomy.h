@@ -21,6 +21,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
 // taxonomy graph for DL
 
+#include <map>
+
 #include "taxVertex.h"
 
 class SaveLoadManager;
@@ -30,12 +32,26 @@ class Taxonomy
 protected:	// typedefs
 		/// type for a vector of TaxVertex
 	typedef std::vector<TaxonomyVertex*> TaxVertexVec;
+		/// type for the entries of an instance bucket
+	typedef std::vector<const ClassifiableEntry*> InstanceVec;
+		/// type for the instance buckets of the vertices
+	typedef std::map<const TaxonomyVertex*, InstanceVec> InstanceMap;
+		/// type for the synonyms of the entries from the instance buckets
+	typedef std::map<const ClassifiableEntry*, InstanceVec> InstanceSynMap;
 
 protected:	// members
 		/// array of taxonomy vertices
 	TaxVertexVec Graph;
 		/// vertex with parent Top and child Bot, represents the fresh entity
 	TaxonomyVertex FreshNode;
+		/// vertex that represents an entry from the instance buckets in the queries
+	TaxonomyVertex InstanceNode;
+		/// instance buckets: the entries (individuals) kept apart from the graph by their direct parents
+	InstanceMap Instances;
+		/// synonyms of the entries in the instance buckets; they are not in the buckets themselves
+	InstanceSynMap InstanceSynonyms;
+		/// empty set of synonyms
+	const InstanceVec NoSynonyms;
 
 		/// labeller for marking nodes as checked
 	TLabeller visitedLabel;
@@ -63,8 +79,18 @@ public:		// classification interface
 	void addCurrentToSynonym ( TaxonomyVertex* syn );
 		/// remove node from the taxonomy; assume no references to the node
 	void removeNode ( TaxonomyVertex* node ) { node->setInUse(false); }
+		/// add current entry to the synonyms of a classified entry SYN (that might be in the instance buckets)
+	void addCurrentToSynonymOf ( const ClassifiableEntry* syn );
 		/// insert current node either directly or as a synonym
 	void finishCurrentNode ( void );
+		/// put current entry into the instance buckets of the current's parents
+	void finishCurrentInstance ( void );
+		/// clear the current node (together with its instance bucket)
+	void clearCurrent ( void )
+	{
+		Current->clear();
+		Instances.erase(Current);
+	}
 
 		/// @return true if taxonomy works in a query mode (no need to insert query vertex)
 	bool queryMode ( void ) const { return !willInsertIntoTaxonomy; }
@@ -102,6 +128,49 @@ protected:	// methods
 		for ( TaxonomyVertex::iterator p = node->begin(upDirection), p_end = node->end(upDirection); p != p_end; ++p )
 			getRelativesInfoRec<onlyDirect, upDirection> ( *p, actor );
 	}
+		/// @return the instance bucket of NODE or NULL if it is empty
+	const InstanceVec* getInstances ( const TaxonomyVertex* node ) const
+	{
+		InstanceMap::const_iterator p = Instances.find(node);
+		return p == Instances.end() ? NULL : &p->second;
+	}
+		/// apply ACTOR to an ENTRY from the instance bucket together with its synonyms
+	template<class Actor>
+	bool applyToInstance ( const ClassifiableEntry* entry, Actor& actor ) const
+	{
+		InstanceSynMap::const_iterator p = InstanceSynonyms.find(entry);
+		if ( p == InstanceSynonyms.end() )
+			return actor.apply ( entry, NoSynonyms.begin(), NoSynonyms.end() );
+		return actor.apply ( entry, p->second.begin(), p->second.end() );
+	}
+		/// apply ACTOR to all the entries from the instance bucket of NODE
+	template<class Actor>
+	void applyToInstances ( const TaxonomyVertex* node, Actor& actor ) const
+	{
+		const InstanceVec* bucket = getInstances(node);
+		if ( bucket != NULL )
+			for ( InstanceVec::const_iterator p = bucket->begin(), p_end = bucket->end(); p != p_end; ++p )
+				applyToInstance ( *p, actor );
+	}
+		/// gather NODE and all its descendants into VISITED
+	void collectDescendants ( TaxonomyVertex* node, TaxVertexVec& visited )
+	{
+		if ( isVisited(node) )
+			return;
+		setVisited(node);
+		visited.push_back(node);
+
+		for ( TaxonomyVertex::iterator p = node->begin(/*upDirection=*/false), p_end = node->end(/*upDirection=*/false); p != p_end; ++p )
+			collectDescendants ( *p, visited );
+	}
+		/// @return true iff NODE is the first visited parent of ENTRY (or ENTRY has no visited parents at all)
+	bool isFirstVisitedParent ( const TaxonomyVertex* node, const ClassifiableEntry* entry ) const
+	{
+		for ( ClassifiableEntry::parent_iterator p = entry->parent_begin(), p_end = entry->parent_end(); p != p_end; ++p )
+			if ( isVisited(*p) )
+				return *p == node;
+		return true;
+	}
 
 public:		// interface
 		/// init c'tor
@@ -128,12 +197,24 @@ public:		// interface
 	TaxonomyVertex* getBottomVertex ( void ) const { return *Graph.begin(); }
 		/// get node for fresh entity E
 	TaxonomyVertex* getFreshVertex ( const ClassifiableEntry* e ) { FreshNode.setSample(e,false); return &FreshNode; }
+		/// get node for an entry E from the instance buckets; the synonyms of E are not there
+	TaxonomyVertex* getInstanceVertex ( const ClassifiableEntry* e )
+	{
+		InstanceNode.clear();
+		InstanceNode.setSample ( getInstanceHost(e), /*linkBack=*/false );
+		for ( ClassifiableEntry::parent_iterator p = e->parent_begin(), p_end = e->parent_end(); p != p_end; ++p )
+			InstanceNode.addNeighbour ( /*upDirection=*/true, *p );
+		InstanceNode.addNeighbour ( /*upDirection=*/false, getBottomVertex() );
+		return &InstanceNode;
+	}
 		/// get RW access to current
 	TaxonomyVertex* getCurrent ( void ) { return Current; }
 		/// get RO access to current
 	const TaxonomyVertex* getCurrent ( void ) const { return Current; }
 		/// set current to a given node
 	void setCurrent ( TaxonomyVertex* cur ) { Current = cur; }
+		/// @return true iff V is a temporary vertex (current, fresh or instance one) that is not a part of the taxonomy
+	bool isTemporary ( const TaxonomyVertex* v ) const { return v == Current || v == &FreshNode || v == &InstanceNode; }
 
 		/// apply ACTOR to subgraph starting from NODE as defined by flags;
 	template<bool needCurrent, bool onlyDirect, bool upDirection, class Actor>
@@ -151,11 +232,78 @@ public:		// interface
 
 		clearVisited();
 	}
+		/// apply ACTOR to the (direct, if ONLYDIRECT is set) instances of NODE
+	template<bool onlyDirect, class Actor>
+	void getInstancesInfo ( TaxonomyVertex* node, Actor& actor )
+	{
+		if ( onlyDirect )
+		{
+			// if the node itself is an individual -- we are done
+			if ( actor.apply(*node) )
+				return;
+			applyToInstances ( node, actor );
+			// nominals are kept in the concept graph, so they could be the children of NODE
+			for ( TaxonomyVertex::iterator p = node->begin(/*upDirection=*/false), p_end = node->end(/*upDirection=*/false); p != p_end; ++p )
+				actor.apply(**p);
+			return;
+		}
+
+		// an entry is in the buckets of all its direct parents, so take it from the first one below NODE
+		TaxVertexVec visited;
+		collectDescendants ( node, visited );
+		for ( TaxVertexVec::const_iterator p = visited.begin(), p_end = visited.end(); p != p_end; ++p )
+		{
+			// node itself could be a nominal
+			actor.apply(**p);
+			const InstanceVec* bucket = getInstances(*p);
+			if ( bucket != NULL )
+				for ( InstanceVec::const_iterator q = bucket->begin(), q_end = bucket->end(); q != q_end; ++q )
+					if ( isFirstVisitedParent ( *p, *q ) )
+						applyToInstance ( *q, actor );
+		}
+		clearVisited();
+	}
+		/// apply ACTOR to the types (direct, if ONLYDIRECT is set) of an ENTRY from the instance buckets
+	template<bool onlyDirect, class Actor>
+	void getTypesInfo ( const ClassifiableEntry* entry, Actor& actor )
+	{
+		for ( ClassifiableEntry::parent_iterator p = entry->parent_begin(), p_end = entry->parent_end(); p != p_end; ++p )
+			getRelativesInfoRec<onlyDirect, /*upDirection=*/true> ( *p, actor );
+		clearVisited();
+	}
+		/// apply ACTOR to an ENTRY from the instance buckets and all the entries that are the same as it
+	template<class Actor>
+	void getSameInfo ( const ClassifiableEntry* entry, Actor& actor ) { applyToInstance ( getInstanceHost(entry), actor ); }
+
+	// instance buckets
+
+		/// put ENTRY into the instance buckets of its direct parents [BEGIN,END)
+	template<class Iterator>
+	void addInstance ( const ClassifiableEntry* entry, Iterator begin, Iterator end )
+	{
+		for ( Iterator p = begin; p != end; ++p )
+		{
+			const_cast<ClassifiableEntry*>(entry)->addTaxParent(*p);
+			Instances[*p].push_back(entry);
+		}
+	}
+		/// add ENTRY to the synonyms of HOST from the instance buckets
+	void addInstanceSynonym ( const ClassifiableEntry* host, const ClassifiableEntry* entry );
+		/// put ENTRY into the instance bucket of the current (query) node; the parents of ENTRY are not changed
+	void addCurrentInstance ( const ClassifiableEntry* entry ) { Instances[Current].push_back(entry); }
+		/// remove ENTRY from the instance buckets
+	void removeInstance ( const ClassifiableEntry* entry );
+		/// move the instances of the vertex FROM into the instance bucket of the vertex TO
+	void moveInstances ( TaxonomyVertex* from, TaxonomyVertex* to );
+		/// @return the entry that represents ENTRY and its synonyms in the instance buckets
+	const ClassifiableEntry* getInstanceHost ( const ClassifiableEntry* entry ) const;
 
 	// taxonomy info access
 
 		/// print taxonomy info to a stream
 	void print ( std::ostream& o ) const;
+		/// print the instance bucket of the vertex V to a stream
+	void printInstances ( std::ostream& o, const TaxonomyVertex* v ) const;
 
 	// save/load interface; implementation is in SaveLoad.cpp
 
@@ -49,7 +49,7 @@ TaxonomyCreator :: performClassification ( void )
 	generalTwoPhaseClassification();
 
 	// create new vertex
-	pTax->finishCurrentNode();
+	insertCurrentEntry();
 
 	// clear all labels
 	clearLabels();
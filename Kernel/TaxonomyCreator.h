@@ -125,7 +125,7 @@ protected:	// methods
 		/// initialise aux entry with given concept p
 	void setCurrentEntry ( const ClassifiableEntry* p )
 	{
-		pTax->getCurrent()->clear();
+		pTax->clearCurrent();
 		pTax->getCurrent()->setSample(p);
 		curEntry = p;
 	}
@@ -169,6 +169,8 @@ protected:	// methods
 
 		/// actions that to be done BEFORE entry will be classified
 	virtual void preClassificationActions ( void ) {}
+		/// put the classified entry into the taxonomy
+	virtual void insertCurrentEntry ( void ) { pTax->finishCurrentNode(); }
 
 	//-----------------------------------------------------------------
 	//--	General classification methods
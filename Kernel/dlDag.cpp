@@ -62,6 +62,17 @@ DLDag :: removeQuery ( void )
 		delete v;
 	}
 	Heap.resize(finalDagSize);
+
+	// query vertices are cached within a query batch: remove them from indices
+	if ( useDLVCache )
+	{
+		const BipolarPointer bound = static_cast<BipolarPointer>(finalDagSize);
+		indexAnd.removeFrom(bound);
+		indexAll.removeFrom(bound);
+		indexLE.removeFrom(bound);
+		while ( !listAnds.empty() && listAnds.back() >= finalDagSize )
+			listAnds.pop_back();
+	}
 }
 
 void DLDag :: readConfig ( const ifOptionSet* Options )
@@ -249,6 +249,10 @@ public:		// interface
 	void setFinalSize ( void ) { finalDagSize = size(); setExpressionCache(false); }
 		/// resize DAG to its original size (to clear intermediate query)
 	void removeQuery ( void );
+		/// start caching query vertices to share them between several queries
+	void startQueryBatch ( void ) { setExpressionCache(true); }
+		/// remove all queries of a batch and stop caching query vertices
+	void finishQueryBatch ( void ) { removeQuery(); setExpressionCache(false); }
 
 	// option interface
 
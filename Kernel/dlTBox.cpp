@@ -37,6 +37,7 @@ TBox :: TBox ( const ifOptionSet* Options, const std::string& TopORoleName, cons
 	, stdReasoner(NULL)
 	, nomReasoner(NULL)
 	, pMonitor(NULL)
+	, pSchema(NULL)
 	, pTax(NULL)
 	, pTaxCreator(NULL)
 	, pName2Sig(NULL)
@@ -44,6 +45,8 @@ TBox :: TBox ( const ifOptionSet* Options, const std::string& TopORoleName, cons
 	, Status(kbLoading)
 	, curFeature(NULL)
 	, pQuery(NULL)
+	, inQueryBatch(false)
+	, deferIndividuals(false)
 	, Concepts("concept")
 	, Individuals("individual")
 	, ORM ( /*data=*/false, TopORoleName, BotORoleName )
@@ -373,7 +376,30 @@ bool TBox :: isSameIndividuals ( const TIndividual* a, const TIndividual* b )
 		throw EFaCTPlusPlus("Individuals are expected in the isSameIndividuals() query");
 	if ( a->node == NULL || b->node == NULL )	// fresh individuals couldn't be the same
 		return false;
-	return a->getTaxVertex() == b->getTaxVertex();
+	if ( a->getTaxVertex() != NULL || b->getTaxVertex() != NULL )	// nominals are in the graph
+		return a->getTaxVertex() == b->getTaxVertex();
+	// the same individuals share the representative in the instance buckets
+	return pTax->getInstanceHost(a) == pTax->getInstanceHost(b);
+}
+
+bool
+TBox :: isNonInstanceSet ( const SingletonVector& Inds, const TConcept* C )
+{
+	fpp_assert ( !Inds.empty() && C != NULL );
+	fpp_assert ( nomReasoner != NULL );
+
+	if ( LLM.isWritable(llBegSat) )
+		LL << "\n--------------------------------------------\nChecking that " << Inds.size()
+		   << " individuals are not instances of '" << C->getName() << "':";
+	if ( LLM.isWritable(llGTA) )
+		LL << "\n";
+
+	// the nominal cloud brings the features of all the individuals
+	prepareFeatures ( Inds.front(), C );
+	bool result = static_cast<NominalReasoner*>(nomReasoner)->consistentWithTypes ( Inds, inverse(C->resolveId()) );
+	clearFeatures();
+
+	return result;
 }
 
 /// check if 2 roles are disjoint
@@ -461,8 +487,11 @@ TBox :: createQueryConcept ( const DLTree* desc )
 {
 	fpp_assert ( desc != NULL );
 
-	// make sure that an old query is gone
-	clearQueryConcept();
+	// make sure that an old query is gone; keep its DAG entries for the rest of a batch
+	if ( inQueryBatch )
+		pQuery->clear();
+	else
+		clearQueryConcept();
 	// create description
 //	std::cerr << "Create new temp concept with description =" << desc << "\n";
 	deleteTree ( makeNonPrimitive ( pQuery, clone(desc) ) );
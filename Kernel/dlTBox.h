@@ -40,6 +40,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tKBFlags.h"
 #include "tSplitVars.h"
 #include "tSplitExpansionRules.h"
+#include "tSchemaTaxonomy.h"
 
 class DlSatTester;
 class Taxonomy;
@@ -65,6 +66,8 @@ class TBox
 	friend class ReasoningKernel;
 	friend class TAxiom;	// FIXME!! while TConcept can't get rid of told cycles
 	friend class DLConceptTaxonomy;
+	friend class ModularClassifier;	// classifies the modules and reads their taxonomies
+	friend class BulkRealiser;	// realises the individuals and puts them into the taxonomy
 
 public:		// type interface
 		/// vector of CONCEPT-like elements
@@ -166,6 +169,8 @@ protected:	// members
 
 		/// progress monitor
 	TProgressMonitor* pMonitor;
+		/// shared classification of the schema of the KB (if any)
+	const TSchemaTaxonomy* pSchema;
 
 		/// vectors for Completely defined, Non-CD and Non-primitive concepts
 	ConceptVector arrayCD, arrayNoCD, arrayNP;
@@ -203,6 +208,10 @@ protected:	// members
 	TConcept* pTemp;
 		/// temporary concept that represents query
 	TConcept* pQuery;
+		/// whether several queries are processed as a batch sharing the DAG
+	bool inQueryBatch;
+		/// whether the ABox individuals are left out of the classification to be realised in bulk
+	bool deferIndividuals;
 
 		/// all named concepts
 	ConceptCollection Concepts;
@@ -1181,6 +1190,11 @@ public:
 //--		public iterators
 //-----------------------------------------------------------------------------
 
+		/// RO access to the TOP concept
+	const TConcept* getTop ( void ) const { return pTop; }
+		/// RO access to the BOTTOM concept
+	const TConcept* getBottom ( void ) const { return pBottom; }
+
 		/// RO begin() for concepts
 	c_const_iterator c_begin ( void ) const { return Concepts.begin(); }
 		/// RO end() for concepts
@@ -1200,6 +1214,8 @@ public:
 	void performClassification ( void ) { createTaxonomy ( /*needIndividuals=*/false ); }
 		/// perform realisation (assuming KB is consistent)
 	void performRealisation ( void ) { createTaxonomy ( /*needIndividuals=*/true ); }
+		/// classify only the concepts from COLLECTION (assuming KB is consistent); the next performClassification() completes the taxonomy
+	void performPartialClassification ( const ConceptVector& collection );
 		/// reclassify taxonomy wrt changed sets
 	void reclassify ( const std::set<const TNamedEntity*>& MPlus, const std::set<const TNamedEntity*>& MMinus );
 
@@ -1214,6 +1230,14 @@ public:
 	void setProgressMonitor ( TProgressMonitor* pMon ) { pMonitor = pMon; }
 		/// check that reasoning progress was cancelled by external application
 	bool isCancelled ( void ) const { return pMonitor != NULL && pMonitor->isCancelled(); }
+		/// set the shared classification of the KB schema
+	void setSchemaTaxonomy ( const TSchemaTaxonomy* schema ) { pSchema = schema; }
+		/// get the shared classification of the KB schema (or NULL if there is none)
+	const TSchemaTaxonomy* getSchemaTaxonomy ( void ) const { return pSchema; }
+		/// choose whether the classification should leave the (non-nominal) individuals to a bulk realiser
+	void setDeferIndividuals ( bool value ) { deferIndividuals = value; }
+		/// mark the KB as realised after the deferred individuals were put into the taxonomy
+	void setRealised ( void );
 		/// set verbose output (ie, default progress monitor, concept and role taxonomies) wrt given VALUE
 	void setVerboseOutput ( bool value ) { verboseOutput = value; }
 
@@ -1223,8 +1247,23 @@ public:
 	void preprocessQueryConcept ( TConcept* query );
 		/// classify query concept
 	void classifyQueryConcept ( void );
+		/// put the direct instances of the classified query concept into the bucket of its vertex
+	void realiseQueryConcept ( void );			// implemented in DLConceptTaxonomy.h
 		/// delete all query-related stuff
 	void clearQueryConcept ( void ) { DLHeap.removeQuery(); }
+		/// start a query batch: DAG entries of the queries are shared until the batch is finished
+	void startQueryBatch ( void )
+	{
+		clearQueryConcept();
+		DLHeap.startQueryBatch();
+		inQueryBatch = true;
+	}
+		/// finish a query batch: delete all the query-related stuff
+	void finishQueryBatch ( void )
+	{
+		inQueryBatch = false;
+		DLHeap.finishQueryBatch();
+	}
 
 //-----------------------------------------------------------------------------
 //--		public reasoning interface
@@ -1255,6 +1294,8 @@ public:
 	bool isSatisfiable ( const TConcept* C );
 		/// check that 2 individuals are the same
 	bool isSameIndividuals ( const TIndividual* a, const TIndividual* b );
+		/// check that none of the individuals from INDS is an instance of C (the negations of C hold together)
+	bool isNonInstanceSet ( const SingletonVector& Inds, const TConcept* C );
 		/// check if 2 roles are disjoint
 	bool isDisjointRoles ( const TRole* R, const TRole* S );
 		/// check if the role R is irreflexive
@@ -70,6 +70,8 @@ public:		// interface
 	void addElement ( BipolarPointer pos );
 		/// locate given vertice in the hash
 	BipolarPointer locate ( const DLVertex& v ) const;
+		/// remove all elements with positions not less than POS from hash
+	void removeFrom ( BipolarPointer pos );
 }; // dlVHashTable
 
 #endif
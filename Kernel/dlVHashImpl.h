@@ -44,5 +44,16 @@ dlVHashTable :: addElement ( BipolarPointer pos )
 	insert ( Table[hash(host[pos])], pos );
 }
 
+inline void
+dlVHashTable :: removeFrom ( BipolarPointer pos )
+{
+	for ( HashTable::iterator p = Table.begin(), p_end = Table.end(); p != p_end; ++p )
+		for ( HashLeaf::iterator q = p->second.begin(); q != p->second.end(); )
+			if ( *q >= pos )
+				q = p->second.erase(q);
+			else
+				++q;
+}
+
 #endif
 
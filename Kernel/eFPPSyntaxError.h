@@ -0,0 +1,51 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef EFPPSYNTAXERROR_H
+#define EFPPSYNTAXERROR_H
+
+#include <string>
+#include <sstream>
+
+#include "eFaCTPlusPlus.h"
+
+/// exception thrown by the ontology readers on a malformed input
+class EFPPSyntaxError: public EFaCTPlusPlus
+{
+private:	// members
+		/// error string
+	std::string str;
+
+public:		// interface
+		/// c'tor: create an output string for the error WHY at the input line LINE
+	EFPPSyntaxError ( const std::string& why, unsigned int line )
+		: EFaCTPlusPlus()
+	{
+		std::stringstream s;
+		s << "Syntax error at input line " << line << ": " << why;
+		str = s.str();
+		reason = str.c_str();
+	}
+		/// empty d'tor
+	virtual ~EFPPSyntaxError ( void ) throw() {}
+
+		/// reason
+	virtual const char* what ( void ) const throw() { return str.c_str(); }
+}; // EFPPSyntaxError
+
+#endif
@@ -38,19 +38,26 @@ private:	// members
 	float resultTime;
 		/// flag to show timer is started
 	bool Started;
+		/// flag to measure the CPU time of the current thread instead of the whole process
+	bool ThreadTime;
 
 private:	// methods
+		/// get current CPU time of the process or the thread
+	clock_t getTime ( void ) const;
 		/// get time interval between startTime and current time
 	float calcDelta ( void ) const;
 
 public:		// interface
 		/// the only c'tor
-	TsProcTimer ( void ) : startTime(0), resultTime(0.0), Started(false) {}
+	TsProcTimer ( void ) : startTime(0), resultTime(0.0), Started(false), ThreadTime(false) {}
 		/// empty d'tor
 	~TsProcTimer ( void ) {}
 
 		/// reset timer
 	void Reset ( void );
+		/// measure the CPU time of the thread that runs the timer (VALUE=true) or of the whole process.
+		/// The timer should be started and stopped by the same thread then
+	void setThreadTime ( bool value ) { ThreadTime = value; }
 
 		/// record current time
 	void Start ( void );
@@ -71,9 +78,19 @@ inline void TsProcTimer :: Reset ( void )
 	resultTime = 0;
 }
 
+inline clock_t TsProcTimer :: getTime ( void ) const
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	timespec ts;
+	if ( ThreadTime && clock_gettime ( CLOCK_THREAD_CPUTIME_ID, &ts ) == 0 )
+		return (clock_t)ts.tv_sec*CLOCKS_PER_SEC + (clock_t)((double)ts.tv_nsec*CLOCKS_PER_SEC/1e9);
+#endif
+	return clock();
+}
+
 inline float TsProcTimer :: calcDelta ( void ) const
 {
-	clock_t finishTime = clock();
+	clock_t finishTime = getTime();
 
 	// calculate difference between cuttent time and start time
 	float realProcTime = float(finishTime>=startTime ?
@@ -105,7 +122,7 @@ inline void TsProcTimer :: Start ( void )
 {
 	if ( !Started )
 	{
-		startTime = clock();
+		startTime = getTime();
 		Started = true;
 	}
 }
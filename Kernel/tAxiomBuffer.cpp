@@ -0,0 +1,585 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+
+#include "tAxiomBuffer.h"
+
+//-------------------------------------------------------------
+// TAxiomBufferWriter
+//-------------------------------------------------------------
+
+unsigned int
+TAxiomBufferWriter :: name ( const std::string& n )
+{
+	unsigned int id = Index.find(n);
+	if ( id != TNameIndex::noName )
+		return id;
+
+	id = Index.insert(n);
+	// store only the part that differs from the previous name
+	size_t common = 0, max = std::min ( n.size(), LastName.size() );
+	while ( common < max && n[common] == LastName[common] )
+		++common;
+	putNum ( Names, common );
+	putNum ( Names, n.size()-common );
+	putBytes ( Names, n.data()+common, n.size()-common );
+	LastName = n;
+	return id;
+}
+
+const std::vector<unsigned char>&
+TAxiomBufferWriter :: getBuffer ( void )
+{
+	Buffer.clear();
+	Buffer.reserve ( Names.size() + Axioms.size() + 16 );
+	putBytes ( Buffer, "FPAB", 4 );
+	Buffer.push_back(AXIOM_BUFFER_VERSION);
+	putNum ( Buffer, Index.size() );
+	Buffer.insert ( Buffer.end(), Names.begin(), Names.end() );
+	Buffer.insert ( Buffer.end(), Axioms.begin(), Axioms.end() );
+	return Buffer;
+}
+
+//-------------------------------------------------------------
+// TAxiomBufferLoader
+//-------------------------------------------------------------
+
+TAxiomBufferLoader :: TAxiomBufferLoader ( ReasoningKernel& kernel, const void* beg, size_t size )
+	: Kernel(kernel)
+	, EM(kernel.getExpressionManager())
+	, Pos(static_cast<const unsigned char*>(beg))
+	, End(static_cast<const unsigned char*>(beg)+size)
+	, nAxioms(0)
+{
+}
+
+void
+TAxiomBufferLoader :: error ( const char* reason )
+{
+	throw EFaCTPlusPlus(reason);
+}
+
+void
+TAxiomBufferLoader :: readNames ( void )
+{
+	if ( End - Pos < 5 || Pos[0] != 'F' || Pos[1] != 'P' || Pos[2] != 'A' || Pos[3] != 'B' )
+		error("Axiom buffer: wrong signature");
+	Pos += 4;
+	if ( getByte() != AXIOM_BUFFER_VERSION )
+		error("Axiom buffer: unsupported version");
+
+	unsigned long n = getNum();
+	if ( n > (unsigned long)(End-Pos) )	// every name takes at least 2 bytes
+		error("Axiom buffer: wrong size of the name table");
+	Names.resize(n);
+	for ( unsigned long i = 0; i < n; ++i )
+	{
+		unsigned long common = getNum(), len = getNum();
+		if ( ( i == 0 ? 0 : Names[i-1].size() ) < common || (unsigned long)(End-Pos) < len )
+			error("Axiom buffer: malformed name table");
+		if ( common > 0 )
+			Names[i].assign ( Names[i-1], 0, common );
+		Names[i].append ( reinterpret_cast<const char*>(Pos), len );
+		Pos += len;
+	}
+
+	Concepts.resize(n,NULL);
+	Individuals.resize(n,NULL);
+	ORoles.resize(n,NULL);
+	DRoles.resize(n,NULL);
+}
+
+TAxiomBufferLoader::TConceptExpr*
+TAxiomBufferLoader :: getConcept ( void )
+{
+	unsigned int t = getByte();
+	switch ( t )
+	{
+	case abTop:
+		return EM->Top();
+	case abBottom:
+		return EM->Bottom();
+	case abConcept:
+	{
+		unsigned int id = getNameId();
+		if ( Concepts[id] == NULL )
+			Concepts[id] = EM->Concept(Names[id]);
+		return Concepts[id];
+	}
+	case abAnd:
+		getConceptList();
+		return EM->And();
+	case abOr:
+		getConceptList();
+		return EM->Or();
+	case abNot:
+		return EM->Not(getConcept());
+	case abOneOf:
+		getIndividualList();
+		return EM->OneOf();
+	case abObjectSome:
+	{
+		TORoleExpr* R = getORole();
+		return EM->Exists ( R, getConcept() );
+	}
+	case abObjectAll:
+	{
+		TORoleExpr* R = getORole();
+		return EM->Forall ( R, getConcept() );
+	}
+	case abObjectValue:
+	{
+		TORoleExpr* R = getORole();
+		return EM->Value ( R, getIndividual() );
+	}
+	case abObjectSelf:
+		return EM->SelfReference(getORole());
+	case abObjectMin:
+	case abObjectMax:
+	case abObjectExact:
+	{
+		unsigned int n = getNum();
+		TORoleExpr* R = getORole();
+		TConceptExpr* C = getConcept();
+		return t == abObjectMin ? EM->MinCardinality ( n, R, C ) :
+			   t == abObjectMax ? EM->MaxCardinality ( n, R, C ) :
+			   EM->Cardinality ( n, R, C );
+	}
+	case abDataSome:
+	{
+		TDRoleExpr* A = getDRole();
+		return EM->Exists ( A, getData() );
+	}
+	case abDataAll:
+	{
+		TDRoleExpr* A = getDRole();
+		return EM->Forall ( A, getData() );
+	}
+	case abDataValue:
+	{
+		TDRoleExpr* A = getDRole();
+		return EM->Value ( A, getLiteral() );
+	}
+	case abDataMin:
+	case abDataMax:
+	case abDataExact:
+	{
+		unsigned int n = getNum();
+		TDRoleExpr* A = getDRole();
+		TDataExpr* E = getData();
+		return t == abDataMin ? EM->MinCardinality ( n, A, E ) :
+			   t == abDataMax ? EM->MaxCardinality ( n, A, E ) :
+			   EM->Cardinality ( n, A, E );
+	}
+	default:
+		error("Axiom buffer: class expression expected");
+		return NULL;	// unreachable
+	}
+}
+
+TAxiomBufferLoader::TIndividualExpr*
+TAxiomBufferLoader :: getIndividual ( void )
+{
+	if ( getByte() != abIndividual )
+		error("Axiom buffer: individual expected");
+	unsigned int id = getNameId();
+	if ( Individuals[id] == NULL )
+		Individuals[id] = EM->Individual(Names[id]);
+	return Individuals[id];
+}
+
+TAxiomBufferLoader::TORoleExpr*
+TAxiomBufferLoader :: getORole ( void )
+{
+	switch ( getByte() )
+	{
+	case abORoleTop:
+		return EM->ObjectRoleTop();
+	case abORoleBottom:
+		return EM->ObjectRoleBottom();
+	case abORole:
+	{
+		unsigned int id = getNameId();
+		if ( ORoles[id] == NULL )
+			ORoles[id] = EM->ObjectRole(Names[id]);
+		return ORoles[id];
+	}
+	case abInverse:
+		return EM->Inverse(getORole());
+	default:
+		error("Axiom buffer: object role expected");
+		return NULL;	// unreachable
+	}
+}
+
+TAxiomBufferLoader::TORoleComplexExpr*
+TAxiomBufferLoader :: getORoleComplex ( void )
+{
+	if ( Pos == End || *Pos != abChain )
+		return getORole();
+	++Pos;
+	getORoleList();
+	return EM->Compose();
+}
+
+TAxiomBufferLoader::TDRoleExpr*
+TAxiomBufferLoader :: getDRole ( void )
+{
+	switch ( getByte() )
+	{
+	case abDRoleTop:
+		return EM->DataRoleTop();
+	case abDRoleBottom:
+		return EM->DataRoleBottom();
+	case abDRole:
+	{
+		unsigned int id = getNameId();
+		if ( DRoles[id] == NULL )
+			DRoles[id] = EM->DataRole(Names[id]);
+		return DRoles[id];
+	}
+	default:
+		error("Axiom buffer: data role expected");
+		return NULL;	// unreachable
+	}
+}
+
+TAxiomBufferLoader::TDataTypeExpr*
+TAxiomBufferLoader :: getDataType ( void )
+{
+	if ( getByte() != abDataType )
+		error("Axiom buffer: datatype expected");
+	TDataExpr* type = EM->getBuiltInDataType(Names[getNameId()]);
+	if ( type == NULL )
+		error("Axiom buffer: unsupported datatype");
+	// literals of the top datatype are treated as strings
+	if ( type == EM->DataTop() )
+		return EM->getStrDataType();
+	return dynamic_cast<TDataTypeExpr*>(const_cast<TDLDataExpression*>(type));
+}
+
+TAxiomBufferLoader::TDataExpr*
+TAxiomBufferLoader :: getData ( void )
+{
+	switch ( Pos == End ? 0 : *Pos )
+	{
+	case abDataTop:
+		++Pos;
+		return EM->DataTop();
+	case abDataBottom:
+		++Pos;
+		return EM->DataBottom();
+	case abDataType:
+	{
+		// unlike getDataType(), keep the top datatype as it is
+		++Pos;
+		TDataExpr* type = EM->getBuiltInDataType(Names[getNameId()]);
+		if ( type == NULL )
+			error("Axiom buffer: unsupported datatype");
+		return type;
+	}
+	case abDataNot:
+		++Pos;
+		return EM->DataNot(getData());
+	case abDataAnd:
+	case abDataOr:
+	{
+		unsigned int t = *Pos++;
+		unsigned long n = getNum();
+		EM->newArgList();
+		for ( unsigned long i = 0; i < n; ++i )
+			EM->addArg(getData());
+		return t == abDataAnd ? EM->DataAnd() : EM->DataOr();
+	}
+	case abDataOneOf:
+	{
+		++Pos;
+		unsigned long n = getNum();
+		EM->newArgList();
+		for ( unsigned long i = 0; i < n; ++i )
+			EM->addArg(getLiteral());
+		return EM->DataOneOf();
+	}
+	case abDataRestriction:
+	{
+		++Pos;
+		TDataTypeExpr* type = getDataType();
+		unsigned long n = getNum();
+		for ( unsigned long i = 0; i < n; ++i )
+		{
+			unsigned int facet = getByte();
+			TDataValueExpr* value = getLiteral();
+			switch ( facet )
+			{
+			case abMinInclusive:
+				type = EM->RestrictedType ( type, EM->FacetMinInclusive(value) );
+				break;
+			case abMinExclusive:
+				type = EM->RestrictedType ( type, EM->FacetMinExclusive(value) );
+				break;
+			case abMaxInclusive:
+				type = EM->RestrictedType ( type, EM->FacetMaxInclusive(value) );
+				break;
+			case abMaxExclusive:
+				type = EM->RestrictedType ( type, EM->FacetMaxExclusive(value) );
+				break;
+			default:
+				error("Axiom buffer: facet expected");
+			}
+		}
+		return type;
+	}
+	default:
+		error("Axiom buffer: data range expected");
+		return NULL;	// unreachable
+	}
+}
+
+TAxiomBufferLoader::TDataValueExpr*
+TAxiomBufferLoader :: getLiteral ( void )
+{
+	if ( getByte() != abLiteral )
+		error("Axiom buffer: literal expected");
+	unsigned long len = getNum();
+	if ( (unsigned long)(End-Pos) < len )
+		error("Axiom buffer: unexpected end of the buffer");
+	std::string value ( reinterpret_cast<const char*>(Pos), len );
+	Pos += len;
+	return EM->DataValue ( value, getDataType() );
+}
+
+void
+TAxiomBufferLoader :: getConceptList ( void )
+{
+	unsigned long n = getNum();
+	EM->newArgList();
+	for ( unsigned long i = 0; i < n; ++i )
+		EM->addArg(getConcept());
+}
+
+void
+TAxiomBufferLoader :: getIndividualList ( void )
+{
+	unsigned long n = getNum();
+	EM->newArgList();
+	for ( unsigned long i = 0; i < n; ++i )
+		EM->addArg(getIndividual());
+}
+
+void
+TAxiomBufferLoader :: getORoleList ( void )
+{
+	unsigned long n = getNum();
+	EM->newArgList();
+	for ( unsigned long i = 0; i < n; ++i )
+		EM->addArg(getORole());
+}
+
+void
+TAxiomBufferLoader :: getDRoleList ( void )
+{
+	unsigned long n = getNum();
+	EM->newArgList();
+	for ( unsigned long i = 0; i < n; ++i )
+		EM->addArg(getDRole());
+}
+
+void
+TAxiomBufferLoader :: loadAxiom ( unsigned int t )
+{
+	switch ( t )
+	{
+	case abDeclaration:
+		switch ( Pos == End ? 0 : *Pos )
+		{
+		case abIndividual:
+			Kernel.declare(getIndividual());
+			break;
+		case abORole:
+			Kernel.declare(getORole());
+			break;
+		case abDRole:
+			Kernel.declare(getDRole());
+			break;
+		default:
+			Kernel.declare(getConcept());
+			break;
+		}
+		break;
+	// class axioms
+	case abSubClassOf:
+	{
+		TConceptExpr* C = getConcept();
+		Kernel.impliesConcepts ( C, getConcept() );
+		break;
+	}
+	case abEquivalentClasses:
+		getConceptList();
+		Kernel.equalConcepts();
+		break;
+	case abDisjointClasses:
+		getConceptList();
+		Kernel.disjointConcepts();
+		break;
+	case abDisjointUnion:
+	{
+		TConceptExpr* C = getConcept();
+		getConceptList();
+		Kernel.disjointUnion(C);
+		break;
+	}
+	// object role axioms
+	case abSubObjectProperty:
+	{
+		TORoleComplexExpr* R = getORoleComplex();
+		Kernel.impliesORoles ( R, getORole() );
+		break;
+	}
+	case abEquivalentObjectProperties:
+		getORoleList();
+		Kernel.equalORoles();
+		break;
+	case abDisjointObjectProperties:
+		getORoleList();
+		Kernel.disjointORoles();
+		break;
+	case abInverseObjectProperties:
+	{
+		TORoleExpr* R = getORole();
+		Kernel.setInverseRoles ( R, getORole() );
+		break;
+	}
+	case abObjectDomain:
+	{
+		TORoleExpr* R = getORole();
+		Kernel.setODomain ( R, getConcept() );
+		break;
+	}
+	case abObjectRange:
+	{
+		TORoleExpr* R = getORole();
+		Kernel.setORange ( R, getConcept() );
+		break;
+	}
+	case abFunctionalObject:
+		Kernel.setOFunctional(getORole());
+		break;
+	case abInverseFunctional:
+		Kernel.setInverseFunctional(getORole());
+		break;
+	case abReflexive:
+		Kernel.setReflexive(getORole());
+		break;
+	case abIrreflexive:
+		Kernel.setIrreflexive(getORole());
+		break;
+	case abSymmetric:
+		Kernel.setSymmetric(getORole());
+		break;
+	case abAsymmetric:
+		Kernel.setAsymmetric(getORole());
+		break;
+	case abTransitive:
+		Kernel.setTransitive(getORole());
+		break;
+	// data role axioms
+	case abSubDataProperty:
+	{
+		TDRoleExpr* A = getDRole();
+		Kernel.impliesDRoles ( A, getDRole() );
+		break;
+	}
+	case abEquivalentDataProperties:
+		getDRoleList();
+		Kernel.equalDRoles();
+		break;
+	case abDisjointDataProperties:
+		getDRoleList();
+		Kernel.disjointDRoles();
+		break;
+	case abDataDomain:
+	{
+		TDRoleExpr* A = getDRole();
+		Kernel.setDDomain ( A, getConcept() );
+		break;
+	}
+	case abDataRange:
+	{
+		TDRoleExpr* A = getDRole();
+		Kernel.setDRange ( A, getData() );
+		break;
+	}
+	case abFunctionalData:
+		Kernel.setDFunctional(getDRole());
+		break;
+	// assertions
+	case abSameIndividuals:
+		getIndividualList();
+		Kernel.processSame();
+		break;
+	case abDifferentIndividuals:
+		getIndividualList();
+		Kernel.processDifferent();
+		break;
+	case abClassAssertion:
+	{
+		TIndividualExpr* I = getIndividual();
+		Kernel.instanceOf ( I, getConcept() );
+		break;
+	}
+	case abObjectAssertion:
+	case abNegativeObjectAssertion:
+	{
+		TIndividualExpr* I = getIndividual();
+		TORoleExpr* R = getORole();
+		TIndividualExpr* J = getIndividual();
+		if ( t == abObjectAssertion )
+			Kernel.relatedTo ( I, R, J );
+		else
+			Kernel.relatedToNot ( I, R, J );
+		break;
+	}
+	case abDataAssertion:
+	case abNegativeDataAssertion:
+	{
+		TIndividualExpr* I = getIndividual();
+		TDRoleExpr* A = getDRole();
+		TDataValueExpr* V = getLiteral();
+		if ( t == abDataAssertion )
+			Kernel.valueOf ( I, A, V );
+		else
+			Kernel.valueOfNot ( I, A, V );
+		break;
+	}
+	default:
+		error("Axiom buffer: axiom expected");
+	}
+}
+
+size_t
+TAxiomBufferLoader :: Load ( void )
+{
+	readNames();
+	while ( Pos != End )
+	{
+		loadAxiom(getByte());
+		++nAxioms;
+	}
+	return nAxioms;
+}
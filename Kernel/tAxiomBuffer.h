@@ -0,0 +1,252 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TAXIOMBUFFER_H
+#define TAXIOMBUFFER_H
+
+#include <string>
+#include <vector>
+
+#include "tAxiomBufferTags.h"
+#include "tNameIndex.h"
+#include "Kernel.h"
+
+/// encoder of the binary axiom buffers (see tAxiomBufferTags.h for the format).
+/// Names are interned as they are used; axioms and expressions are written in prefix form.
+class TAxiomBufferWriter
+{
+protected:	// members
+		/// index of the names used so far
+	TNameIndex Index;
+		/// encoded name table
+	std::vector<unsigned char> Names;
+		/// the last name added to the table (the next one is encoded w.r.t. it)
+	std::string LastName;
+		/// encoded axioms
+	std::vector<unsigned char> Axioms;
+		/// the whole buffer
+	std::vector<unsigned char> Buffer;
+		/// number of axioms written
+	size_t nAxioms;
+
+protected:	// methods
+		/// append a number N to a vector V
+	static void putNum ( std::vector<unsigned char>& v, unsigned long n )
+	{
+		while ( n >= 0x80 )
+		{
+			v.push_back((unsigned char)(n|0x80));
+			n >>= 7;
+		}
+		v.push_back((unsigned char)n);
+	}
+		/// append bytes [BEG,BEG+LEN) to a vector V
+	static void putBytes ( std::vector<unsigned char>& v, const char* beg, size_t len ) { v.insert ( v.end(), beg, beg+len ); }
+
+private:	// no copy
+		/// no copy c'tor
+	TAxiomBufferWriter ( const TAxiomBufferWriter& );
+		/// no assignment
+	TAxiomBufferWriter& operator = ( const TAxiomBufferWriter& );
+
+public:		// interface
+		/// empty c'tor
+	TAxiomBufferWriter ( void ) : nAxioms(0) { Index.setPrefixCompression(true); }
+		/// empty d'tor
+	~TAxiomBufferWriter ( void ) {}
+
+	// low-level interface
+
+		/// @return ID of a name NAME; add it to the name table if necessary
+	unsigned int name ( const std::string& name );
+		/// write a tag T
+	void tag ( AxiomBufferTag t )
+	{
+		if ( t >= abDeclaration )
+			++nAxioms;
+		Axioms.push_back((unsigned char)t);
+	}
+		/// write a number N (cardinality, size of a list, name ID)
+	void num ( unsigned long n ) { putNum ( Axioms, n ); }
+
+	// named entities and literals
+
+		/// write a named concept NAME
+	void concept ( const std::string& n ) { tag(abConcept); num(name(n)); }
+		/// write an individual NAME
+	void individual ( const std::string& n ) { tag(abIndividual); num(name(n)); }
+		/// write a named object role NAME
+	void oRole ( const std::string& n ) { tag(abORole); num(name(n)); }
+		/// write a named data role NAME
+	void dRole ( const std::string& n ) { tag(abDRole); num(name(n)); }
+		/// write a standard datatype with an IRI NAME
+	void dataType ( const std::string& n ) { tag(abDataType); num(name(n)); }
+		/// write a lexical form VALUE of a literal; the datatype should follow
+	void literal ( const std::string& value )
+	{
+		tag(abLiteral);
+		num(value.size());
+		putBytes ( Axioms, value.data(), value.size() );
+	}
+
+	// result
+
+		/// @return the number of axioms written
+	size_t size ( void ) const { return nAxioms; }
+		/// @return the whole buffer
+	const std::vector<unsigned char>& getBuffer ( void );
+		/// forget all the names and axioms
+	void clear ( void )
+	{
+		Index.clear();
+		Names.clear();
+		LastName.clear();
+		Axioms.clear();
+		Buffer.clear();
+		nAxioms = 0;
+	}
+}; // TAxiomBufferWriter
+
+/// decoder of the binary axiom buffers: tells all the axioms of a buffer to a kernel in a single pass
+class TAxiomBufferLoader
+{
+protected:	// types
+		/// concept expression
+	typedef ReasoningKernel::TConceptExpr TConceptExpr;
+		/// individual expression
+	typedef ReasoningKernel::TIndividualExpr TIndividualExpr;
+		/// object role complex expression (including role chains)
+	typedef ReasoningKernel::TORoleComplexExpr TORoleComplexExpr;
+		/// object role expression
+	typedef ReasoningKernel::TORoleExpr TORoleExpr;
+		/// data role expression
+	typedef ReasoningKernel::TDRoleExpr TDRoleExpr;
+		/// data expression
+	typedef ReasoningKernel::TDataExpr TDataExpr;
+		/// data type expression
+	typedef ReasoningKernel::TDataTypeExpr TDataTypeExpr;
+		/// data value expression
+	typedef ReasoningKernel::TDataValueExpr TDataValueExpr;
+
+protected:	// members
+		/// kernel to be filled
+	ReasoningKernel& Kernel;
+		/// expression manager of the kernel
+	TExpressionManager* EM;
+		/// current position in the buffer
+	const unsigned char* Pos;
+		/// end of the buffer
+	const unsigned char* End;
+		/// name table
+	std::vector<std::string> Names;
+		/// concepts by their name IDs (filled on demand)
+	std::vector<TConceptExpr*> Concepts;
+		/// individuals by their name IDs (filled on demand)
+	std::vector<TIndividualExpr*> Individuals;
+		/// object roles by their name IDs (filled on demand)
+	std::vector<TORoleExpr*> ORoles;
+		/// data roles by their name IDs (filled on demand)
+	std::vector<TDRoleExpr*> DRoles;
+		/// number of the axioms told
+	size_t nAxioms;
+
+private:	// no copy
+		/// no copy c'tor
+	TAxiomBufferLoader ( const TAxiomBufferLoader& );
+		/// no assignment
+	TAxiomBufferLoader& operator = ( const TAxiomBufferLoader& );
+
+protected:	// methods
+		/// @throw an exception about a malformed buffer
+	static void error ( const char* reason );
+		/// @return next byte of the buffer
+	unsigned int getByte ( void )
+	{
+		if ( Pos == End )
+			error("Axiom buffer: unexpected end of the buffer");
+		return *Pos++;
+	}
+		/// @return next number of the buffer; it takes at most 10 bytes
+	unsigned long getNum ( void )
+	{
+		const unsigned int nBits = sizeof(unsigned long)*8;
+		unsigned long ret = 0;
+		for ( unsigned int shift = 0; shift < 70; shift += 7 )
+		{
+			unsigned int b = getByte();
+			unsigned long bits = b&0x7F;
+			// the bits should fit into the number
+			if ( shift + 7 > nBits && ( shift >= nBits ? bits != 0 : (bits >> (nBits-shift)) != 0 ) )
+				error("Axiom buffer: number out of range");
+			ret |= bits << shift;
+			if ( b < 0x80 )
+				return ret;
+		}
+		error("Axiom buffer: number is longer than 10 bytes");
+		return 0;	// never reached
+	}
+		/// @return next name ID of the buffer
+	unsigned int getNameId ( void )
+	{
+		unsigned long n = getNum();
+		if ( n >= Names.size() )
+			error("Axiom buffer: name ID out of range");
+		return (unsigned int)n;
+	}
+		/// read the name table
+	void readNames ( void );
+
+		/// @return concept expression
+	TConceptExpr* getConcept ( void );
+		/// @return individual
+	TIndividualExpr* getIndividual ( void );
+		/// @return object role expression
+	TORoleExpr* getORole ( void );
+		/// @return object role expression or a role chain
+	TORoleComplexExpr* getORoleComplex ( void );
+		/// @return data role expression
+	TDRoleExpr* getDRole ( void );
+		/// @return data range
+	TDataExpr* getData ( void );
+		/// @return data type (that can be restricted or be a type of a literal)
+	TDataTypeExpr* getDataType ( void );
+		/// @return literal
+	TDataValueExpr* getLiteral ( void );
+
+		/// read a list of concepts into a new argument list
+	void getConceptList ( void );
+		/// read a list of individuals into a new argument list
+	void getIndividualList ( void );
+		/// read a list of object roles into a new argument list
+	void getORoleList ( void );
+		/// read a list of data roles into a new argument list
+	void getDRoleList ( void );
+		/// read an axiom with a tag T and tell it to the kernel
+	void loadAxiom ( unsigned int t );
+
+public:		// interface
+		/// init c'tor: read buffer [BEG,BEG+SIZE) to KERNEL
+	TAxiomBufferLoader ( ReasoningKernel& kernel, const void* beg, size_t size );
+		/// empty d'tor
+	~TAxiomBufferLoader ( void ) {}
+
+		/// load all the axioms of the buffer; @return the number of axioms told
+	size_t Load ( void );
+}; // TAxiomBufferLoader
+
+#endif
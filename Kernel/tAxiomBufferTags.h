@@ -0,0 +1,128 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TAXIOMBUFFERTAGS_H
+#define TAXIOMBUFFERTAGS_H
+
+/*
+ * Binary axiom buffer format. The C interface (fact.h) and the Java binding keep their own copies of the tags.
+ *
+ * All the numbers are unsigned LEB128 varints. The buffer is
+ *
+ *   'F' 'P' 'A' 'B' <version byte = 1>
+ *   <number of names N> N x ( <length of the prefix shared with the previous name> <suffix length> <suffix bytes> )
+ *   axiom* (till the end of the buffer)
+ *
+ * Names get IDs 0..N-1 in their order. Every axiom and every expression is written in
+ * prefix form: the tag byte, then the arguments. An argument is
+ *   C  -- class expression,   R -- object role expression,  A -- data role expression,
+ *   I  -- individual (abIndividual <name id>),  D -- data range,  V -- literal,
+ *   n  -- a number,  C* (etc.) -- <number of elements> followed by the elements.
+ */
+enum AxiomBufferTag
+{
+	// class expressions
+	abTop = 1,				//
+	abBottom,				//
+	abConcept,				// <name id>
+	abAnd,					// C*
+	abOr,					// C*
+	abNot,					// C
+	abOneOf,				// I*
+	abObjectSome,			// R C
+	abObjectAll,			// R C
+	abObjectValue,			// R I
+	abObjectSelf,			// R
+	abObjectMin,			// n R C
+	abObjectMax,			// n R C
+	abObjectExact,			// n R C
+	abDataSome,				// A D
+	abDataAll,				// A D
+	abDataValue,			// A V
+	abDataMin,				// n A D
+	abDataMax,				// n A D
+	abDataExact,			// n A D
+
+	// individuals
+	abIndividual,			// <name id>
+
+	// object roles
+	abORoleTop,				//
+	abORoleBottom,			//
+	abORole,				// <name id>
+	abInverse,				// R
+	abChain,				// R* (only as the sub-role of abSubObjectProperty)
+
+	// data roles
+	abDRoleTop,				//
+	abDRoleBottom,			//
+	abDRole,				// <name id>
+
+	// data ranges and literals
+	abDataTop,				//
+	abDataBottom,			//
+	abDataType,				// <name id of a standard datatype IRI>
+	abDataNot,				// D
+	abDataAnd,				// D*
+	abDataOr,				// D*
+	abDataOneOf,			// V*
+	abDataRestriction,		// D (a datatype) <number of facets> ( <facet tag> V )*
+	abLiteral,				// <length> <lexical form bytes> D (a datatype)
+	abMinInclusive,			// facet tags
+	abMinExclusive,
+	abMaxInclusive,
+	abMaxExclusive,
+
+	// axioms
+	abDeclaration = 64,		// C (a name) | I | R (a name) | A (a name)
+	abSubClassOf,			// C C
+	abEquivalentClasses,	// C*
+	abDisjointClasses,		// C*
+	abDisjointUnion,		// C C*
+	abSubObjectProperty,	// R (or a chain) R
+	abEquivalentObjectProperties,	// R*
+	abDisjointObjectProperties,		// R*
+	abInverseObjectProperties,		// R R
+	abObjectDomain,			// R C
+	abObjectRange,			// R C
+	abFunctionalObject,		// R
+	abInverseFunctional,	// R
+	abReflexive,			// R
+	abIrreflexive,			// R
+	abSymmetric,			// R
+	abAsymmetric,			// R
+	abTransitive,			// R
+	abSubDataProperty,		// A A
+	abEquivalentDataProperties,	// A*
+	abDisjointDataProperties,	// A*
+	abDataDomain,			// A C
+	abDataRange,			// A D
+	abFunctionalData,		// A
+	abSameIndividuals,		// I*
+	abDifferentIndividuals,	// I*
+	abClassAssertion,		// I C
+	abObjectAssertion,		// I R I
+	abNegativeObjectAssertion,	// I R I
+	abDataAssertion,		// I A V
+	abNegativeDataAssertion	// I A V
+};
+
+/* version of the format */
+#define AXIOM_BUFFER_VERSION 1
+
+#endif
@@ -150,7 +150,7 @@ protected:	// methods
 
 public:		// methods
 		/// the only c'tor
-	explicit TConcept ( const std::string& name )
+	explicit TConcept ( const TNameRef& name )
 		: ClassifiableEntry (name)
 		, rel(0)
 		, Description(NULL)
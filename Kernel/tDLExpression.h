@@ -255,13 +255,15 @@ class TNamedEntity
 {
 protected:	// members
 		/// name of the entity
-	std::string Name;
+	TEntryName Name;
 		/// translated version of it
 	TNamedEntry* entry;
+		/// dense ID given by the expression manager; 0 if none
+	unsigned int Id;
 
 public:		// interface
 		/// c'tor: initialise name
-	TNamedEntity ( const std::string& name ) : Name(name), entry(NULL) {}
+	TNamedEntity ( const TNameRef& name ) : Name(name), entry(NULL), Id(0) {}
 		/// empty d'tor
 	virtual ~TNamedEntity ( void ) {}
 
@@ -274,6 +276,11 @@ public:		// interface
 	void setEntry ( TNamedEntry* e ) { entry = e; }
 		/// get entry
 	TNamedEntry* getEntry ( void ) const { return entry; }
+
+		/// set dense ID
+	void setId ( unsigned int id ) { Id = id; }
+		/// get dense ID
+	unsigned int getId ( void ) const { return Id; }
 }; // TNamedEntity
 
 //------------------------------------------------------------------
@@ -520,7 +527,7 @@ class TDLConceptName: public TDLConceptExpression, public TNamedEntity
 {
 public:		// interface
 		/// init c'tor
-	TDLConceptName ( const std::string& name ) : TDLConceptExpression(), TNamedEntity(name) {}
+	TDLConceptName ( const TNameRef& name ) : TDLConceptExpression(), TNamedEntity(name) {}
 		/// empty d'tor
 	virtual ~TDLConceptName ( void ) {}
 
@@ -975,7 +982,7 @@ class TDLIndividualName: public TDLIndividualExpression, public TNamedEntity
 {
 public:		// interface
 		/// init c'tor
-	TDLIndividualName ( const std::string& name ) : TDLIndividualExpression(), TNamedEntity(name) {}
+	TDLIndividualName ( const TNameRef& name ) : TDLIndividualExpression(), TNamedEntity(name) {}
 		/// empty d'tor
 	virtual ~TDLIndividualName ( void ) {}
 
@@ -1077,7 +1084,7 @@ class TDLObjectRoleName: public TDLObjectRoleExpression, public TNamedEntity
 {
 public:		// interface
 		/// init c'tor
-	TDLObjectRoleName ( const std::string& name ) : TDLObjectRoleExpression(), TNamedEntity(name) {}
+	TDLObjectRoleName ( const TNameRef& name ) : TDLObjectRoleExpression(), TNamedEntity(name) {}
 		/// empty d'tor
 	virtual ~TDLObjectRoleName ( void ) {}
 
@@ -1225,7 +1232,7 @@ class TDLDataRoleName: public TDLDataRoleExpression, public TNamedEntity
 {
 public:		// interface
 		/// init c'tor
-	TDLDataRoleName ( const std::string& name ) : TDLDataRoleExpression(), TNamedEntity(name) {}
+	TDLDataRoleName ( const TNameRef& name ) : TDLDataRoleExpression(), TNamedEntity(name) {}
 		/// empty d'tor
 	virtual ~TDLDataRoleName ( void ) {}
 
@@ -1325,13 +1332,13 @@ class TDLDataValue: public TDLDataExpression, public TNamedEntity, public TDataE
 {
 public:		// interface
 		/// fake c'tor (to make TNameSet happy); shouldn't be called
-	TDLDataValue ( const std::string& value )
+	TDLDataValue ( const TNameRef& value )
 		: TDLDataExpression()
 		, TNamedEntity(value)
 		, TDataExpressionArg<TDLDataTypeExpression>(NULL)
 		{ fpp_unreachable(); }
 		/// init c'tor
-	TDLDataValue ( const std::string& value, const TDLDataTypeExpression* T )
+	TDLDataValue ( const TNameRef& value, const TDLDataTypeExpression* T )
 		: TDLDataExpression()
 		, TNamedEntity(value)
 		, TDataExpressionArg<TDLDataTypeExpression>(T)
@@ -1520,7 +1527,7 @@ protected:	// classes
 			/// empty d'tor
 		virtual ~DVCreator ( void ) {}
 			/// create new value of a given type
-		virtual TDLDataValue* makeEntry ( const std::string& name ) const { return new TDLDataValue(name,type); }
+		virtual TDLDataValue* makeEntry ( const TNameRef& name ) const { return new TDLDataValue(name,type); }
 	}; // DVCreator
 
 protected:	// members
@@ -1545,7 +1552,7 @@ class TDLDataTypeName: public TDLDataTypeExpression, public TDLDataType, public
 {
 public:		// interface
 		/// init c'tor
-	TDLDataTypeName ( const std::string& name ) : TDLDataTypeExpression(), TDLDataType(this), TNamedEntity(name) {}
+	TDLDataTypeName ( const TNameRef& name ) : TDLDataTypeExpression(), TDLDataType(this), TNamedEntity(name) {}
 		/// empty d'tor
 	virtual ~TDLDataTypeName ( void ) {}
 
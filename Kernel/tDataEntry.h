@@ -215,7 +215,7 @@ protected:	// methods
 
 public:		// interface
 		/// create data entry with given name
-	TDataEntry ( const std::string& name )
+	TDataEntry ( const TNameRef& name )
 		: TNamedEntry(name)
 		, Type(NULL)
 		, pName(bpINVALID)
@@ -0,0 +1,118 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TDENSESIGNATURE_H
+#define TDENSESIGNATURE_H
+
+#include <vector>
+
+#include "tSignature.h"
+
+/// signature as a bitset over the dense IDs of the named entities (see TNamedEntity::getId()).
+/// Keeps the list of the added elements, so clearing costs the size of the signature, not of the bitset
+class TDenseSignature
+{
+public:		// types
+		/// RO iterator over the IDs of the elements
+	typedef std::vector<unsigned int>::const_iterator iterator;
+
+protected:	// types
+		/// word of the bitset
+	typedef unsigned long Word;
+		/// number of bits in a word
+	static const unsigned int WordBits = sizeof(Word)*8;
+
+protected:	// members
+		/// the bitset itself
+	std::vector<Word> Bits;
+		/// IDs of the elements in the order of addition
+	std::vector<unsigned int> Elements;
+		/// true if concept TOP-locality; false if concept BOTTOM-locality
+	bool topCLocality;
+		/// true if role TOP-locality; false if role BOTTOM-locality
+	bool topRLocality;
+
+public:		// interface
+		/// empty c'tor
+	TDenseSignature ( void ) : topCLocality(false), topRLocality(false) {}
+		/// empty d'tor
+	~TDenseSignature ( void ) {}
+
+		/// make place for the IDs less than N
+	void reserve ( unsigned int n )
+	{
+		if ( Bits.size()*WordBits < n )
+			Bits.resize ( (n+WordBits-1)/WordBits, 0 );
+	}
+
+	// add names to signature
+
+		/// add an element with a dense ID; @return true iff it is new
+	bool add ( unsigned int id )
+	{
+		reserve(id+1);
+		Word& w = Bits[id/WordBits];
+		Word mask = Word(1) << (id%WordBits);
+		if ( w & mask )
+			return false;
+		w |= mask;
+		Elements.push_back(id);
+		return true;
+	}
+		/// add a named entity P; @return true iff it is new. Entities without IDs are ignored
+	bool add ( const TNamedEntity* p ) { return p->getId() != 0 && add(p->getId()); }
+		/// add all the elements of a signature SIG
+	void add ( const TSignature& sig )
+	{
+		for ( TSignature::iterator p = sig.begin(), p_end = sig.end(); p != p_end; ++p )
+			add(*p);
+	}
+		/// set new locality polarity
+	void setLocality ( bool topC, bool topR ) { topCLocality = topC; topRLocality = topR; }
+		/// set new locality polarity
+	void setLocality ( bool top ) { setLocality ( top, top ); }
+
+	// access
+
+		/// @return true iff signature contains an element with a dense ID
+	bool contains ( unsigned int id ) const
+		{ return id/WordBits < Bits.size() && ( Bits[id/WordBits] & (Word(1) << (id%WordBits)) ) != 0; }
+		/// @return true iff signature contains given element
+	bool contains ( const TNamedEntity* p ) const { return contains(p->getId()); }
+		/// @return size of the signature
+	size_t size ( void ) const { return Elements.size(); }
+		/// clear the signature
+	void clear ( void )
+	{
+		for ( iterator p = Elements.begin(), p_end = Elements.end(); p != p_end; ++p )
+			Bits[*p/WordBits] = 0;
+		Elements.clear();
+	}
+
+		/// RO access to the IDs of the elements
+	iterator begin ( void ) const { return Elements.begin(); }
+		/// RO access to the IDs of the elements
+	iterator end ( void ) const { return Elements.end(); }
+
+		/// @return true iff concepts are treated as TOPs
+	bool topCLocal ( void ) const { return topCLocality; }
+		/// @return true iff roles are treated as TOPs
+	bool topRLocal ( void ) const { return topRLocality; }
+}; // TDenseSignature
+
+#endif
@@ -0,0 +1,89 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TENTRYNAME_H
+#define TENTRYNAME_H
+
+#include <string>
+#include <cstring>
+
+/// name passed to the c'tor of a named entry or entity: either an interned one,
+/// kept by a name table (TNameIndex) longer than the entry, or any other string
+class TNameRef
+{
+protected:	// members
+		/// the characters of the name
+	const char* Str;
+		/// true iff the name is kept by a name table
+	bool Interned;
+
+protected:	// methods
+		/// init c'tor
+	TNameRef ( const char* str, bool interned ) : Str(str), Interned(interned) {}
+
+public:		// interface
+		/// c'tor: the name STR is copied by the entry
+	TNameRef ( const std::string& str ) : Str(str.c_str()), Interned(false) {}
+		/// c'tor: the name STR is copied by the entry
+	TNameRef ( const char* str ) : Str(str), Interned(false) {}
+		/// @return the name STR kept by a name table; it is not copied by the entry
+	static TNameRef interned ( const char* str ) { return TNameRef(str,true); }
+
+		/// @return the characters of the name
+	const char* c_str ( void ) const { return Str; }
+		/// @return true iff the name is kept by a name table
+	bool isInterned ( void ) const { return Interned; }
+}; // TNameRef
+
+/// name of a named entry or entity: an interned name is shared with the name table, others are owned
+class TEntryName
+{
+protected:	// members
+		/// the characters of the name
+	const char* Str;
+		/// true iff the characters are owned by the name
+	bool Owned;
+
+private:	// no copy
+		/// no copy c'tor
+	TEntryName ( const TEntryName& );
+		/// no assignment
+	TEntryName& operator = ( const TEntryName& );
+
+public:		// interface
+		/// init c'tor: share an interned NAME, copy others
+	explicit TEntryName ( const TNameRef& name )
+		: Str(name.c_str())
+		, Owned(!name.isInterned())
+	{
+		if ( Owned )
+		{
+			size_t len = strlen(Str);
+			char* copy = new char[len+1];
+			memcpy ( copy, Str, len+1 );
+			Str = copy;
+		}
+	}
+		/// d'tor
+	~TEntryName ( void ) { if ( Owned ) delete [] Str; }
+
+		/// @return the characters of the name
+	const char* c_str ( void ) const { return Str; }
+}; // TEntryName
+
+#endif
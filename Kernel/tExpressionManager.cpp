@@ -19,7 +19,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tExpressionManager.h"
 
 TExpressionManager :: TExpressionManager ( void )
-	: CTop(new TDLConceptTop)
+	: nEntities(0)
+	, CTop(new TDLConceptTop)
 	, CBottom(new TDLConceptBottom)
 	, DTop(new TDLDataTop)
 	, DBottom(new TDLDataBottom)
@@ -55,6 +56,7 @@ TExpressionManager :: clear ( void )
 	NS_DR.clear();
 	InverseRoleCache.clear();
 	OneOfCache.clear();
+	StructCache.clear();
 	// delete all the recorded references
 	for ( std::vector<TDLExpression*>::iterator p = RefRecorder.begin(), p_end = RefRecorder.end(); p < p_end; ++p )
 		delete *p;
@@ -71,3 +73,41 @@ TExpressionManager :: clearNameCache ( void )
 	clearNameCache(NS_DR);
 	clearNameCache(NS_DT);
 }
+
+// well-known namespaces of the datatypes
+#define OWL_NS "http://www.w3.org/2002/07/owl#"
+#define RDF_NS "http://www.w3.org/1999/02/22-rdf-syntax-ns#"
+#define RDFS_NS "http://www.w3.org/2000/01/rdf-schema#"
+#define XSD_NS "http://www.w3.org/2001/XMLSchema#"
+
+/// @return the built-in datatype (or data top) that corresponds to the XSD/RDF datatype IRI; NULL if it is not supported
+TDLDataExpression*
+TExpressionManager :: getBuiltInDataType ( const std::string& iri )
+{
+	if ( iri == RDFS_NS "Literal" || iri == XSD_NS "anyType" || iri == XSD_NS "anySimpleType" )
+		return DataTop();
+
+	if ( iri == RDF_NS "PlainLiteral" || iri == RDF_NS "XMLLiteral" || iri == RDF_NS "langString" ||
+		 iri == XSD_NS "string" || iri == XSD_NS "normalizedString" || iri == XSD_NS "token" ||
+		 iri == XSD_NS "anyURI" || iri == XSD_NS "ID" )
+		return getStrDataType();
+
+	if ( iri == XSD_NS "integer" || iri == XSD_NS "int" || iri == XSD_NS "long" ||
+		 iri == XSD_NS "short" || iri == XSD_NS "byte" ||
+		 iri == XSD_NS "nonNegativeInteger" || iri == XSD_NS "positiveInteger" ||
+		 iri == XSD_NS "nonPositiveInteger" || iri == XSD_NS "negativeInteger" ||
+		 iri == XSD_NS "unsignedInt" || iri == XSD_NS "unsignedLong" ||
+		 iri == XSD_NS "unsignedShort" || iri == XSD_NS "unsignedByte" )
+		return getIntDataType();
+
+	if ( iri == XSD_NS "float" || iri == XSD_NS "double" || iri == XSD_NS "decimal" || iri == OWL_NS "real" || iri == OWL_NS "rational" )
+		return getRealDataType();
+
+	if ( iri == XSD_NS "boolean" )
+		return getBoolDataType();
+
+	if ( iri == XSD_NS "dateTimeAsLong" )
+		return getTimeDataType();
+
+	return NULL;
+}
@@ -19,6 +19,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #ifndef TEXPRESSIONMANAGER_H
 #define TEXPRESSIONMANAGER_H
 
+#include <map>
+
 #include "tDLExpression.h"
 #include "tNameSet.h"
 #include "tNAryQueue.h"
@@ -70,6 +72,59 @@ protected:	// types
 		void clear ( void ) { Map.clear(); }
 	}; // TInverseRoleCache
 
+		/// tags of the complex expressions' constructors
+	enum ExpressionTag
+	{
+		etNot, etAnd, etOr, etOneOf,
+		etSelf, etObjectValue, etObjectExists, etObjectForall,
+		etObjectMinCard, etObjectMaxCard, etObjectExactCard,
+		etDataValue, etDataExists, etDataForall,
+		etDataMinCard, etDataMaxCard, etDataExactCard,
+		etChain, etProjectFrom, etProjectInto,
+		etDataNot, etDataAnd, etDataOr, etDataOneOf,
+		etFacetMinIncl, etFacetMinExcl, etFacetMaxIncl, etFacetMaxExcl
+	};
+		/// structural key of a complex expression: constructor, number and argument pointers
+	class TExpressionKey
+	{
+	protected:	// types
+			/// arguments array
+		typedef std::vector<const TDLExpression*> ArgArray;
+
+	protected:	// members
+			/// constructor of the expression
+		ExpressionTag Tag;
+			/// numerical argument (for cardinality restrictions)
+		unsigned int N;
+			/// all the expression arguments
+		ArgArray Args;
+
+	public:		// interface
+			/// c'tor for the expression with (up to) 2 arguments and a number
+		TExpressionKey ( ExpressionTag tag, const TDLExpression* a, const TDLExpression* b = NULL, unsigned int n = 0 )
+			: Tag(tag)
+			, N(n)
+		{
+			Args.push_back(a);
+			if ( b != NULL )
+				Args.push_back(b);
+		}
+			/// c'tor for the n-ary expression
+		TExpressionKey ( ExpressionTag tag, const ArgArray& args ) : Tag(tag), N(0), Args(args) {}
+
+			/// compare keys structurally
+		bool operator < ( const TExpressionKey& key ) const
+		{
+			if ( Tag != key.Tag )
+				return Tag < key.Tag;
+			if ( N != key.N )
+				return N < key.N;
+			return Args < key.Args;
+		}
+	}; // TExpressionKey
+		/// map from the structure of an expression to the expression itself
+	typedef std::map<TExpressionKey, TDLExpression*> StructCacheType;
+
 protected:	// members
 		/// nameset for concepts
 	TNameSet<TDLConceptName> NS_C;
@@ -82,6 +137,9 @@ protected:	// members
 		/// nameset for data types
 	TDataTypeManager NS_DT;
 
+		/// number of the dense IDs given to the named entities
+	unsigned int nEntities;
+
 		/// n-ary queue for arguments
 	TNAryQueue<const TDLExpression> ArgQueue;
 
@@ -109,17 +167,73 @@ protected:	// members
 	TInverseRoleCache InverseRoleCache;
 		/// cache for the one-of singletons
 	TOneOfCache OneOfCache;
+		/// structural cache of all the complex expressions: makes equal expressions pointer-equal
+	StructCacheType StructCache;
 
 protected:	// methods
+		/// give a dense ID to a named entity P if it has none; @return P
+	template<class T>
+	T* registerName ( T* p )
+	{
+		if ( p->getId() == 0 )
+			p->setId(++nEntities);
+		return p;
+	}
 		/// record the reference; @return the argument
 	template<class T>
 	T* record ( T* arg ) { RefRecorder.push_back(arg); return arg; }
+		/// @return an expression with a given structure KEY, or NULL if there is no such expression
+	template<class T>
+	T* lookup ( const TExpressionKey& key ) const
+	{
+		StructCacheType::const_iterator p = StructCache.find(key);
+		return p == StructCache.end() ? NULL : static_cast<T*>(p->second);
+	}
+		/// record the reference to a new expression with the structure KEY; @return the expression
+	template<class T>
+	T* intern ( const TExpressionKey& key, T* expr ) { StructCache[key] = expr; return record(expr); }
+		/// get an expression of type T with a constructor TAG and an argument A
+	template<class T, class A>
+	T* unary ( ExpressionTag tag, const A* a )
+	{
+		TExpressionKey key(tag,a);
+		T* ret = lookup<T>(key);
+		return ret ? ret : intern(key,new T(a));
+	}
+		/// get an expression of type T with a constructor TAG and arguments A and B
+	template<class T, class A, class B>
+	T* binary ( ExpressionTag tag, const A* a, const B* b )
+	{
+		TExpressionKey key(tag,a,b);
+		T* ret = lookup<T>(key);
+		return ret ? ret : intern(key,new T(a,b));
+	}
+		/// get a cardinality restriction of type T with a constructor TAG, a number N and arguments A and B
+	template<class T, class A, class B>
+	T* cardinality ( ExpressionTag tag, unsigned int n, const A* a, const B* b )
+	{
+		TExpressionKey key(tag,a,b,n);
+		T* ret = lookup<T>(key);
+		return ret ? ret : intern(key,new T(n,a,b));
+	}
+		/// get an n-ary expression of type T with a constructor TAG and given arguments ARGS
+	template<class T>
+	T* nAry ( ExpressionTag tag, const std::vector<const TDLExpression*>& args )
+	{
+		TExpressionKey key(tag,args);
+		T* ret = lookup<T>(key);
+		return ret ? ret : intern(key,new T(args));
+	}
+		/// get an n-ary expression of type T with a constructor TAG; take the arguments from the last argument list
+	template<class T>
+	T* nAry ( ExpressionTag tag ) { return nAry<T>(tag,getArgList()); }
 		/// clear the TNamedEntry cache for all elements of a name-set NS
 	template<class T>
 	void clearNameCache ( TNameSet<T>& ns )
 	{
 		for ( typename TNameSet<T>::iterator p = ns.begin(), p_end = ns.end(); p != p_end; ++p )
-			p->second->setEntry(NULL);
+			if ( *p != NULL )
+				(*p)->setEntry(NULL);
 	}
 
 public:		// interface
@@ -139,13 +253,13 @@ public:		// interface
 	void setTopBottomRoles ( const char* topORoleName, const char* botORoleName, const char* topDRoleName, const char* botDRoleName )
 	{
 		delete ORTop;
-		ORTop = new TDLObjectRoleName(topORoleName);
+		ORTop = registerName(new TDLObjectRoleName(topORoleName));
 		delete ORBottom;
-		ORBottom = new TDLObjectRoleName(botORoleName);
+		ORBottom = registerName(new TDLObjectRoleName(botORoleName));
 		delete DRTop;
-		DRTop = new TDLDataRoleName(topDRoleName);
+		DRTop = registerName(new TDLDataRoleName(topDRoleName));
 		delete DRBottom;
-		DRBottom = new TDLDataRoleName(botDRoleName);
+		DRBottom = registerName(new TDLDataRoleName(botDRoleName));
 	}
 		/// @return true iff R is a top object role
 	bool isUniversalRole ( const TDLObjectRoleExpression* R ) const { return R == ORTop; }
@@ -158,6 +272,8 @@ public:		// interface
 
 	// entries count
 
+		/// @return the upper bound of the dense IDs of the named entities
+	unsigned int maxEntityId ( void ) const { return nEntities+1; }
 		/// get number of registered concepts
 	unsigned int nConcepts ( void ) const { return NS_C.size(); }
 		/// get number of registered individuals
@@ -167,6 +283,17 @@ public:		// interface
 		/// get number of registered data roles
 	unsigned int nDRoles ( void ) const { return NS_DR.size(); }
 
+	// name indices
+
+		/// get the index of concept names
+	const TNameIndex& getConceptNameIndex ( void ) const { return NS_C.getIndex(); }
+		/// get the index of individual names
+	const TNameIndex& getIndividualNameIndex ( void ) const { return NS_I.getIndex(); }
+		/// get the index of object role names
+	const TNameIndex& getORoleNameIndex ( void ) const { return NS_OR.getIndex(); }
+		/// get the index of data role names
+	const TNameIndex& getDRoleNameIndex ( void ) const { return NS_DR.getIndex(); }
+
 	// argument lists
 
 		/// opens new argument list
@@ -175,6 +302,8 @@ public:		// interface
 	void addArg ( const TDLExpression* arg ) { ArgQueue.addArg(arg); }
 		/// get the latest argument list
 	const std::vector<const TDLExpression*>& getArgList ( void ) { return ArgQueue.getLastArgList(); }
+		/// drop all the open argument lists
+	void clearArgLists ( void ) { ArgQueue.clear(); }
 
 	// create expressions methods
 
@@ -185,16 +314,17 @@ public:		// interface
 		/// get BOTTOM concept
 	TDLConceptBottom* Bottom ( void ) const { return CBottom; }
 		/// get named concept
-	TDLConceptName* Concept ( const std::string& name ) { return NS_C.insert(name); }
+	TDLConceptName* Concept ( const std::string& name ) { return registerName(NS_C.insert(name)); }
 		/// get negation of a concept C
-	TDLConceptExpression* Not ( const TDLConceptExpression* C ) { return record(new TDLConceptNot(C)); }
+	TDLConceptExpression* Not ( const TDLConceptExpression* C )
+		{ return unary<TDLConceptNot>(etNot,C); }
 		/// get an n-ary conjunction expression; take the arguments from the last argument list
-	TDLConceptExpression* And ( void ) { return record(new TDLConceptAnd(getArgList())); }
+	TDLConceptExpression* And ( void ) { return nAry<TDLConceptAnd>(etAnd); }
 		/// @return C and D
 	TDLConceptExpression* And ( const TDLConceptExpression* C, const TDLConceptExpression* D )
 		{ newArgList(); addArg(C); addArg(D); return And(); }
 		/// get an n-ary disjunction expression; take the arguments from the last argument list
-	TDLConceptExpression* Or ( void ) { return record(new TDLConceptOr(getArgList())); }
+	TDLConceptExpression* Or ( void ) { return nAry<TDLConceptOr>(etOr); }
 		/// @return C or D
 	TDLConceptExpression* Or ( const TDLConceptExpression* C, const TDLConceptExpression* D )
 		{ newArgList(); addArg(C); addArg(D); return Or(); }
@@ -204,55 +334,56 @@ public:		// interface
 		const std::vector<const TDLExpression*>& v = getArgList();
 		if ( v.size() == 1 )
 			return OneOfCache.get(static_cast<const TDLIndividualExpression*>(v.front()));
-		return record(new TDLConceptOneOf(v));
+		return nAry<TDLConceptOneOf>(etOneOf,v);
 	}
 		/// @return concept {I} for the individual I
 	TDLConceptExpression* OneOf ( const TDLIndividualExpression* I ) { return OneOfCache.get(I); }
 
 		/// get self-reference restriction of an object role R
-	TDLConceptExpression* SelfReference ( const TDLObjectRoleExpression* R ) { return record(new TDLConceptObjectSelf(R)); }
+	TDLConceptExpression* SelfReference ( const TDLObjectRoleExpression* R )
+		{ return unary<TDLConceptObjectSelf>(etSelf,R); }
 		/// get value restriction wrt an object role R and an individual I
 	TDLConceptExpression* Value ( const TDLObjectRoleExpression* R, const TDLIndividualExpression* I )
-		{ return record(new TDLConceptObjectValue(R,I)); }
+		{ return binary<TDLConceptObjectValue>(etObjectValue,R,I); }
 		/// get existential restriction wrt an object role R and a concept C
 	TDLConceptExpression* Exists ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectExists(R,C)); }
+		{ return binary<TDLConceptObjectExists>(etObjectExists,R,C); }
 		/// get universal restriction wrt an object role R and a concept C
 	TDLConceptExpression* Forall ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectForall(R,C)); }
+		{ return binary<TDLConceptObjectForall>(etObjectForall,R,C); }
 		/// get min cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* MinCardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectMinCardinality(n,R,C)); }
+		{ return cardinality<TDLConceptObjectMinCardinality>(etObjectMinCard,n,R,C); }
 		/// get max cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* MaxCardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectMaxCardinality(n,R,C)); }
+		{ return cardinality<TDLConceptObjectMaxCardinality>(etObjectMaxCard,n,R,C); }
 		/// get exact cardinality restriction wrt number N, an object role R and a concept C
 	TDLConceptExpression* Cardinality ( unsigned int n, const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLConceptObjectExactCardinality(n,R,C)); }
+		{ return cardinality<TDLConceptObjectExactCardinality>(etObjectExactCard,n,R,C); }
 
 		/// get value restriction wrt a data role R and a data value V
 	TDLConceptExpression* Value ( const TDLDataRoleExpression* R, const TDLDataValue* V )
-		{ return record(new TDLConceptDataValue(R,V)); }
+		{ return binary<TDLConceptDataValue>(etDataValue,R,V); }
 		/// get existential restriction wrt a data role R and a data expression E
 	TDLConceptExpression* Exists ( const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataExists(R,E)); }
+		{ return binary<TDLConceptDataExists>(etDataExists,R,E); }
 		/// get universal restriction wrt a data role R and a data expression E
 	TDLConceptExpression* Forall ( const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataForall(R,E)); }
+		{ return binary<TDLConceptDataForall>(etDataForall,R,E); }
 		/// get min cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* MinCardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataMinCardinality(n,R,E)); }
+		{ return cardinality<TDLConceptDataMinCardinality>(etDataMinCard,n,R,E); }
 		/// get max cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* MaxCardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataMaxCardinality(n,R,E)); }
+		{ return cardinality<TDLConceptDataMaxCardinality>(etDataMaxCard,n,R,E); }
 		/// get exact cardinality restriction wrt number N, a data role R and a data expression E
 	TDLConceptExpression* Cardinality ( unsigned int n, const TDLDataRoleExpression* R, const TDLDataExpression* E )
-		{ return record(new TDLConceptDataExactCardinality(n,R,E)); }
+		{ return cardinality<TDLConceptDataExactCardinality>(etDataExactCard,n,R,E); }
 
 	// individuals
 
 		/// get named individual
-	TDLIndividualName* Individual ( const std::string& name ) { return NS_I.insert(name); }
+	TDLIndividualName* Individual ( const std::string& name ) { return registerName(NS_I.insert(name)); }
 
 	// object roles
 
@@ -261,17 +392,17 @@ public:		// interface
 		/// get BOTTOM object role
 	TDLObjectRoleExpression* ObjectRoleBottom ( void ) const { return ORBottom; }
 		/// get named object role
-	TDLObjectRoleName* ObjectRole ( const std::string& name ) { return NS_OR.insert(name); }
+	TDLObjectRoleName* ObjectRole ( const std::string& name ) { return registerName(NS_OR.insert(name)); }
 		/// get an inverse of a given object role expression R
 	TDLObjectRoleExpression* Inverse ( const TDLObjectRoleExpression* R ) { return InverseRoleCache.get(R); }
 		/// get a role chain corresponding to R1 o ... o Rn; take the arguments from the last argument list
-	TDLObjectRoleComplexExpression* Compose ( void ) { return record(new TDLObjectRoleChain(getArgList())); }
+	TDLObjectRoleComplexExpression* Compose ( void ) { return nAry<TDLObjectRoleChain>(etChain); }
 		/// get a expression corresponding to R projected from C
 	TDLObjectRoleComplexExpression* ProjectFrom ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLObjectRoleProjectionFrom(R,C)); }
+		{ return binary<TDLObjectRoleProjectionFrom>(etProjectFrom,R,C); }
 		/// get a expression corresponding to R projected into C
 	TDLObjectRoleComplexExpression* ProjectInto ( const TDLObjectRoleExpression* R, const TDLConceptExpression* C )
-		{ return record(new TDLObjectRoleProjectionInto(R,C)); }
+		{ return binary<TDLObjectRoleProjectionInto>(etProjectInto,R,C); }
 
 	// data roles
 
@@ -280,7 +411,7 @@ public:		// interface
 		/// get BOTTOM data role
 	TDLDataRoleExpression* DataRoleBottom ( void ) const { return DRBottom; }
 		/// get named data role
-	TDLDataRoleName* DataRole ( const std::string& name ) { return NS_DR.insert(name); }
+	TDLDataRoleName* DataRole ( const std::string& name ) { return registerName(NS_DR.insert(name)); }
 
 	// data expressions
 
@@ -301,6 +432,8 @@ public:		// interface
 	TDLDataTypeName* getBoolDataType ( void ) { return DataType(TDataTypeManager::getBoolTypeName()); }
 		/// get basic date-time data type
 	TDLDataTypeName* getTimeDataType ( void ) { return DataType(TDataTypeManager::getTimeTypeName()); }
+		/// @return the basic data type (or data top) that corresponds to the standard datatype IRI; NULL if it is not supported
+	TDLDataExpression* getBuiltInDataType ( const std::string& iri );
 
 		/// get basic boolean data type
 	TDLDataTypeRestriction* RestrictedType ( TDLDataTypeExpression* type, const TDLFacetExpression* facet )
@@ -321,22 +454,27 @@ public:		// interface
 		// That is, value of a type positiveInteger will be of a type Integer
 	const TDLDataValue* DataValue ( const std::string& value, TDLDataTypeExpression* type ) { return getBasicDataType(type)->getValue(value); }
 		/// get negation of a data expression E
-	TDLDataExpression* DataNot ( const TDLDataExpression* E ) { return record(new TDLDataNot(E)); }
+	TDLDataExpression* DataNot ( const TDLDataExpression* E )
+		{ return unary<TDLDataNot>(etDataNot,E); }
 		/// get an n-ary data conjunction expression; take the arguments from the last argument list
-	TDLDataExpression* DataAnd ( void ) { return record(new TDLDataAnd(getArgList())); }
+	TDLDataExpression* DataAnd ( void ) { return nAry<TDLDataAnd>(etDataAnd); }
 		/// get an n-ary data disjunction expression; take the arguments from the last argument list
-	TDLDataExpression* DataOr ( void ) { return record(new TDLDataOr(getArgList())); }
+	TDLDataExpression* DataOr ( void ) { return nAry<TDLDataOr>(etDataOr); }
 		/// get an n-ary data one-of expression; take the arguments from the last argument list
-	TDLDataExpression* DataOneOf ( void ) { return record(new TDLDataOneOf(getArgList())); }
+	TDLDataExpression* DataOneOf ( void ) { return nAry<TDLDataOneOf>(etDataOneOf); }
 
 		/// get minInclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMinInclusive ( const TDLDataValue* V ) { return record(new TDLFacetMinInclusive(V)); }
+	const TDLFacetExpression* FacetMinInclusive ( const TDLDataValue* V )
+		{ return unary<TDLFacetMinInclusive>(etFacetMinIncl,V); }
 		/// get minExclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMinExclusive ( const TDLDataValue* V ) { return record(new TDLFacetMinExclusive(V)); }
+	const TDLFacetExpression* FacetMinExclusive ( const TDLDataValue* V )
+		{ return unary<TDLFacetMinExclusive>(etFacetMinExcl,V); }
 		/// get maxInclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMaxInclusive ( const TDLDataValue* V ) { return record(new TDLFacetMaxInclusive(V)); }
+	const TDLFacetExpression* FacetMaxInclusive ( const TDLDataValue* V )
+		{ return unary<TDLFacetMaxInclusive>(etFacetMaxIncl,V); }
 		/// get maxExclusive facet with a given VALUE
-	const TDLFacetExpression* FacetMaxExclusive ( const TDLDataValue* V ) { return record(new TDLFacetMaxExclusive(V)); }
+	const TDLFacetExpression* FacetMaxExclusive ( const TDLDataValue* V )
+		{ return unary<TDLFacetMaxExclusive>(etFacetMaxExcl,V); }
 
 }; // TExpressionManager
 
@@ -32,16 +32,21 @@ protected:	// members
 	TBox& KB;
 		/// signature of non-trivial entities; used in semantic locality checkers only
 	const TSignature* sig;
+		/// true iff the named entities remember their KB entries; false if the entities are shared between KBs
+	bool bindEntities;
 
 #define THROW_UNSUPPORTED(name) \
 	throw EFaCTPlusPlus("Unsupported expression '" name "' in transformation")
 
 protected:	// methods
+		/// @return the KB entry remembered by an ENTITY; NULL if none or if entities are not bound
+	TNamedEntry* boundEntry ( const TNamedEntity* entity ) const { return bindEntities ? entity->getEntry() : NULL; }
 		/// create DLTree of given TAG and named ENTRY; set the entry's ENTITY if necessary
 	TNamedEntry* matchEntry ( TNamedEntry* entry, const TNamedEntity* entity )
 	{
 		entry->setEntity(entity);
-		const_cast<TNamedEntity*>(entity)->setEntry(entry);
+		if ( bindEntities )
+			const_cast<TNamedEntity*>(entity)->setEntry(entry);
 		return entry;
 	}
 		/// @return true iff ENTRY is not in signature
@@ -49,7 +54,7 @@ protected:	// methods
 
 public:		// interface
 		/// empty c'tor
-	TExpressionTranslator ( TBox& kb ) : tree(NULL), KB(kb), sig(NULL) {}
+	TExpressionTranslator ( TBox& kb ) : tree(NULL), KB(kb), sig(NULL), bindEntities(true) {}
 		/// empty d'tor
 	virtual ~TExpressionTranslator ( void ) { deleteTree(tree); }
 
@@ -57,6 +62,8 @@ public:		// interface
 	operator DLTree* ( void ) { DLTree* ret = tree; tree = NULL; return ret; }
 		/// set internal signature to a given signature S
 	void setSignature ( const TSignature* s ) { sig = s; }
+		/// set whether the named entities should remember their KB entries
+	void setBindEntities ( bool value ) { bindEntities = value; }
 
 public:		// visitor interface
 	// concept expressions
@@ -68,7 +75,7 @@ public:		// visitor interface
 			tree = sig->topCLocal() ? createTop() : createBottom();
 		else
 		{
-			TNamedEntry* entry = expr.getEntry();
+			TNamedEntry* entry = boundEntry(&expr);
 			if ( entry == NULL )
 				entry = matchEntry ( KB.getConcept(expr.getName()), &expr );
 			tree = createEntry(CNAME,entry);
@@ -210,7 +217,7 @@ public:		// visitor interface
 	// individual expressions
 	virtual void visit ( const TDLIndividualName& expr )
 	{
-		TNamedEntry* entry = expr.getEntry();
+		TNamedEntry* entry = boundEntry(&expr);
 		if ( entry == NULL )
 			entry = matchEntry ( KB.getIndividual(expr.getName()), &expr );
 		tree = createEntry(INAME,entry);
@@ -227,7 +234,7 @@ public:		// visitor interface
 			role = sig->topRLocal() ? RM->getTopRole() : RM->getBotRole();
 		else
 		{
-			role = expr.getEntry();
+			role = boundEntry(&expr);
 			if ( role == NULL )
 				role = matchEntry ( RM->ensureRoleName(expr.getName()), &expr );
 		}
@@ -279,7 +286,7 @@ public:		// visitor interface
 			role = sig->topRLocal() ? RM->getTopRole() : RM->getBotRole();
 		else
 		{
-			role = expr.getEntry();
+			role = boundEntry(&expr);
 			if ( role == NULL )
 				role = matchEntry ( RM->ensureRoleName(expr.getName()), &expr );
 		}
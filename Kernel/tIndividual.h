@@ -94,7 +94,7 @@ private:	// no copy
 
 public:		// interface
 		/// the only c'tor
-	explicit TIndividual ( const std::string& name )
+	explicit TIndividual ( const TNameRef& name )
 		: TConcept(name)
 		, node(NULL)
 		, pRelatedMap(new TRelatedMap())
@@ -0,0 +1,589 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "tLocalityConditions.h"
+#include "tDataTypeManager.h"
+#include "fpp_assert.h"
+
+/// helper class to build the code of the conditions
+class LocalityCode
+{
+public:		// types
+		/// code of a condition
+	typedef TLocalityConditions::Code Code;
+		/// list of codes of the arguments
+	typedef std::vector<Code> CodeVec;
+
+public:		// interface
+		/// constant VAL
+	static Code constant ( bool val ) { return Code ( 1, val ? TLocalityConditions::lcTrue : TLocalityConditions::lcFalse ); }
+		/// @return true iff C is a constant VAL
+	static bool isConst ( const Code& c, bool val ) { return c.size() == 1 && c[0] == (unsigned int)(val ? TLocalityConditions::lcTrue : TLocalityConditions::lcFalse); }
+		/// condition "ENTITY is not in the signature"
+	static Code nc ( const TNamedEntity* entity ) { return Code ( 1, TLocalityConditions::lcNC | (entity->getId() << TLocalityConditions::OpBits) ); }
+		/// negation of C
+	static Code Not ( const Code& c )
+	{
+		if ( c.size() == 1 && (c[0] == TLocalityConditions::lcTrue || c[0] == TLocalityConditions::lcFalse) )
+			return constant(c[0] == TLocalityConditions::lcFalse);
+		if ( c[0] == TLocalityConditions::lcNot )
+			return Code ( c.begin()+1, c.end() );
+		Code ret ( 1, TLocalityConditions::lcNot );
+		ret.insert ( ret.end(), c.begin(), c.end() );
+		return ret;
+	}
+		/// at least K of ARGS are true
+	static Code atLeast ( unsigned int k, const CodeVec& args )
+	{
+		// remove constants
+		std::vector<const Code*> rest;
+		for ( CodeVec::const_iterator p = args.begin(), p_end = args.end(); p != p_end; ++p )
+			if ( isConst ( *p, true ) )
+			{
+				if ( k > 0 )
+					--k;
+			}
+			else if ( !isConst ( *p, false ) )
+				rest.push_back(&*p);
+		if ( k == 0 )
+			return constant(true);
+		if ( k > rest.size() )
+			return constant(false);
+		if ( rest.size() == 1 )
+			return *rest[0];
+		Code ret;
+		ret.push_back ( TLocalityConditions::lcAtLeast | (k << TLocalityConditions::OpBits) );
+		ret.push_back(rest.size());
+		ret.push_back(0);
+		for ( std::vector<const Code*>::const_iterator p = rest.begin(), p_end = rest.end(); p != p_end; ++p )
+			ret.insert ( ret.end(), (*p)->begin(), (*p)->end() );
+		ret[2] = ret.size()-3;
+		return ret;
+	}
+		/// conjunction of ARGS
+	static Code And ( const CodeVec& args ) { return atLeast ( args.size(), args ); }
+		/// disjunction of ARGS
+	static Code Or ( const CodeVec& args ) { return atLeast ( 1, args ); }
+		/// conjunction of A and B
+	static Code And ( const Code& a, const Code& b )
+	{
+		CodeVec args;
+		args.push_back(a);
+		args.push_back(b);
+		return And(args);
+	}
+		/// disjunction of A and B
+	static Code Or ( const Code& a, const Code& b )
+	{
+		CodeVec args;
+		args.push_back(a);
+		args.push_back(b);
+		return Or(args);
+	}
+}; // LocalityCode
+
+typedef LocalityCode LC;
+typedef LC::Code Code;
+typedef LC::CodeVec CodeVec;
+
+/// common part of the compilers of the TOP- and BOT-equivalence conditions;
+/// mirrors TopEquivalenceEvaluator and BotEquivalenceEvaluator
+class EquivalenceCompiler: public DLExpressionVisitorEmpty
+{
+protected:	// members
+		/// true iff concepts not in the signature are treated as TOPs
+	bool topC;
+		/// true iff roles not in the signature are treated as TOPs
+	bool topR;
+		/// TOP-equivalence compiler
+	EquivalenceCompiler* TopComp;
+		/// BOT-equivalence compiler
+	EquivalenceCompiler* BotComp;
+		/// keep the result here
+	Code Ret;
+
+protected:	// methods
+		/// @return condition of EXPR to be top equivalent
+	Code topEq ( const TDLExpression* expr ) { return TopComp->compile(expr); }
+		/// @return condition of EXPR to be bottom equivalent
+	Code botEq ( const TDLExpression* expr ) { return BotComp->compile(expr); }
+		/// @return condition of a concept name with the entity E to be TOP (if TOP is true) or BOT equivalent
+	Code conceptName ( const TNamedEntity* e, bool top ) const { return topC == top ? LC::nc(e) : LC::constant(false); }
+		/// @return condition of a role name with the entity E to be TOP (if TOP is true) or BOT equivalent
+	Code roleName ( const TNamedEntity* e, bool top ) const { return topR == top ? LC::nc(e) : LC::constant(false); }
+
+		/// condition of C^I being non-empty
+	Code botDistinct ( const TDLExpression* C )
+	{
+		// built-in DT are non-empty
+		if ( dynamic_cast<const TDLDataTypeName*>(C) )
+			return LC::constant(true);
+		// TOP is non-empty
+		return topEq(C);
+	}
+		/// condition of #C^I > n
+	Code cardLargerThan ( const TDLExpression* C, unsigned int n )
+	{
+		if ( n == 0 )	// non-empty is enough
+			return botDistinct(C);
+		if ( const TDLDataTypeName* namedDT = dynamic_cast<const TDLDataTypeName*>(C) )
+		{	// string/time are infinite DT
+			std::string name = namedDT->getName();
+			if ( name == TDataTypeManager::getStrTypeName() || name == TDataTypeManager::getTimeTypeName() )
+				return LC::constant(true);
+		}
+		// data top is infinite
+		if ( dynamic_cast<const TDLDataExpression*>(C) )
+			return topEq(C);
+		return LC::constant(false);
+	}
+
+	// QCRs
+
+		/// condition of (>= n R.C) being botEq
+	Code minBotEq ( unsigned int n, const TDLRoleExpression* R, const TDLExpression* C )
+		{ return n == 0 ? LC::constant(false) : LC::Or ( botEq(R), botEq(C) ); }
+		/// condition of (<= n R.C) being botEq
+	Code maxBotEq ( unsigned int n, const TDLRoleExpression* R, const TDLExpression* C )
+		{ return LC::And ( topEq(R), cardLargerThan ( C, n ) ); }
+		/// condition of (>= n R.C) being topEq
+	Code minTopEq ( unsigned int n, const TDLRoleExpression* R, const TDLExpression* C )
+		{ return n == 0 ? LC::constant(true) : LC::And ( topEq(R), cardLargerThan ( C, n-1 ) ); }
+		/// condition of (<= n R.C) being topEq
+	Code maxTopEq ( unsigned int n ATTR_UNUSED, const TDLRoleExpression* R, const TDLExpression* C )
+		{ return LC::Or ( botEq(R), botEq(C) ); }
+
+public:		// interface
+		/// init c'tor
+	EquivalenceCompiler ( bool c, bool r ) : topC(c), topR(r), TopComp(NULL), BotComp(NULL) {}
+		/// empty d'tor
+	virtual ~EquivalenceCompiler ( void ) {}
+
+		/// set the compilers of both kinds
+	void setCompilers ( EquivalenceCompiler* top, EquivalenceCompiler* bot ) { TopComp = top; BotComp = bot; }
+		/// @return the condition of EXPR
+	Code compile ( const TDLExpression* expr )
+	{
+		expr->accept(*this);
+		return Ret;
+	}
+}; // EquivalenceCompiler
+
+/// compile the conditions of the bottom-equivalence
+class BotEquivalenceCompiler: public EquivalenceCompiler
+{
+public:		// interface
+		/// init c'tor
+	BotEquivalenceCompiler ( bool c, bool r ) : EquivalenceCompiler ( c, r ) {}
+
+protected:	// methods
+		/// @return the conjunction of the conditions of ARGS
+	template<class Iterator>
+	Code botEqAnd ( Iterator begin, Iterator end )
+	{
+		CodeVec args;
+		for ( ; begin != end; ++begin )
+			args.push_back(botEq(*begin));
+		return LC::And(args);
+	}
+		/// @return the disjunction of the conditions of ARGS
+	template<class Iterator>
+	Code botEqOr ( Iterator begin, Iterator end )
+	{
+		CodeVec args;
+		for ( ; begin != end; ++begin )
+			args.push_back(botEq(*begin));
+		return LC::Or(args);
+	}
+
+public:		// visitor interface
+	// concept expressions
+	virtual void visit ( const TDLConceptTop& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLConceptBottom& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLConceptName& expr ) { Ret = conceptName ( expr.getEntity(), false ); }
+	virtual void visit ( const TDLConceptNot& expr ) { Ret = topEq(expr.getC()); }
+	virtual void visit ( const TDLConceptAnd& expr ) { Ret = botEqOr ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLConceptOr& expr ) { Ret = botEqAnd ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLConceptOneOf& expr ) { Ret = LC::constant(expr.empty()); }
+	virtual void visit ( const TDLConceptObjectSelf& expr ) { Ret = botEq(expr.getOR()); }
+	virtual void visit ( const TDLConceptObjectValue& expr ) { Ret = botEq(expr.getOR()); }
+	virtual void visit ( const TDLConceptObjectExists& expr ) { Ret = minBotEq ( 1, expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectForall& expr ) { Ret = LC::And ( topEq(expr.getOR()), botEq(expr.getC()) ); }
+	virtual void visit ( const TDLConceptObjectMinCardinality& expr )
+		{ Ret = minBotEq ( expr.getNumber(), expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectMaxCardinality& expr )
+		{ Ret = maxBotEq ( expr.getNumber(), expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectExactCardinality& expr )
+	{
+		unsigned int n = expr.getNumber();
+		const TDLObjectRoleExpression* R = expr.getOR();
+		const TDLConceptExpression* C = expr.getC();
+		Ret = LC::Or ( minBotEq ( n, R, C ), maxBotEq ( n, R, C ) );
+	}
+	virtual void visit ( const TDLConceptDataValue& expr ) { Ret = botEq(expr.getDR()); }
+	virtual void visit ( const TDLConceptDataExists& expr ) { Ret = minBotEq ( 1, expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataForall& expr )
+		{ Ret = LC::And ( topEq(expr.getDR()), LC::Not(topEq(expr.getExpr())) ); }
+	virtual void visit ( const TDLConceptDataMinCardinality& expr )
+		{ Ret = minBotEq ( expr.getNumber(), expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataMaxCardinality& expr )
+		{ Ret = maxBotEq ( expr.getNumber(), expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataExactCardinality& expr )
+	{
+		unsigned int n = expr.getNumber();
+		const TDLDataRoleExpression* R = expr.getDR();
+		const TDLDataExpression* D = expr.getExpr();
+		Ret = LC::Or ( minBotEq ( n, R, D ), maxBotEq ( n, R, D ) );
+	}
+
+	// object role expressions
+	virtual void visit ( const TDLObjectRoleTop& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLObjectRoleBottom& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLObjectRoleName& expr ) { Ret = roleName ( expr.getEntity(), false ); }
+	virtual void visit ( const TDLObjectRoleInverse& expr ) { Ret = botEq(expr.getOR()); }
+	virtual void visit ( const TDLObjectRoleChain& expr ) { Ret = botEqOr ( expr.begin(), expr.end() ); }
+		// FaCT++ extension: equivalent to R(x,y) and C(x), so copy behaviour from ER.X
+	virtual void visit ( const TDLObjectRoleProjectionFrom& expr ) { Ret = minBotEq ( 1, expr.getOR(), expr.getC() ); }
+		// FaCT++ extension: equivalent to R(x,y) and C(y), so copy behaviour from ER.X
+	virtual void visit ( const TDLObjectRoleProjectionInto& expr ) { Ret = minBotEq ( 1, expr.getOR(), expr.getC() ); }
+
+	// data role expressions
+	virtual void visit ( const TDLDataRoleTop& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataRoleBottom& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLDataRoleName& expr ) { Ret = roleName ( expr.getEntity(), false ); }
+
+	// data expressions
+	virtual void visit ( const TDLDataTop& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataBottom& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLDataTypeName& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataTypeRestriction& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataValue& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataNot& expr ) { Ret = topEq(expr.getExpr()); }
+	virtual void visit ( const TDLDataAnd& expr ) { Ret = botEqOr ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLDataOr& expr ) { Ret = botEqAnd ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLDataOneOf& expr ) { Ret = LC::constant(expr.empty()); }
+}; // BotEquivalenceCompiler
+
+/// compile the conditions of the top-equivalence
+class TopEquivalenceCompiler: public EquivalenceCompiler
+{
+public:		// interface
+		/// init c'tor
+	TopEquivalenceCompiler ( bool c, bool r ) : EquivalenceCompiler ( c, r ) {}
+
+protected:	// methods
+		/// @return the conjunction of the conditions of ARGS
+	template<class Iterator>
+	Code topEqAnd ( Iterator begin, Iterator end )
+	{
+		CodeVec args;
+		for ( ; begin != end; ++begin )
+			args.push_back(topEq(*begin));
+		return LC::And(args);
+	}
+		/// @return the disjunction of the conditions of ARGS
+	template<class Iterator>
+	Code topEqOr ( Iterator begin, Iterator end )
+	{
+		CodeVec args;
+		for ( ; begin != end; ++begin )
+			args.push_back(topEq(*begin));
+		return LC::Or(args);
+	}
+
+public:		// visitor interface
+	// concept expressions
+	virtual void visit ( const TDLConceptTop& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLConceptBottom& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLConceptName& expr ) { Ret = conceptName ( expr.getEntity(), true ); }
+	virtual void visit ( const TDLConceptNot& expr ) { Ret = botEq(expr.getC()); }
+	virtual void visit ( const TDLConceptAnd& expr ) { Ret = topEqAnd ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLConceptOr& expr ) { Ret = topEqOr ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLConceptOneOf& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLConceptObjectSelf& expr ) { Ret = topEq(expr.getOR()); }
+	virtual void visit ( const TDLConceptObjectValue& expr ) { Ret = topEq(expr.getOR()); }
+	virtual void visit ( const TDLConceptObjectExists& expr ) { Ret = minTopEq ( 1, expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectForall& expr ) { Ret = LC::Or ( topEq(expr.getC()), botEq(expr.getOR()) ); }
+	virtual void visit ( const TDLConceptObjectMinCardinality& expr )
+		{ Ret = minTopEq ( expr.getNumber(), expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectMaxCardinality& expr )
+		{ Ret = maxTopEq ( expr.getNumber(), expr.getOR(), expr.getC() ); }
+	virtual void visit ( const TDLConceptObjectExactCardinality& expr )
+	{
+		unsigned int n = expr.getNumber();
+		const TDLObjectRoleExpression* R = expr.getOR();
+		const TDLConceptExpression* C = expr.getC();
+		Ret = LC::And ( minTopEq ( n, R, C ), maxTopEq ( n, R, C ) );
+	}
+	virtual void visit ( const TDLConceptDataValue& expr ) { Ret = topEq(expr.getDR()); }
+	virtual void visit ( const TDLConceptDataExists& expr ) { Ret = minTopEq ( 1, expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataForall& expr ) { Ret = LC::Or ( topEq(expr.getExpr()), botEq(expr.getDR()) ); }
+	virtual void visit ( const TDLConceptDataMinCardinality& expr )
+		{ Ret = minTopEq ( expr.getNumber(), expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataMaxCardinality& expr )
+		{ Ret = maxTopEq ( expr.getNumber(), expr.getDR(), expr.getExpr() ); }
+	virtual void visit ( const TDLConceptDataExactCardinality& expr )
+	{
+		unsigned int n = expr.getNumber();
+		const TDLDataRoleExpression* R = expr.getDR();
+		const TDLDataExpression* D = expr.getExpr();
+		Ret = LC::And ( minTopEq ( n, R, D ), maxTopEq ( n, R, D ) );
+	}
+
+	// object role expressions
+	virtual void visit ( const TDLObjectRoleTop& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLObjectRoleBottom& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLObjectRoleName& expr ) { Ret = roleName ( expr.getEntity(), true ); }
+	virtual void visit ( const TDLObjectRoleInverse& expr ) { Ret = topEq(expr.getOR()); }
+	virtual void visit ( const TDLObjectRoleChain& expr ) { Ret = topEqAnd ( expr.begin(), expr.end() ); }
+		// FaCT++ extension: equivalent to R(x,y) and C(x), so copy behaviour from ER.X
+	virtual void visit ( const TDLObjectRoleProjectionFrom& expr ) { Ret = minTopEq ( 1, expr.getOR(), expr.getC() ); }
+		// FaCT++ extension: equivalent to R(x,y) and C(y), so copy behaviour from ER.X
+	virtual void visit ( const TDLObjectRoleProjectionInto& expr ) { Ret = minTopEq ( 1, expr.getOR(), expr.getC() ); }
+
+	// data role expressions
+	virtual void visit ( const TDLDataRoleTop& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLDataRoleBottom& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataRoleName& expr ) { Ret = roleName ( expr.getEntity(), true ); }
+
+	// data expressions
+	virtual void visit ( const TDLDataTop& ) { Ret = LC::constant(true); }
+	virtual void visit ( const TDLDataBottom& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataTypeName& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataTypeRestriction& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataValue& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLDataNot& expr ) { Ret = botEq(expr.getExpr()); }
+	virtual void visit ( const TDLDataAnd& expr ) { Ret = topEqAnd ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLDataOr& expr ) { Ret = topEqOr ( expr.begin(), expr.end() ); }
+	virtual void visit ( const TDLDataOneOf& ) { Ret = LC::constant(false); }
+}; // TopEquivalenceCompiler
+
+/// compile the locality conditions of axioms; mirrors GeneralSyntacticLocalityChecker
+class LocalityConditionCompiler: public DLAxiomVisitor
+{
+protected:	// members
+		/// top-equivalence compiler
+	TopEquivalenceCompiler TopComp;
+		/// bottom-equivalence compiler
+	BotEquivalenceCompiler BotComp;
+		/// keep the result here
+	Code Ret;
+
+protected:	// methods
+		/// @return condition of EXPR to be top equivalent
+	Code topEq ( const TDLExpression* expr ) { return TopComp.compile(expr); }
+		/// @return condition of EXPR to be bottom equivalent
+	Code botEq ( const TDLExpression* expr ) { return BotComp.compile(expr); }
+		/// @return condition of EXPR to be either top or bottom equivalent
+	Code topOrBotEq ( const TDLExpression* expr ) { return LC::Or ( botEq(expr), topEq(expr) ); }
+
+		/// condition for all Equivalent axioms
+	template<class Entity>
+	Code processEquivalentAxiom ( const TDLNAryExpression<Entity>& axiom )
+	{
+		// 1 element => local
+		if ( axiom.size() <= 1 )
+			return LC::constant(true);
+		// axiom is local iff all the elements are bot-eq, or the first is not bot-eq and all are top-eq
+		CodeVec bot, top;
+		for ( typename TDLNAryExpression<Entity>::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+		{
+			bot.push_back(botEq(*p));
+			top.push_back(topEq(*p));
+		}
+		top.push_back(LC::Not(bot[0]));
+		return LC::Or ( LC::And(bot), LC::And(top) );
+	}
+		/// condition for all Disjoint axioms
+	template<class Entity>
+	Code processDisjointAxiom ( const TDLNAryExpression<Entity>& axiom )
+	{
+		if ( axiom.size() <= 1 )
+			return LC::constant(true);
+		// local iff at most 1 element is not bot-equiv
+		CodeVec bot;
+		for ( typename TDLNAryExpression<Entity>::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+			bot.push_back(botEq(*p));
+		return LC::atLeast ( bot.size()-1, bot );
+	}
+
+public:		// interface
+		/// init c'tor for the given concept and role locality
+	LocalityConditionCompiler ( bool topC, bool topR )
+		: TopComp ( topC, topR )
+		, BotComp ( topC, topR )
+	{
+		TopComp.setCompilers ( &TopComp, &BotComp );
+		BotComp.setCompilers ( &TopComp, &BotComp );
+	}
+		/// empty d'tor
+	virtual ~LocalityConditionCompiler ( void ) {}
+
+		/// @return the locality condition of an AXIOM
+	const Code& compile ( const TDLAxiom* axiom )
+	{
+		axiom->accept(*this);
+		return Ret;
+	}
+
+public:		// visitor interface
+	virtual void visit ( const TDLAxiomDeclaration& ) { Ret = LC::constant(true); }
+
+	virtual void visit ( const TDLAxiomEquivalentConcepts& axiom ) { Ret = processEquivalentAxiom(axiom); }
+	virtual void visit ( const TDLAxiomDisjointConcepts& axiom ) { Ret = processDisjointAxiom(axiom); }
+	virtual void visit ( const TDLAxiomDisjointUnion& axiom )
+	{
+		// DisjointUnion(A, C1,..., Cn) is local if
+		//    (1) A and all of Ci are bot-equivalent,
+		// or (2) A and one Ci are top-equivalent and the remaining Cj are bot-equivalent
+		Code lhsTop = topEq(axiom.getC());
+		CodeVec bot, descTop;
+		for ( TDLAxiomDisjointUnion::iterator p = axiom.begin(), p_end = axiom.end(); p != p_end; ++p )
+		{
+			Code b = botEq(*p);
+			descTop.push_back ( LC::And ( LC::Not(b), topEq(*p) ) );
+			bot.push_back(b);
+		}
+		// (1) is only checked if A is not top-eq
+		CodeVec first;
+		first.push_back(LC::Not(lhsTop));
+		first.push_back(botEq(axiom.getC()));
+		first.push_back(LC::And(bot));
+		// (2): at most one Ci is not bot-eq, and there is a top-eq one among them
+		CodeVec second;
+		second.push_back(lhsTop);
+		second.push_back(bot.empty() ? LC::constant(true) : LC::atLeast ( bot.size()-1, bot ));
+		second.push_back(LC::Or(descTop));
+		Ret = LC::Or ( LC::And(first), LC::And(second) );
+	}
+	virtual void visit ( const TDLAxiomEquivalentORoles& axiom ) { Ret = processEquivalentAxiom(axiom); }
+	virtual void visit ( const TDLAxiomEquivalentDRoles& axiom ) { Ret = processEquivalentAxiom(axiom); }
+	virtual void visit ( const TDLAxiomDisjointORoles& axiom ) { Ret = processDisjointAxiom(axiom); }
+	virtual void visit ( const TDLAxiomDisjointDRoles& axiom ) { Ret = processDisjointAxiom(axiom); }
+	virtual void visit ( const TDLAxiomSameIndividuals& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLAxiomDifferentIndividuals& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLAxiomFairnessConstraint& ) { Ret = LC::constant(true); }
+
+	virtual void visit ( const TDLAxiomRoleInverse& axiom )
+	{
+		Ret = LC::Or ( LC::And ( botEq(axiom.getRole()), botEq(axiom.getInvRole()) ),
+					   LC::And ( topEq(axiom.getRole()), topEq(axiom.getInvRole()) ) );
+	}
+	virtual void visit ( const TDLAxiomORoleSubsumption& axiom ) { Ret = LC::Or ( topEq(axiom.getRole()), botEq(axiom.getSubRole()) ); }
+	virtual void visit ( const TDLAxiomDRoleSubsumption& axiom ) { Ret = LC::Or ( topEq(axiom.getRole()), botEq(axiom.getSubRole()) ); }
+	virtual void visit ( const TDLAxiomORoleDomain& axiom ) { Ret = LC::Or ( topEq(axiom.getDomain()), botEq(axiom.getRole()) ); }
+	virtual void visit ( const TDLAxiomDRoleDomain& axiom ) { Ret = LC::Or ( topEq(axiom.getDomain()), botEq(axiom.getRole()) ); }
+	virtual void visit ( const TDLAxiomORoleRange& axiom ) { Ret = LC::Or ( topEq(axiom.getRange()), botEq(axiom.getRole()) ); }
+	virtual void visit ( const TDLAxiomDRoleRange& axiom ) { Ret = LC::Or ( topEq(axiom.getRange()), botEq(axiom.getRole()) ); }
+	virtual void visit ( const TDLAxiomRoleTransitive& axiom ) { Ret = topOrBotEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomRoleReflexive& axiom ) { Ret = topEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomRoleIrreflexive& axiom ) { Ret = botEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomRoleSymmetric& axiom ) { Ret = topOrBotEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomRoleAsymmetric& ) { Ret = LC::constant(false); }
+	virtual void visit ( const TDLAxiomORoleFunctional& axiom ) { Ret = botEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomDRoleFunctional& axiom ) { Ret = botEq(axiom.getRole()); }
+	virtual void visit ( const TDLAxiomRoleInverseFunctional& axiom ) { Ret = botEq(axiom.getRole()); }
+
+	virtual void visit ( const TDLAxiomConceptInclusion& axiom ) { Ret = LC::Or ( botEq(axiom.getSubC()), topEq(axiom.getSupC()) ); }
+	virtual void visit ( const TDLAxiomInstanceOf& axiom ) { Ret = topEq(axiom.getC()); }
+	virtual void visit ( const TDLAxiomRelatedTo& axiom ) { Ret = topEq(axiom.getRelation()); }
+	virtual void visit ( const TDLAxiomRelatedToNot& axiom ) { Ret = botEq(axiom.getRelation()); }
+	virtual void visit ( const TDLAxiomValueOf& axiom ) { Ret = topEq(axiom.getAttribute()); }
+	virtual void visit ( const TDLAxiomValueOfNot& axiom ) { Ret = botEq(axiom.getAttribute()); }
+
+	virtual void visitOntology ( TOntology& ) {}
+}; // LocalityConditionCompiler
+
+void
+TLocalityConditions :: add ( const TDLAxiom* axiom )
+{
+	for ( unsigned int k = 0; k < 4; ++k )
+	{
+		LocalityConditionCompiler Compiler ( /*topC=*/k > 1, /*topR=*/k % 2 );
+		const Code& code = Compiler.compile(axiom);
+		AllCode[k].insert ( AllCode[k].end(), code.begin(), code.end() );
+		Start[k].push_back(AllCode[k].size());
+	}
+}
+
+bool
+TLocalityConditions :: eval ( const unsigned int*& p, const TDenseSignature& sig )
+{
+	const unsigned int w = *p++;
+	switch ( w & OpMask )
+	{
+	case lcFalse:
+		return false;
+	case lcTrue:
+		return true;
+	case lcNC:
+		return !sig.contains(w >> OpBits);
+	case lcNot:
+		return !eval ( p, sig );
+	case lcAtLeast:
+	{
+		unsigned int k = w >> OpBits, n = p[0];
+		const unsigned int* end = p + 2 + p[1];
+		p += 2;
+		// stop as soon as either K true nodes are found or there are less than K nodes left
+		while ( k <= n )
+		{
+			--n;
+			if ( eval ( p, sig ) && --k == 0 )
+				break;
+		}
+		p = end;
+		return k == 0;
+	}
+	default:
+		fpp_unreachable();
+		return false;
+	}
+}
+
+bool
+TLocalityConditions :: isValid ( const unsigned int*& p, const unsigned int* end )
+{
+	if ( p >= end )
+		return false;
+	const unsigned int w = *p++;
+	switch ( w & OpMask )
+	{
+	case lcFalse:
+	case lcTrue:
+	case lcNC:
+		return true;
+	case lcNot:
+		return isValid ( p, end );
+	case lcAtLeast:
+	{
+		// N nodes should take exactly L words
+		if ( end - p < 2 || (size_t)(end - p - 2) < p[1] )
+			return false;
+		unsigned int n = p[0];
+		const unsigned int* nodesEnd = p + 2 + p[1];
+		p += 2;
+		for ( ; n > 0; --n )
+			if ( !isValid ( p, nodesEnd ) )
+				return false;
+		return p == nodesEnd;
+	}
+	default:
+		return false;
+	}
+}
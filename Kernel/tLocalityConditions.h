@@ -0,0 +1,109 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TLOCALITYCONDITIONS_H
+#define TLOCALITYCONDITIONS_H
+
+#include <vector>
+
+#include "tDLAxiom.h"
+#include "tDenseSignature.h"
+
+class SaveLoadManager;
+
+/// syntactic locality conditions of axioms, compiled once into a compact code over the dense
+/// entity IDs. The result of local() is the same as of the SyntacticLocalityChecker (which
+/// is kept as a reference), but no expression trees are walked during the check.
+///
+/// An axiom has a separate condition for every combination of the concept and role locality,
+/// so the entities of the wrong polarity are folded into constants at compile time
+/// (e.g., for BOT-locality the condition of A [= B is just "A is not in the signature").
+/// The code of a condition is a formula in a prefix form, one word per node
+/// with the opcode in the lower bits:
+/// - lcFalse, lcTrue: constants;
+/// - lcNC(E): entity E is not in the signature;
+/// - lcNot: negation of the following node;
+/// - lcAtLeast(K) N L: at least K of N following nodes (of L words in total) are true;
+///   conjunctions and disjunctions are compiled into it.
+class TLocalityConditions
+{
+	friend class LocalityCode;
+
+public:		// types
+		/// code of a condition
+	typedef std::vector<unsigned int> Code;
+
+protected:	// types
+		/// opcodes
+	enum { lcFalse = 0, lcTrue, lcNC, lcNot, lcAtLeast };
+		/// number of bits of an opcode
+	static const unsigned int OpBits = 3;
+		/// mask of an opcode
+	static const unsigned int OpMask = (1 << OpBits) - 1;
+
+protected:	// members
+		/// condition of the axiom I for the locality kind K is AllCode[K][Start[K][I]..Start[K][I+1])
+	std::vector<unsigned int> Start[4];
+		/// code of all the conditions for the locality kind K = 2*topCLocal + topRLocal
+	Code AllCode[4];
+
+protected:	// methods
+		/// evaluate the node at P wrt SIG; move P to the next node
+	static bool eval ( const unsigned int*& p, const TDenseSignature& sig );
+		/// @return true iff the node at P is well-formed and fits before END; move P to the next node
+	static bool isValid ( const unsigned int*& p, const unsigned int* end );
+
+public:		// interface
+		/// empty c'tor
+	TLocalityConditions ( void ) { clear(); }
+		/// empty d'tor
+	~TLocalityConditions ( void ) {}
+
+		/// remove all the conditions
+	void clear ( void )
+	{
+		for ( int k = 0; k < 4; ++k )
+		{
+			Start[k].assign ( 1, 0 );
+			AllCode[k].clear();
+		}
+	}
+		/// compile the locality conditions of an AXIOM and add them as the last ones
+	void add ( const TDLAxiom* axiom );
+		/// @return number of compiled axioms
+	unsigned int size ( void ) const { return Start[0].size()-1; }
+		/// @return total length of the code
+	size_t codeSize ( void ) const { return AllCode[0].size() + AllCode[1].size() + AllCode[2].size() + AllCode[3].size(); }
+
+		/// @return true iff the I-th axiom is local wrt SIG
+	bool local ( unsigned int i, const TDenseSignature& sig ) const
+	{
+		const unsigned int k = 2*sig.topCLocal() + sig.topRLocal();
+		const unsigned int* p = &AllCode[k][0] + Start[k][i];
+		return eval ( p, sig );
+	}
+
+	// save/load interface; implementation is in SaveLoad.cpp
+
+		/// save the compiled conditions
+	void Save ( SaveLoadManager& m ) const;
+		/// load the compiled conditions
+	void Load ( SaveLoadManager& m );
+}; // TLocalityConditions
+
+#endif
@@ -0,0 +1,174 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "tModuleIndex.h"
+
+void
+TModuleIndex :: preprocessOntology ( const AxiomVec& vec )
+{
+	Axioms.clear();
+	ByAxiomId.clear();
+	SigStart.clear();
+	SigIds.clear();
+	NonLocal[0].clear();
+	NonLocal[1].clear();
+	Conditions.clear();
+
+	// collect the axioms and their signatures
+	unsigned int maxId = 0;
+	SigStart.push_back(0);
+	for ( AxiomVec::const_iterator p = vec.begin(), p_end = vec.end(); p != p_end; ++p )
+	{
+		if ( !(*p)->isUsed() )
+			continue;
+		if ( (*p)->getId() >= ByAxiomId.size() )
+			ByAxiomId.resize ( (*p)->getId()+1, 0 );
+		Axioms.push_back(*p);
+		Conditions.add(*p);
+		ByAxiomId[(*p)->getId()] = Axioms.size();
+		const TSignature& sig = (*p)->getSignature();
+		for ( TSignature::iterator q = sig.begin(), q_end = sig.end(); q != q_end; ++q )
+			if ( (*q)->getId() != 0 )
+			{
+				SigIds.push_back((*q)->getId());
+				if ( (*q)->getId() > maxId )
+					maxId = (*q)->getId();
+			}
+		SigStart.push_back(SigIds.size());
+	}
+
+	// build the entity->axioms map by counting sort
+	Entities.assign ( maxId+1, NULL );
+	EntStart.assign ( maxId+2, 0 );
+	for ( std::vector<unsigned int>::const_iterator q = SigIds.begin(), q_end = SigIds.end(); q != q_end; ++q )
+		++EntStart[*q+1];
+	for ( unsigned int e = 0; e <= maxId; ++e )
+		EntStart[e+1] += EntStart[e];
+	EntAxioms.resize(SigIds.size());
+	std::vector<unsigned int> pos ( EntStart.begin(), EntStart.end()-1 );
+	for ( unsigned int i = 0; i < Axioms.size(); ++i )
+	{
+		const TSignature& sig = Axioms[i]->getSignature();
+		for ( TSignature::iterator q = sig.begin(), q_end = sig.end(); q != q_end; ++q )
+			if ( (*q)->getId() != 0 )
+			{
+				Entities[(*q)->getId()] = *q;
+				EntAxioms[pos[(*q)->getId()]++] = i;
+			}
+	}
+
+	// check the non-locality wrt the empty signature
+	TDenseSignature empty;
+	for ( int top = 0; top < 2; ++top )
+	{
+		empty.setLocality(top);
+		for ( unsigned int i = 0; i < Axioms.size(); ++i )
+			if ( !local ( i, empty ) )
+				NonLocal[top].push_back(i);
+	}
+}
+
+void
+TModuleExtractor :: extractModule ( const TSignature& signature, bool topLocality )
+{
+	clearModule();
+	Sig.clear();
+	Sig.reserve(Index.maxEntityId());
+	Sig.setLocality(topLocality);
+	Sig.add(signature);
+	State.resize(Index.size());
+
+	// add all the axioms that are non-local wrt given value of a top-locality
+	const std::vector<unsigned int>& nonLocal = Index.getNonLocal(topLocality);
+	for ( std::vector<unsigned int>::const_iterator p = nonLocal.begin(), p_end = nonLocal.end(); p != p_end; ++p )
+		addNonLocal ( *p, /*noCheck=*/true );
+
+	// main cycle: the unprocessed part of the signature is the queue
+	for ( nProcessed = 0; nProcessed < Sig.size(); ++nProcessed )
+	{
+		unsigned int id = *(Sig.begin()+nProcessed);
+		for ( const unsigned int *p = Index.ent_begin(id), *p_end = Index.ent_end(id); p != p_end; ++p )
+			addNonLocal ( *p, /*noCheck=*/false );
+	}
+}
+
+void
+TModuleExtractor :: extractRange ( const TSignature& signature, ModuleType type )
+{
+	bool topLocality = (type == M_TOP);
+	extractModule ( signature, topLocality );
+
+	// here there is a star: do the cycle until stabilization
+	if ( type == M_STAR )
+	{
+		size_t size;
+		do
+		{
+			size = ModuleIds.size();
+			setRangeToModule();
+			topLocality = !topLocality;
+			extractModule ( signature, topLocality );
+		} while ( size != ModuleIds.size() );
+	}
+
+	clearRange();
+	Module.clear();
+	Module.reserve(ModuleIds.size());
+	for ( std::vector<unsigned int>::const_iterator p = ModuleIds.begin(), p_end = ModuleIds.end(); p != p_end; ++p )
+		Module.push_back(Index.getAxiom(*p));
+	// the signature of the module is built on demand
+	OutSig = signature;
+	OutSig.setLocality ( Sig.topCLocal(), Sig.topRLocal() );
+	OutSigReady = false;
+}
+
+void
+TModuleExtractor :: extract ( const TSignature& signature, ModuleType type )
+{
+	clearRange();
+	extractRange ( signature, type );
+}
+
+void
+TModuleExtractor :: extract ( const AxiomVec& From, const TSignature& signature, ModuleType type )
+{
+	clearRange();
+	State.resize(Index.size());
+	for ( AxiomVec::const_iterator p = From.begin(), p_end = From.end(); p != p_end; ++p )
+		if ( unsigned int i = Index.getIndex(*p) )
+			if ( !(State[i-1] & stInRange) )
+			{
+				State[i-1] |= stInRange;
+				RangeIds.push_back(i-1);
+			}
+	Restricted = true;
+	extractRange ( signature, type );
+}
+
+const TSignature&
+TModuleExtractor :: getSignature ( void )
+{
+	if ( !OutSigReady )
+	{
+		OutSigReady = true;
+		for ( TDenseSignature::iterator p = Sig.begin(), p_end = Sig.end(); p != p_end; ++p )
+			if ( const TNamedEntity* entity = Index.getEntity(*p) )
+				OutSig.add(entity);
+	}
+	return OutSig;
+}
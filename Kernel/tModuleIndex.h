@@ -0,0 +1,274 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TMODULEINDEX_H
+#define TMODULEINDEX_H
+
+#include <vector>
+
+#include "tOntology.h"
+#include "ModuleType.h"
+#include "SyntacticLocalityChecker.h"
+#include "tLocalityConditions.h"
+#include "tOntologyAtom.h"
+#include "fpp_assert.h"
+
+class SaveLoadManager;
+
+/// read-only index of an ontology for the module extraction over the dense IDs.
+/// Axioms get local indices 0..N-1; both the axiom signatures and the entity->axioms
+/// map are kept in compressed (CSR) form. Once built, the index can be shared by
+/// any number of TModuleExtractor workspaces.
+class TModuleIndex
+{
+protected:	// members
+		/// indexed axioms by their local indices
+	AxiomVec Axioms;
+		/// local index+1 of an axiom by its ontology ID; 0 for the axioms not in the index
+	std::vector<unsigned int> ByAxiomId;
+		/// signature of the axiom I is SigIds[SigStart[I]..SigStart[I+1])
+	std::vector<unsigned int> SigStart;
+		/// entity IDs of all the axiom signatures
+	std::vector<unsigned int> SigIds;
+		/// axioms with an entity E in the signature are EntAxioms[EntStart[E]..EntStart[E+1])
+	std::vector<unsigned int> EntStart;
+		/// local indices of the axioms of all the entities
+	std::vector<unsigned int> EntAxioms;
+		/// entities by their dense IDs
+	std::vector<const TNamedEntity*> Entities;
+		/// axioms non-local wrt the empty signature with BOT- (0) and TOP- (1) locality
+	std::vector<unsigned int> NonLocal[2];
+		/// compiled locality conditions of the axioms by their local indices
+	TLocalityConditions Conditions;
+
+private:	// no copy
+		/// no copy c'tor
+	TModuleIndex ( const TModuleIndex& );
+		/// no assignment
+	TModuleIndex& operator = ( const TModuleIndex& );
+
+public:		// interface
+		/// empty c'tor
+	TModuleIndex ( void ) {}
+		/// empty d'tor
+	~TModuleIndex ( void ) {}
+
+		/// build the index for all the used axioms of VEC; the old content is dropped
+	void preprocessOntology ( const AxiomVec& vec );
+
+	// access to axioms
+
+		/// @return number of the indexed axioms
+	unsigned int size ( void ) const { return Axioms.size(); }
+		/// @return axiom with a local index I
+	TDLAxiom* getAxiom ( unsigned int i ) const { return Axioms[i]; }
+		/// @return local index+1 of an axiom AX; 0 if it is not in the index
+	unsigned int getIndex ( const TDLAxiom* ax ) const
+		{ return ax->getId() < ByAxiomId.size() ? ByAxiomId[ax->getId()] : 0; }
+		/// @return start of the signature of the axiom I
+	const unsigned int* sig_begin ( unsigned int i ) const { return &SigIds[0] + SigStart[i]; }
+		/// @return end of the signature of the axiom I
+	const unsigned int* sig_end ( unsigned int i ) const { return &SigIds[0] + SigStart[i+1]; }
+		/// @return axioms non-local wrt the empty signature with a given value of a TOP-locality
+	const std::vector<unsigned int>& getNonLocal ( bool top ) const { return NonLocal[top]; }
+		/// @return true iff the axiom I is syntactically local wrt SIG
+	bool local ( unsigned int i, const TDenseSignature& sig ) const { return Conditions.local ( i, sig ); }
+		/// @return the compiled locality conditions
+	const TLocalityConditions& getConditions ( void ) const { return Conditions; }
+
+	// access to entities
+
+		/// @return the upper bound of the entity IDs in the index
+	unsigned int maxEntityId ( void ) const { return Entities.size(); }
+		/// @return entity with a dense ID
+	const TNamedEntity* getEntity ( unsigned int id ) const { return id < Entities.size() ? Entities[id] : NULL; }
+		/// @return start of the list of the axioms with the entity ID in the signature
+	const unsigned int* ent_begin ( unsigned int id ) const { return id+1 < EntStart.size() ? &EntAxioms[0] + EntStart[id] : NULL; }
+		/// @return end of the list of the axioms with the entity ID in the signature
+	const unsigned int* ent_end ( unsigned int id ) const { return id+1 < EntStart.size() ? &EntAxioms[0] + EntStart[id+1] : NULL; }
+
+	// save/load interface; implementation is in SaveLoad.cpp
+
+		/// save the index; all the indexed axioms should be registered in M
+	void Save ( SaveLoadManager& m ) const;
+		/// load the index; all the indexed axioms should be registered in M
+	void Load ( SaveLoadManager& m );
+}; // TModuleIndex
+
+/// workspace for the syntactic module extraction over a TModuleIndex.
+/// Does not touch the axiom flags, so any number of extractors can work on the same index
+/// concurrently; all the per-call state is cleared in time proportional to the module size.
+class TModuleExtractor
+{
+protected:	// types
+		/// per-axiom state bits
+	enum { stInModule = 1, stInRange = 2 };
+
+protected:	// members
+		/// index of the ontology
+	const TModuleIndex& Index;
+		/// signature of the current module
+	TDenseSignature Sig;
+#ifdef ENABLE_CHECKING
+		/// reference locality checker wrt Sig
+	SyntacticLocalityChecker Checker;
+#endif
+		/// state of the axioms by their local indices
+	std::vector<unsigned char> State;
+		/// local indices of the axioms in the current module
+	std::vector<unsigned int> ModuleIds;
+		/// local indices of the axioms in the current range (if restricted)
+	std::vector<unsigned int> RangeIds;
+		/// module as a list of axioms
+	AxiomVec Module;
+		/// signature of the module in the TSignature form (built on demand)
+	TSignature OutSig;
+		/// number of the processed entities of Sig
+	size_t nProcessed;
+		/// number of locality check calls
+	unsigned long long nChecks;
+		/// number of non-local axioms
+	unsigned long long nNonLocal;
+		/// true iff the extraction is restricted to the axioms marked stInRange
+	bool Restricted;
+		/// true iff the modules of the axioms' atoms are added to the module without checks
+	bool UseAtoms;
+		/// true iff OutSig is in sync with Sig
+	bool OutSigReady;
+
+private:	// no copy
+		/// no copy c'tor
+	TModuleExtractor ( const TModuleExtractor& );
+		/// no assignment
+	TModuleExtractor& operator = ( const TModuleExtractor& );
+
+protected:	// methods
+		/// add the axiom with a local index I to a module
+	void addAxiomToModule ( unsigned int i )
+	{
+		State[i] |= stInModule;
+		ModuleIds.push_back(i);
+		for ( const unsigned int *p = Index.sig_begin(i), *p_end = Index.sig_end(i); p != p_end; ++p )
+			Sig.add(*p);
+	}
+		/// add the axiom I if it is in range, is not in module and is non-local (or NOCHECK is true)
+	void addNonLocal ( unsigned int i, bool noCheck )
+	{
+		unsigned char st = State[i];
+		if ( (st & stInModule) || ( Restricted && !(st & stInRange) ) )
+			return;
+		if ( !noCheck )
+		{
+			++nChecks;
+			bool isLocal = Index.local ( i, Sig );
+#		ifdef ENABLE_CHECKING
+			fpp_assert ( isLocal == Checker.local(Index.getAxiom(i)) );
+#		endif
+			if ( isLocal )
+				return;
+			++nNonLocal;
+		}
+		addAxiomToModule(i);
+		if ( UseAtoms && !Sig.topCLocal() )
+			if ( const TOntologyAtom* atom = Index.getAxiom(i)->getAtom() )
+				addAtomModule(atom);
+	}
+		/// add all the axioms of the module of an ATOM that are in range
+	void addAtomModule ( const TOntologyAtom* atom )
+	{
+		const TOntologyAtom::AxiomSet& M = atom->getModule();
+		for ( TOntologyAtom::AxiomSet::const_iterator p = M.begin(), p_end = M.end(); p != p_end; ++p )
+			if ( unsigned int i = Index.getIndex(*p) )
+			{
+				unsigned char st = State[i-1];
+				if ( !(st & stInModule) && ( !Restricted || (st & stInRange) ) )
+					addAxiomToModule(i-1);
+			}
+	}
+		/// clear the module part of the state
+	void clearModule ( void )
+	{
+		for ( std::vector<unsigned int>::const_iterator p = ModuleIds.begin(), p_end = ModuleIds.end(); p != p_end; ++p )
+			State[*p] &= ~stInModule;
+		ModuleIds.clear();
+	}
+		/// clear the range part of the state
+	void clearRange ( void )
+	{
+		for ( std::vector<unsigned int>::const_iterator p = RangeIds.begin(), p_end = RangeIds.end(); p != p_end; ++p )
+			State[*p] &= ~stInRange;
+		RangeIds.clear();
+		Restricted = false;
+	}
+		/// set the range to the axioms of the current module
+	void setRangeToModule ( void )
+	{
+		clearRange();
+		// the next module is built from scratch within the range
+		for ( std::vector<unsigned int>::const_iterator p = ModuleIds.begin(), p_end = ModuleIds.end(); p != p_end; ++p )
+			State[*p] = (State[*p] | stInRange) & ~stInModule;
+		RangeIds.swap(ModuleIds);
+		ModuleIds.clear();
+		Restricted = true;
+	}
+		/// build a single module wrt SIGNATURE and TOPLOCALITY within the current range
+	void extractModule ( const TSignature& signature, bool topLocality );
+		/// build a module wrt SIGNATURE and TYPE within the current range; fill Module
+	void extractRange ( const TSignature& signature, ModuleType type );
+
+public:		// interface
+		/// init c'tor
+	TModuleExtractor ( const TModuleIndex& index )
+		: Index(index)
+#	ifdef ENABLE_CHECKING
+		, Checker(&Sig)
+#	endif
+		, nProcessed(0)
+		, nChecks(0)
+		, nNonLocal(0)
+		, Restricted(false)
+		, UseAtoms(false)
+		, OutSigReady(true)
+		{}
+		/// empty d'tor
+	~TModuleExtractor ( void ) {}
+
+		/// use the atoms of the axioms to speed up the BOT-locality extraction. It is correct if the AD is not
+		/// of TOP type, and the range of the extraction is either the whole index or a BOT-module
+	void setUseAtoms ( bool value ) { UseAtoms = value; }
+
+		/// extract module wrt SIGNATURE and TYPE from all the indexed axioms
+	void extract ( const TSignature& signature, ModuleType type );
+		/// extract module wrt SIGNATURE and TYPE from the axioms of FROM; the ones that are not indexed are ignored
+	void extract ( const AxiomVec& From, const TSignature& signature, ModuleType type );
+
+		/// get the last computed module
+	const AxiomVec& getModule ( void ) const { return Module; }
+		/// get the last computed module as local indices of its axioms
+	const std::vector<unsigned int>& getModuleIds ( void ) const { return ModuleIds; }
+		/// get the signature of the last computed module as a dense signature
+	const TDenseSignature& getDenseSignature ( void ) const { return Sig; }
+		/// get the signature of the last computed module
+	const TSignature& getSignature ( void );
+		/// get number of checks made
+	unsigned long long getNChecks ( void ) const { return nChecks; }
+		/// get number of axioms that were non-local
+	unsigned long long getNNonLocal ( void ) const { return nNonLocal; }
+}; // TModuleExtractor
+
+#endif
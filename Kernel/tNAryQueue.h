@@ -75,6 +75,8 @@ public:		// interface
 
 		/// get access to the last closed argument list
 	const DLExpressionArray& getLastArgList ( void ) { return *Base[level--]; }
+		/// drop all the open argument lists (e.g., after an error in the middle of an expression)
+	void clear ( void ) { level = -1; }
 }; // TNAryQueue
 
 #endif
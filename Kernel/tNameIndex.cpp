@@ -0,0 +1,231 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <cstring>
+
+#include "tNameIndex.h"
+
+/// size of a single arena block
+static const size_t ArenaBlockSize = 64*1024;
+/// initial size of the hash table; should be a power of 2
+static const size_t InitialSlots = 64;
+/// namespaces shorter than that are not worth sharing
+static const size_t MinPrefixLength = 8;
+
+TNameIndex :: TNameIndex ( void )
+	: Free(NULL)
+	, FreeSize(0)
+	, ArenaSize(0)
+	, lastPrefix(0)
+	, nNames(0)
+	, nUsedSlots(0)
+	, compressPrefixes(false)
+{
+	Slots.resize(InitialSlots,0);
+	Prefixes.push_back(std::string());
+}
+
+TNameIndex :: ~TNameIndex ( void )
+{
+	for ( std::vector<char*>::iterator p = Blocks.begin(), p_end = Blocks.end(); p != p_end; ++p )
+		delete [] *p;
+}
+
+size_t
+TNameIndex :: getPrefixLength ( const std::string& name ) const
+{
+	if ( !compressPrefixes )
+		return 0;
+	std::string::size_type pos = name.find_last_of("#/");
+	if ( pos == std::string::npos || pos+1 < MinPrefixLength )
+		return 0;
+	return pos+1;
+}
+
+unsigned int
+TNameIndex :: getPrefix ( const char* beg, size_t len )
+{
+	if ( len == 0 )
+		return 0;
+	const std::string& last = Prefixes[lastPrefix];
+	if ( last.size() == len && memcmp ( last.data(), beg, len ) == 0 )
+		return lastPrefix;
+
+	std::string prefix ( beg, len );
+	std::map<std::string, unsigned int>::const_iterator p = PrefixIndex.find(prefix);
+	if ( p != PrefixIndex.end() )
+		return lastPrefix = p->second;
+
+	lastPrefix = Prefixes.size();
+	Prefixes.push_back(prefix);
+	PrefixIndex[prefix] = lastPrefix;
+	return lastPrefix;
+}
+
+bool
+TNameIndex :: matches ( const NameRec& r, const std::string& name, unsigned int h ) const
+{
+	if ( r.Hash != h || r.Suffix == NULL )
+		return false;
+	const std::string& prefix = Prefixes[r.Prefix];
+	return name.size() == prefix.size() + r.Length &&
+		name.compare ( 0, prefix.size(), prefix ) == 0 &&
+		memcmp ( name.data()+prefix.size(), r.Suffix, r.Length ) == 0;
+}
+
+size_t
+TNameIndex :: findSlot ( const std::string& name, unsigned int h ) const
+{
+	size_t mask = Slots.size()-1;
+	for ( size_t i = h & mask; ; i = (i+1) & mask )
+	{
+		unsigned int s = Slots[i];
+		if ( s == 0 || ( s > 1 && matches ( Names[s-2], name, h ) ) )
+			return i;
+	}
+}
+
+const char*
+TNameIndex :: store ( const char* beg, size_t len )
+{
+	char* ret;
+	if ( len+1 > FreeSize )
+	{
+		if ( len+1 > ArenaBlockSize/4 )
+		{	// long name: keep it in its own block, leave the current one as is
+			ret = new char[len+1];
+			Blocks.push_back(ret);
+			ArenaSize += len+1;
+			memcpy ( ret, beg, len );
+			ret[len] = '\0';
+			return ret;
+		}
+		Free = new char[ArenaBlockSize];
+		FreeSize = ArenaBlockSize;
+		Blocks.push_back(Free);
+		ArenaSize += ArenaBlockSize;
+	}
+	ret = Free;
+	memcpy ( ret, beg, len );
+	ret[len] = '\0';
+	Free += len+1;
+	FreeSize -= len+1;
+	return ret;
+}
+
+void
+TNameIndex :: rehash ( size_t size )
+{
+	Slots.assign(size,0);
+	size_t mask = size-1;
+	for ( unsigned int id = 0; id < Names.size(); ++id )
+	{
+		if ( Names[id].Suffix == NULL )	// removed name
+			continue;
+		size_t i = Names[id].Hash & mask;
+		while ( Slots[i] != 0 )
+			i = (i+1) & mask;
+		Slots[i] = id+2;
+	}
+	nUsedSlots = nNames;
+}
+
+unsigned int
+TNameIndex :: find ( const std::string& name ) const
+{
+	unsigned int s = Slots[findSlot ( name, hash ( name.data(), name.size() ) )];
+	return s == 0 ? noName : s-2;
+}
+
+unsigned int
+TNameIndex :: insert ( const std::string& name )
+{
+	unsigned int h = hash ( name.data(), name.size() );
+	size_t slot = findSlot ( name, h );
+	if ( Slots[slot] != 0 )	// already there
+		return Slots[slot]-2;
+
+	// keep the load factor below 1/2
+	if ( 2*(nUsedSlots+1) > Slots.size() )
+	{
+		rehash ( nNames+1 > Slots.size()/4 ? 2*Slots.size() : Slots.size() );
+		slot = findSlot ( name, h );
+	}
+
+	size_t len = getPrefixLength(name);
+	NameRec rec;
+	rec.Prefix = getPrefix ( name.data(), len );
+	rec.Suffix = store ( name.data()+len, name.size()-len );
+	rec.Length = name.size()-len;
+	rec.Hash = h;
+
+	unsigned int id = Names.size();
+	Names.push_back(rec);
+	Slots[slot] = id+2;
+	++nNames;
+	++nUsedSlots;
+	return id;
+}
+
+bool
+TNameIndex :: erase ( const std::string& name )
+{
+	size_t slot = findSlot ( name, hash ( name.data(), name.size() ) );
+	if ( Slots[slot] == 0 )
+		return false;
+	// the characters stay in the arena until the index is cleared
+	Names[Slots[slot]-2].Suffix = NULL;
+	Slots[slot] = 1;
+	--nNames;
+	return true;
+}
+
+void
+TNameIndex :: clear ( void )
+{
+	for ( std::vector<char*>::iterator p = Blocks.begin(), p_end = Blocks.end(); p != p_end; ++p )
+		delete [] *p;
+	Blocks.clear();
+	Free = NULL;
+	FreeSize = 0;
+	ArenaSize = 0;
+	Names.clear();
+	Slots.assign(InitialSlots,0);
+	Prefixes.resize(1);
+	PrefixIndex.clear();
+	lastPrefix = 0;
+	nNames = 0;
+	nUsedSlots = 0;
+}
+
+std::string
+TNameIndex :: getName ( unsigned int id ) const
+{
+	const NameRec& r = Names[id];
+	return Prefixes[r.Prefix] + std::string ( r.Suffix, r.Length );
+}
+
+size_t
+TNameIndex :: getMemoryUsage ( void ) const
+{
+	size_t ret = sizeof(*this) + Names.capacity()*sizeof(NameRec) + Slots.capacity()*sizeof(unsigned int) + ArenaSize;
+	// every prefix is kept in a vector and in a map node
+	for ( std::vector<std::string>::const_iterator p = Prefixes.begin(), p_end = Prefixes.end(); p != p_end; ++p )
+		ret += 2*(sizeof(std::string)+p->capacity()) + 4*sizeof(void*);
+	return ret;
+}
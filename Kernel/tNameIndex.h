@@ -0,0 +1,141 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TNAMEINDEX_H
+#define TNAMEINDEX_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+/// string interner that maps names to dense IDs. The characters of the names are kept
+/// in a block arena, the IDs are found through an open-addressing hash table. With the
+/// prefix compression on, the namespace part of an IRI (up to the last '#' or '/') is
+/// stored once and shared by all the names with that namespace.
+class TNameIndex
+{
+public:		// constants
+		/// ID returned for the unknown names
+	static const unsigned int noName = (unsigned int)-1;
+
+protected:	// types
+		/// information about a single name
+	struct NameRec
+	{
+			/// local part of the name (the whole name if there is no prefix); NULL for the removed names
+		const char* Suffix;
+			/// length of the local part
+		unsigned int Length;
+			/// index of the prefix
+		unsigned int Prefix;
+			/// hash value of the whole name
+		unsigned int Hash;
+	}; // NameRec
+
+protected:	// members
+		/// all the names by their IDs
+	std::vector<NameRec> Names;
+		/// hash table of the name IDs; empty slots are 0, removed ones are 1, others are ID+2
+	std::vector<unsigned int> Slots;
+		/// all the known prefixes by their indices; 0-th is the empty one
+	std::vector<std::string> Prefixes;
+		/// prefix -> index map (used only when a new name is added)
+	std::map<std::string, unsigned int> PrefixIndex;
+		/// arena blocks holding the characters of the names
+	std::vector<char*> Blocks;
+		/// free space in the last block
+	char* Free;
+		/// size of the free space in the last block
+	size_t FreeSize;
+		/// total size of the arena blocks
+	size_t ArenaSize;
+		/// index of the last used prefix (names are often added namespace by namespace)
+	unsigned int lastPrefix;
+		/// number of the names currently in the index
+	unsigned int nNames;
+		/// number of the used (including removed) slots
+	unsigned int nUsedSlots;
+		/// whether the prefix compression is on
+	bool compressPrefixes;
+
+protected:	// methods
+		/// @return hash value of a string [BEG,BEG+LEN)
+	static unsigned int hash ( const char* beg, size_t len )
+	{
+		unsigned int h = 2166136261u;
+		for ( const char* p = beg, *p_end = beg+len; p != p_end; ++p )
+			h = ( h ^ (unsigned char)*p ) * 16777619u;
+		return h;
+	}
+		/// @return length of the namespace part of a NAME; 0 if the name should not be split
+	size_t getPrefixLength ( const std::string& name ) const;
+		/// @return index of the prefix [BEG,BEG+LEN); register it if necessary
+	unsigned int getPrefix ( const char* beg, size_t len );
+		/// @return true iff the record R represents NAME with hash value H
+	bool matches ( const NameRec& r, const std::string& name, unsigned int h ) const;
+		/// @return the slot where NAME with hash value H is or would be put
+	size_t findSlot ( const std::string& name, unsigned int h ) const;
+		/// copy string [BEG,BEG+LEN) to the arena; @return the copy
+	const char* store ( const char* beg, size_t len );
+		/// rebuild the hash table with the size SIZE
+	void rehash ( size_t size );
+
+private:	// no copy
+		/// no copy c'tor
+	TNameIndex ( const TNameIndex& );
+		/// no assignment
+	TNameIndex& operator = ( const TNameIndex& );
+
+public:		// interface
+		/// empty c'tor
+	TNameIndex ( void );
+		/// d'tor: free the arena
+	~TNameIndex ( void );
+
+		/// set the prefix compression to VAL; this can be done only for the empty index
+	void setPrefixCompression ( bool val ) { if ( Names.empty() ) compressPrefixes = val; }
+		/// @return true iff the prefix compression is on
+	bool isPrefixCompression ( void ) const { return compressPrefixes; }
+
+		/// @return ID of a NAME or noName if there is no such name
+	unsigned int find ( const std::string& name ) const;
+		/// add a NAME to the index if necessary; @return its ID
+	unsigned int insert ( const std::string& name );
+		/// remove a NAME from the index; its ID is not reused. @return true iff the name was there
+	bool erase ( const std::string& name );
+		/// remove all the names and free the arena
+	void clear ( void );
+
+		/// @return name with a given ID
+	std::string getName ( unsigned int id ) const;
+		/// @return the characters of the name with a given ID; valid until the index is cleared.
+		/// Only the names of the index without the prefix compression are kept in one piece
+	const char* getCName ( unsigned int id ) const { return compressPrefixes ? NULL : Names[id].Suffix; }
+		/// @return true iff ID corresponds to a name in the index
+	bool isValid ( unsigned int id ) const { return id < Names.size() && Names[id].Suffix != NULL; }
+		/// @return number of the names in the index
+	unsigned int size ( void ) const { return nNames; }
+		/// @return the number of the IDs given so far (all IDs are less than that)
+	unsigned int maxId ( void ) const { return Names.size(); }
+		/// @return number of the different prefixes
+	unsigned int getPrefixNumber ( void ) const { return Prefixes.size(); }
+		/// @return number of the bytes used by the index
+	size_t getMemoryUsage ( void ) const;
+}; // TNameIndex
+
+#endif
@@ -20,7 +20,10 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define TNAMESET_H
 
 #include <string>
-#include <map>
+#include <vector>
+
+#include "tNameIndex.h"
+#include "tEntryName.h"
 
 /// base class for creating Named Entries; template parameter should be derived from TNamedEntry
 template<class T>
@@ -32,28 +35,31 @@ public:		// interface
 		/// empty d'tor
 	virtual ~TNameCreator ( void ) {}
 
-		/// create new Named Entry
-	virtual T* makeEntry ( const std::string& name ) const { return new T(name); }
+		/// create new Named Entry with a NAME kept by the name set
+	virtual T* makeEntry ( const TNameRef& name ) const { return new T(name); }
 }; // TNameCreator
 
 
-/// Implementation of NameSets by binary trees; template parameter should be derived from TNamedEntry
+/// Implementation of NameSets by an interned hash index; template parameter should be derived from TNamedEntry.
+/// Every name gets a dense ID that does not change while the name is in the set.
+/// The entries share their names with the index, so the names are not compressed.
 template<class T>
 class TNameSet
 {
 protected:	// types
-		/// base type
-	typedef std::map <std::string, T*> NameTree;
-		/// RO iterator
-	typedef typename NameTree::const_iterator const_iterator;
+		/// entries by the IDs of their names
+	typedef std::vector<T*> EntryVector;
 
 public:		// types
-		/// RW iterator
-	typedef typename NameTree::iterator iterator;
+		/// RW iterator over the entries in the order of their IDs, i.e., in the order the names were added
+		/// (the names are not sorted); entries of removed names are NULL
+	typedef typename EntryVector::iterator iterator;
 
 protected:	// members
-		/// Base holding all names
-	NameTree Base;
+		/// index of all the names
+	TNameIndex Index;
+		/// entries by the name IDs
+	EntryVector Entries;
 		/// creator of new name
 	TNameCreator<T>* Creator;
 
@@ -74,14 +80,17 @@ public:		// interface
 		/// return pointer to existing id or NULL if no such id defined
 	T* get ( const std::string& id ) const
 	{
-		const_iterator p = Base.find(id);
-		return p == Base.end() ? NULL : p->second;
+		unsigned int n = Index.find(id);
+		return n == TNameIndex::noName ? NULL : Entries[n];
 	}
 		/// unconditionally add new element with name ID to the set; return new element
 	T* add ( const std::string& id )
 	{
-		T* pne = Creator->makeEntry(id);
-		Base[id] = pne;
+		unsigned int n = Index.insert(id);
+		T* pne = Creator->makeEntry(TNameRef::interned(Index.getCName(n)));
+		if ( n >= Entries.size() )
+			Entries.resize(n+1,NULL);
+		Entries[n] = pne;
 		return pne;
 	}
 		/// Insert id to a nameset (if necessary); @return pointer to id structure created by external creator
@@ -95,28 +104,38 @@ public:		// interface
 		/// remove given entry from the set
 	void remove ( const std::string& id )
 	{
-		iterator p = Base.find(id);
+		unsigned int n = Index.find(id);
 
-		if ( p != Base.end () )	// founs such Id
+		if ( n != TNameIndex::noName )	// found such Id
 		{
-			delete p->second;
-			Base.erase(p);
+			delete Entries[n];
+			Entries[n] = NULL;
+			Index.erase(id);
 		}
 	}
 		/// clear name set
 	void clear ( void )
 	{
-		for ( iterator p = Base.begin(); p != Base.end(); ++p )
-			delete p->second;
+		for ( iterator p = Entries.begin(); p != Entries.end(); ++p )
+			delete *p;
 
-		Base.clear();
+		Entries.clear();
+		Index.clear();
 	}
 		/// get size of a name set
-	unsigned int size ( void ) const { return Base.size(); }
+	unsigned int size ( void ) const { return Index.size(); }
+		/// @return dense ID of a name ID or TNameIndex::noName if there is no such name
+	unsigned int getId ( const std::string& id ) const { return Index.find(id); }
+		/// @return entry with a dense ID N or NULL if there is no such entry
+	T* getById ( unsigned int n ) const { return n < Entries.size() ? Entries[n] : NULL; }
+		/// get access to the underlying name index
+	const TNameIndex& getIndex ( void ) const { return Index; }
+		/// @return number of the bytes used by the index of the set, including the names of the entries (but not the entries themselves)
+	size_t getMemoryUsage ( void ) const { return Index.getMemoryUsage() + Entries.capacity()*sizeof(T*); }
 		/// RW begin iterator
-	iterator begin ( void ) { return Base.begin(); }
+	iterator begin ( void ) { return Entries.begin(); }
 		/// RW end iterator
-	iterator end ( void ) { return Base.end(); }
+	iterator end ( void ) { return Entries.end(); }
 }; // TNameSet
 
 #endif
@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #include <iostream>
 
 #include "flags.h"
+#include "tEntryName.h"
 
 //#include "SmallObj.h"
 
@@ -39,7 +40,7 @@ private:	// no copy
 
 protected:	// members
 		/// name of the entry
-	std::string extName;
+	TEntryName extName;
 		/// entry identifier
 	int extId;
 		/// original entity
@@ -47,8 +48,8 @@ protected:	// members
 
 public:		// interface
 		/// the only c'tor
-	explicit TNamedEntry ( const std::string& name )
-		: extName (name)		// copy name
+	explicit TNamedEntry ( const TNameRef& name )
+		: extName (name)		// copy a non-interned name
 		, extId (0)				// sets local id
 		, entity(NULL)
 		{}
@@ -0,0 +1,783 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <cstdlib>
+
+#include "tOWLFunctionalParser.h"
+#include "eFPPSyntaxError.h"
+
+// well-known IRIs
+#define OWL_NS "http://www.w3.org/2002/07/owl#"
+#define RDF_NS "http://www.w3.org/1999/02/22-rdf-syntax-ns#"
+#define RDFS_NS "http://www.w3.org/2000/01/rdf-schema#"
+#define XSD_NS "http://www.w3.org/2001/XMLSchema#"
+
+TOWLFunctionalParser :: TOWLFunctionalParser ( ReasoningKernel& kernel, std::istream& in )
+	: Kernel(kernel)
+	, EM(kernel.getExpressionManager())
+	, In(in.rdbuf())
+	, Current(tokEOF)
+	, Line(1)
+	, Depth(0)
+	, nAxioms(0)
+	, nSkipped(0)
+{
+	// standard prefixes
+	Prefixes["owl:"] = OWL_NS;
+	Prefixes["rdf:"] = RDF_NS;
+	Prefixes["rdfs:"] = RDFS_NS;
+	Prefixes["xsd:"] = XSD_NS;
+}
+
+//-------------------------------------------------------------
+// lexer
+//-------------------------------------------------------------
+
+bool
+TOWLFunctionalParser :: isNameChar ( int c )
+{
+	switch ( c )
+	{
+	case '(':
+	case ')':
+	case '<':
+	case '>':
+	case '"':
+	case '=':
+	case '^':
+	case '@':
+	case ' ':
+	case '\t':
+	case '\r':
+	case '\n':
+	case EOF:
+		return false;
+	default:
+		return true;
+	}
+}
+
+void
+TOWLFunctionalParser :: NextLex ( void )
+{
+	Text.clear();
+	int c;
+
+	// skip spaces and comments
+	for (;;)
+	{
+		c = In->sbumpc();
+		if ( c == '\n' )
+			++Line;
+		else if ( c == '#' )
+		{
+			while ( ( c = In->sbumpc() ) != '\n' && c != EOF )
+				(void)NULL;
+			++Line;
+		}
+		else if ( c != ' ' && c != '\t' && c != '\r' )
+			break;
+	}
+
+	switch ( c )
+	{
+	case EOF:
+		Current = tokEOF;
+		return;
+	case '(':
+		++Depth;
+		Current = tokLBr;
+		return;
+	case ')':
+		--Depth;
+		Current = tokRBr;
+		return;
+	case '=':
+		Current = tokEq;
+		return;
+	case '<':	// full IRI
+		while ( ( c = In->sbumpc() ) != '>' )
+		{
+			if ( c == EOF || c == '\n' )
+				error("unterminated IRI");
+			Text += (char)c;
+		}
+		Current = tokIRI;
+		return;
+	case '"':	// quoted string
+		while ( ( c = In->sbumpc() ) != '"' )
+		{
+			if ( c == EOF )
+				error("unterminated string");
+			if ( c == '\n' )
+				++Line;
+			if ( c == '\\' )
+				c = In->sbumpc();
+			Text += (char)c;
+		}
+		Current = tokString;
+		return;
+	case '^':
+		if ( In->sbumpc() != '^' )
+			error("'^^' expected");
+		Current = tokDType;
+		return;
+	case '@':	// language tag
+		while ( isNameChar(In->sgetc()) )
+			Text += (char)In->sbumpc();
+		Current = tokLang;
+		return;
+	default:	// keyword, number or abbreviated IRI
+		Text += (char)c;
+		while ( isNameChar(In->sgetc()) )
+			Text += (char)In->sbumpc();
+		Current = tokName;
+		return;
+	}
+}
+
+void
+TOWLFunctionalParser :: error ( const std::string& msg ) const
+{
+	throw EFPPSyntaxError ( msg, Line );
+}
+
+void
+TOWLFunctionalParser :: MustBeM ( Token t, const char* what )
+{
+	if ( Current != t )
+		error ( std::string(what) + " expected" );
+	NextLex();
+}
+
+void
+TOWLFunctionalParser :: skipElement ( void )
+{
+	// constructor name or a bare bracketed list (as in HasKey)
+	if ( Current != tokLBr )
+	{
+		bool complex = ( Current == tokName && !isIRI() );
+		NextLex();
+		if ( !complex || Current != tokLBr )
+			return;
+	}
+
+	// skip balanced brackets
+	unsigned int level = 0;
+	do
+	{
+		if ( Current == tokLBr )
+			++level;
+		else if ( Current == tokRBr )
+			--level;
+		else if ( Current == tokEOF )
+			error("unexpected end of input");
+		NextLex();
+	} while ( level > 0 );
+}
+
+void
+TOWLFunctionalParser :: skipAnnotations ( void )
+{
+	while ( isKeyword("Annotation") )
+		skipElement();
+}
+
+//-------------------------------------------------------------
+// entities and expressions
+//-------------------------------------------------------------
+
+std::string
+TOWLFunctionalParser :: getIRI ( void )
+{
+	if ( !isIRI() )
+		error("IRI expected");
+
+	std::string ret;
+	if ( Current == tokIRI )
+		ret = Text;
+	else if ( Text.compare ( 0, 2, "_:" ) == 0 )	// anonymous individual: keep the node ID
+		ret = Text;
+	else
+	{	// abbreviated IRI
+		std::string::size_type colon = Text.find(':');
+		PrefixMap::const_iterator p = Prefixes.find(Text.substr(0,colon+1));
+		if ( p == Prefixes.end() )
+			error ( "unknown prefix in '" + Text + "'" );
+		ret = p->second + Text.substr(colon+1);
+	}
+	NextLex();
+	return ret;
+}
+
+unsigned int
+TOWLFunctionalParser :: getNumber ( void )
+{
+	if ( Current != tokName || Text.find_first_not_of("0123456789") != std::string::npos )
+		error("non-negative integer expected");
+	unsigned int ret = atoi(Text.c_str());
+	NextLex();
+	return ret;
+}
+
+TOWLFunctionalParser::TConceptExpr*
+TOWLFunctionalParser :: getConceptExpression ( void )
+{
+	if ( isIRI() )
+	{
+		std::string iri = getIRI();
+		if ( iri == OWL_NS "Thing" )
+			return EM->Top();
+		if ( iri == OWL_NS "Nothing" )
+			return EM->Bottom();
+		return EM->Concept(iri);
+	}
+
+	if ( Current != tokName )
+		error("class expression expected");
+
+	std::string word = Text;
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+	TConceptExpr* ret = getComplexConceptExpression(word);
+	MustBeM ( tokRBr, "')'" );
+	return ret;
+}
+
+TOWLFunctionalParser::TConceptExpr*
+TOWLFunctionalParser :: getComplexConceptExpression ( const std::string& word )
+{
+	if ( word == "ObjectIntersectionOf" )
+	{
+		parseConceptList();
+		return EM->And();
+	}
+	if ( word == "ObjectUnionOf" )
+	{
+		parseConceptList();
+		return EM->Or();
+	}
+	if ( word == "ObjectComplementOf" )
+		return EM->Not(getConceptExpression());
+	if ( word == "ObjectOneOf" )
+	{
+		parseIndividualList();
+		return EM->OneOf();
+	}
+	if ( word == "ObjectSomeValuesFrom" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		return EM->Exists ( R, getConceptExpression() );
+	}
+	if ( word == "ObjectAllValuesFrom" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		return EM->Forall ( R, getConceptExpression() );
+	}
+	if ( word == "ObjectHasValue" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		return EM->Value ( R, getIndividual() );
+	}
+	if ( word == "ObjectHasSelf" )
+		return EM->SelfReference(getORoleExpression());
+	if ( word == "ObjectMinCardinality" || word == "ObjectMaxCardinality" || word == "ObjectExactCardinality" )
+	{
+		unsigned int n = getNumber();
+		TORoleExpr* R = getORoleExpression();
+		TConceptExpr* C = Current == tokRBr ? EM->Top() : getConceptExpression();
+		if ( word == "ObjectMinCardinality" )
+			return EM->MinCardinality ( n, R, C );
+		if ( word == "ObjectMaxCardinality" )
+			return EM->MaxCardinality ( n, R, C );
+		return EM->Cardinality ( n, R, C );
+	}
+	if ( word == "DataSomeValuesFrom" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		return EM->Exists ( A, getDataExpression() );
+	}
+	if ( word == "DataAllValuesFrom" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		return EM->Forall ( A, getDataExpression() );
+	}
+	if ( word == "DataHasValue" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		return EM->Value ( A, getLiteral() );
+	}
+	if ( word == "DataMinCardinality" || word == "DataMaxCardinality" || word == "DataExactCardinality" )
+	{
+		unsigned int n = getNumber();
+		TDRoleExpr* A = getDRoleExpression();
+		TDataExpr* E = Current == tokRBr ? EM->DataTop() : getDataExpression();
+		if ( word == "DataMinCardinality" )
+			return EM->MinCardinality ( n, A, E );
+		if ( word == "DataMaxCardinality" )
+			return EM->MaxCardinality ( n, A, E );
+		return EM->Cardinality ( n, A, E );
+	}
+
+	error ( "unsupported class expression '" + word + "'" );
+	return NULL;	// unreachable
+}
+
+TOWLFunctionalParser::TIndividualExpr*
+TOWLFunctionalParser :: getIndividual ( void )
+{
+	return EM->Individual(getIRI());
+}
+
+TOWLFunctionalParser::TORoleExpr*
+TOWLFunctionalParser :: getORoleExpression ( void )
+{
+	if ( isKeyword("ObjectInverseOf") )
+	{
+		NextLex();
+		MustBeM ( tokLBr, "'('" );
+		TORoleExpr* R = getORoleExpression();
+		MustBeM ( tokRBr, "')'" );
+		return EM->Inverse(R);
+	}
+
+	std::string iri = getIRI();
+	if ( iri == OWL_NS "topObjectProperty" )
+		return EM->ObjectRoleTop();
+	if ( iri == OWL_NS "bottomObjectProperty" )
+		return EM->ObjectRoleBottom();
+	return EM->ObjectRole(iri);
+}
+
+TOWLFunctionalParser::TORoleComplexExpr*
+TOWLFunctionalParser :: getORoleComplexExpression ( void )
+{
+	if ( !isKeyword("ObjectPropertyChain") )
+		return getORoleExpression();
+
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+	parseORoleList();
+	MustBeM ( tokRBr, "')'" );
+	return EM->Compose();
+}
+
+TOWLFunctionalParser::TDRoleExpr*
+TOWLFunctionalParser :: getDRoleExpression ( void )
+{
+	std::string iri = getIRI();
+	if ( iri == OWL_NS "topDataProperty" )
+		return EM->DataRoleTop();
+	if ( iri == OWL_NS "bottomDataProperty" )
+		return EM->DataRoleBottom();
+	return EM->DataRole(iri);
+}
+
+TOWLFunctionalParser::TDataExpr*
+TOWLFunctionalParser :: getDataType ( const std::string& iri )
+{
+	TDataExpr* ret = EM->getBuiltInDataType(iri);
+	if ( ret == NULL )
+		throw EUnsupportedDataType(iri);
+	return ret;
+}
+
+TOWLFunctionalParser::TDataExpr*
+TOWLFunctionalParser :: getDataExpression ( void )
+{
+	if ( isIRI() )
+		return getDataType(getIRI());
+
+	if ( Current != tokName )
+		error("data range expected");
+
+	std::string word = Text;
+	TDataExpr* ret = NULL;
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+
+	if ( word == "DataIntersectionOf" || word == "DataUnionOf" )
+	{
+		EM->newArgList();
+		while ( Current != tokRBr )
+			EM->addArg(getDataExpression());
+		ret = word == "DataIntersectionOf" ? EM->DataAnd() : EM->DataOr();
+	}
+	else if ( word == "DataComplementOf" )
+		ret = EM->DataNot(getDataExpression());
+	else if ( word == "DataOneOf" )
+	{
+		EM->newArgList();
+		while ( Current != tokRBr )
+			EM->addArg(getLiteral());
+		ret = EM->DataOneOf();
+	}
+	else if ( word == "DatatypeRestriction" )
+	{
+		TDataTypeExpr* type = dynamic_cast<TDataTypeExpr*>(const_cast<TDLDataExpression*>(getDataType(getIRI())));
+		if ( type == NULL )
+			error("restriction of the top datatype");
+		while ( Current != tokRBr )
+		{
+			std::string facet = getIRI();
+			TDataValueExpr* value = getLiteral();
+			if ( facet == XSD_NS "minInclusive" )
+				type = EM->RestrictedType ( type, EM->FacetMinInclusive(value) );
+			else if ( facet == XSD_NS "minExclusive" )
+				type = EM->RestrictedType ( type, EM->FacetMinExclusive(value) );
+			else if ( facet == XSD_NS "maxInclusive" )
+				type = EM->RestrictedType ( type, EM->FacetMaxInclusive(value) );
+			else if ( facet == XSD_NS "maxExclusive" )
+				type = EM->RestrictedType ( type, EM->FacetMaxExclusive(value) );
+			else
+				error ( "unsupported facet '" + facet + "'" );
+		}
+		ret = type;
+	}
+	else
+		error ( "unsupported data range '" + word + "'" );
+
+	MustBeM ( tokRBr, "')'" );
+	return ret;
+}
+
+TOWLFunctionalParser::TDataValueExpr*
+TOWLFunctionalParser :: getLiteral ( void )
+{
+	if ( Current != tokString )
+		error("literal expected");
+	std::string value = Text;
+	NextLex();
+
+	TDataTypeExpr* type = EM->getStrDataType();
+	if ( Current == tokDType )
+	{
+		NextLex();
+		TDataExpr* dt = getDataType(getIRI());
+		if ( dt != EM->DataTop() )
+			type = dynamic_cast<TDataTypeExpr*>(const_cast<TDLDataExpression*>(dt));
+	}
+	else if ( Current == tokLang )
+		NextLex();
+
+	return EM->DataValue ( value, type );
+}
+
+void
+TOWLFunctionalParser :: parseConceptList ( void )
+{
+	EM->newArgList();
+	while ( Current != tokRBr )
+		EM->addArg(getConceptExpression());
+}
+
+void
+TOWLFunctionalParser :: parseIndividualList ( void )
+{
+	EM->newArgList();
+	while ( Current != tokRBr )
+		EM->addArg(getIndividual());
+}
+
+void
+TOWLFunctionalParser :: parseORoleList ( void )
+{
+	EM->newArgList();
+	while ( Current != tokRBr )
+		EM->addArg(getORoleExpression());
+}
+
+void
+TOWLFunctionalParser :: parseDRoleList ( void )
+{
+	EM->newArgList();
+	while ( Current != tokRBr )
+		EM->addArg(getDRoleExpression());
+}
+
+//-------------------------------------------------------------
+// axioms
+//-------------------------------------------------------------
+
+void
+TOWLFunctionalParser :: parseDeclaration ( void )
+{
+	std::string word = Text;
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+
+	if ( word == "Class" )
+		Kernel.declare(getConceptExpression());
+	else if ( word == "ObjectProperty" )
+		Kernel.declare(getORoleExpression());
+	else if ( word == "DataProperty" )
+		Kernel.declare(getDRoleExpression());
+	else if ( word == "NamedIndividual" )
+		Kernel.declare(getIndividual());
+	else if ( word == "Datatype" || word == "AnnotationProperty" )
+	{	// nothing to declare
+		getIRI();
+		--nAxioms;
+	}
+	else
+		error ( "unknown entity type '" + word + "'" );
+
+	MustBeM ( tokRBr, "')'" );
+}
+
+void
+TOWLFunctionalParser :: parseAxiom ( void )
+{
+	if ( Current != tokName || isIRI() )
+		error("axiom expected");
+
+	std::string word = Text;
+	// the axiom ends with the bracket that closes the current level
+	unsigned int level = Depth;
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+	skipAnnotations();
+	++nAxioms;
+
+	try
+	{
+		parseAxiomBody(word);
+	}
+	catch ( const EUnsupportedDataType& dt )
+	{	// the axiom can't be told: skip the rest of it
+		--nAxioms;
+		++nSkipped;
+		UnsupportedDataTypes.insert(dt.getIRI());
+		EM->clearArgLists();
+		while ( Current != tokRBr || Depth != level )
+		{
+			if ( Current == tokEOF )
+				error("unexpected end of input");
+			NextLex();
+		}
+	}
+
+	MustBeM ( tokRBr, "')'" );
+}
+
+void
+TOWLFunctionalParser :: parseAxiomBody ( const std::string& word )
+{
+	if ( word == "Declaration" )
+		parseDeclaration();
+	// class axioms
+	else if ( word == "SubClassOf" )
+	{
+		TConceptExpr* C = getConceptExpression();
+		Kernel.impliesConcepts ( C, getConceptExpression() );
+	}
+	else if ( word == "EquivalentClasses" )
+	{
+		parseConceptList();
+		Kernel.equalConcepts();
+	}
+	else if ( word == "DisjointClasses" )
+	{
+		parseConceptList();
+		Kernel.disjointConcepts();
+	}
+	else if ( word == "DisjointUnion" )
+	{
+		TConceptExpr* C = getConceptExpression();
+		parseConceptList();
+		Kernel.disjointUnion(C);
+	}
+	// object property axioms
+	else if ( word == "SubObjectPropertyOf" )
+	{
+		TORoleComplexExpr* R = getORoleComplexExpression();
+		Kernel.impliesORoles ( R, getORoleExpression() );
+	}
+	else if ( word == "EquivalentObjectProperties" )
+	{
+		parseORoleList();
+		Kernel.equalORoles();
+	}
+	else if ( word == "DisjointObjectProperties" )
+	{
+		parseORoleList();
+		Kernel.disjointORoles();
+	}
+	else if ( word == "InverseObjectProperties" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		Kernel.setInverseRoles ( R, getORoleExpression() );
+	}
+	else if ( word == "ObjectPropertyDomain" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		Kernel.setODomain ( R, getConceptExpression() );
+	}
+	else if ( word == "ObjectPropertyRange" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		Kernel.setORange ( R, getConceptExpression() );
+	}
+	else if ( word == "FunctionalObjectProperty" )
+		Kernel.setOFunctional(getORoleExpression());
+	else if ( word == "InverseFunctionalObjectProperty" )
+		Kernel.setInverseFunctional(getORoleExpression());
+	else if ( word == "ReflexiveObjectProperty" )
+		Kernel.setReflexive(getORoleExpression());
+	else if ( word == "IrreflexiveObjectProperty" )
+		Kernel.setIrreflexive(getORoleExpression());
+	else if ( word == "SymmetricObjectProperty" )
+		Kernel.setSymmetric(getORoleExpression());
+	else if ( word == "AsymmetricObjectProperty" )
+		Kernel.setAsymmetric(getORoleExpression());
+	else if ( word == "TransitiveObjectProperty" )
+		Kernel.setTransitive(getORoleExpression());
+	// data property axioms
+	else if ( word == "SubDataPropertyOf" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		Kernel.impliesDRoles ( A, getDRoleExpression() );
+	}
+	else if ( word == "EquivalentDataProperties" )
+	{
+		parseDRoleList();
+		Kernel.equalDRoles();
+	}
+	else if ( word == "DisjointDataProperties" )
+	{
+		parseDRoleList();
+		Kernel.disjointDRoles();
+	}
+	else if ( word == "DataPropertyDomain" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		Kernel.setDDomain ( A, getConceptExpression() );
+	}
+	else if ( word == "DataPropertyRange" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		Kernel.setDRange ( A, getDataExpression() );
+	}
+	else if ( word == "FunctionalDataProperty" )
+		Kernel.setDFunctional(getDRoleExpression());
+	// assertions
+	else if ( word == "SameIndividual" )
+	{
+		parseIndividualList();
+		Kernel.processSame();
+	}
+	else if ( word == "DifferentIndividuals" )
+	{
+		parseIndividualList();
+		Kernel.processDifferent();
+	}
+	else if ( word == "ClassAssertion" )
+	{
+		TConceptExpr* C = getConceptExpression();
+		Kernel.instanceOf ( getIndividual(), C );
+	}
+	else if ( word == "ObjectPropertyAssertion" || word == "NegativeObjectPropertyAssertion" )
+	{
+		TORoleExpr* R = getORoleExpression();
+		TIndividualExpr* I = getIndividual();
+		TIndividualExpr* J = getIndividual();
+		if ( word == "ObjectPropertyAssertion" )
+			Kernel.relatedTo ( I, R, J );
+		else
+			Kernel.relatedToNot ( I, R, J );
+	}
+	else if ( word == "DataPropertyAssertion" || word == "NegativeDataPropertyAssertion" )
+	{
+		TDRoleExpr* A = getDRoleExpression();
+		TIndividualExpr* I = getIndividual();
+		TDataValueExpr* V = getLiteral();
+		if ( word == "DataPropertyAssertion" )
+			Kernel.valueOf ( I, A, V );
+		else
+			Kernel.valueOfNot ( I, A, V );
+	}
+	else
+	{	// annotation axioms, keys, datatype definitions, rules: not used in reasoning
+		--nAxioms;
+		++nSkipped;
+		while ( Current != tokRBr )
+		{
+			if ( Current == tokEOF )
+				error("unexpected end of input");
+			skipElement();
+		}
+	}
+
+}
+
+void
+TOWLFunctionalParser :: parseOntology ( void )
+{
+	// ontology and version IRIs
+	if ( isIRI() )
+		getIRI();
+	if ( isIRI() )
+		getIRI();
+
+	while ( Current != tokRBr )
+	{
+		if ( isKeyword("Import") )
+		{	// imports are not followed
+			++nSkipped;
+			skipElement();
+		}
+		else if ( isKeyword("Annotation") )
+			skipElement();
+		else
+			parseAxiom();
+	}
+}
+
+size_t
+TOWLFunctionalParser :: Parse ( void )
+{
+	NextLex();
+
+	// prefix declarations
+	while ( isKeyword("Prefix") )
+	{
+		NextLex();
+		MustBeM ( tokLBr, "'('" );
+		if ( Current != tokName || Text[Text.size()-1] != ':' )
+			error("prefix name expected");
+		std::string name = Text;
+		NextLex();
+		MustBeM ( tokEq, "'='" );
+		if ( Current != tokIRI )
+			error("full IRI expected");
+		Prefixes[name] = Text;
+		NextLex();
+		MustBeM ( tokRBr, "')'" );
+	}
+
+	if ( !isKeyword("Ontology") )
+		error("'Ontology' expected");
+	NextLex();
+	MustBeM ( tokLBr, "'('" );
+	parseOntology();
+	MustBeM ( tokRBr, "')'" );
+
+	if ( Current != tokEOF )
+		error("end of input expected");
+	return nAxioms;
+}
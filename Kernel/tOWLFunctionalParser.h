@@ -0,0 +1,187 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TOWLFUNCTIONALPARSER_H
+#define TOWLFUNCTIONALPARSER_H
+
+#include <string>
+#include <map>
+#include <set>
+#include <iostream>
+
+#include "Kernel.h"
+
+/// reader of the ontologies in the OWL 2 functional-style syntax. Axioms are told
+/// to the kernel in the order of the input; entity names are full IRIs.
+/// The input is parsed sequentially: the kernel and its expression manager are not thread-safe,
+/// so parsing in parallel would need a separate expression store per thread and a merge step.
+/// Axioms using datatypes unknown to the reasoner are skipped.
+class TOWLFunctionalParser
+{
+protected:	// types
+		/// lexical tokens
+	enum Token { tokEOF, tokLBr, tokRBr, tokEq, tokIRI, tokName, tokString, tokDType, tokLang };
+		/// prefix name -> IRI map
+	typedef std::map<std::string, std::string> PrefixMap;
+		/// exception thrown on a datatype unknown to the reasoner; the current axiom is skipped
+	class EUnsupportedDataType
+	{
+	protected:	// members
+			/// IRI of the datatype
+		std::string IRI;
+	public:		// interface
+			/// init c'tor
+		EUnsupportedDataType ( const std::string& iri ) : IRI(iri) {}
+			/// @return IRI of the datatype
+		const std::string& getIRI ( void ) const { return IRI; }
+	}; // EUnsupportedDataType
+
+public:		// types
+		/// set of IRIs
+	typedef std::set<std::string> IRISet;
+
+protected:	// types
+
+		/// concept expression
+	typedef ReasoningKernel::TConceptExpr TConceptExpr;
+		/// individual expression
+	typedef ReasoningKernel::TIndividualExpr TIndividualExpr;
+		/// object role complex expression (including role chains)
+	typedef ReasoningKernel::TORoleComplexExpr TORoleComplexExpr;
+		/// object role expression
+	typedef ReasoningKernel::TORoleExpr TORoleExpr;
+		/// data role expression
+	typedef ReasoningKernel::TDRoleExpr TDRoleExpr;
+		/// data expression
+	typedef ReasoningKernel::TDataExpr TDataExpr;
+		/// data type expression
+	typedef ReasoningKernel::TDataTypeExpr TDataTypeExpr;
+		/// data value expression
+	typedef ReasoningKernel::TDataValueExpr TDataValueExpr;
+
+protected:	// members
+		/// kernel to be filled
+	ReasoningKernel& Kernel;
+		/// expression manager of the kernel
+	TExpressionManager* EM;
+		/// input buffer
+	std::streambuf* In;
+		/// known prefixes
+	PrefixMap Prefixes;
+		/// current token
+	Token Current;
+		/// text of the current token
+	std::string Text;
+		/// current input line (for error diagnosis)
+	unsigned int Line;
+		/// number of the brackets open at the current token
+	unsigned int Depth;
+		/// number of axioms told to the kernel
+	size_t nAxioms;
+		/// number of axioms and imports that were skipped
+	size_t nSkipped;
+		/// unknown datatypes that made the axioms skipped
+	IRISet UnsupportedDataTypes;
+
+private:	// no copy
+		/// no copy c'tor
+	TOWLFunctionalParser ( const TOWLFunctionalParser& );
+		/// no assignment
+	TOWLFunctionalParser& operator = ( const TOWLFunctionalParser& );
+
+protected:	// methods
+
+	// lexer
+
+		/// @return true iff C can be a part of a name
+	static bool isNameChar ( int c );
+		/// read the next token
+	void NextLex ( void );
+		/// @throw a syntax error with a message MSG
+	void error ( const std::string& msg ) const;
+		/// ensure that the current token is T; get the next one
+	void MustBeM ( Token t, const char* what );
+		/// @return true iff the current token is a keyword WORD
+	bool isKeyword ( const char* word ) const { return Current == tokName && Text == word; }
+		/// @return true iff the current token is an entity IRI (full or abbreviated)
+	bool isIRI ( void ) const { return Current == tokIRI || ( Current == tokName && Text.find(':') != std::string::npos ); }
+		/// skip the current (possibly complex) element
+	void skipElement ( void );
+		/// skip all the annotations at the current position
+	void skipAnnotations ( void );
+
+	// entities and expressions
+
+		/// @return full IRI of the current entity; get the next token
+	std::string getIRI ( void );
+		/// @return non-negative integer; get the next token
+	unsigned int getNumber ( void );
+		/// @return concept expression
+	TConceptExpr* getConceptExpression ( void );
+		/// @return complex concept expression with a constructor WORD
+	TConceptExpr* getComplexConceptExpression ( const std::string& word );
+		/// @return individual
+	TIndividualExpr* getIndividual ( void );
+		/// @return object role expression
+	TORoleExpr* getORoleExpression ( void );
+		/// @return object role expression or a role chain
+	TORoleComplexExpr* getORoleComplexExpression ( void );
+		/// @return data role expression
+	TDRoleExpr* getDRoleExpression ( void );
+		/// @return data type by its IRI; data top for the top datatypes; @throw EUnsupportedDataType for an unknown one
+	TDataExpr* getDataType ( const std::string& iri );
+		/// @return data range
+	TDataExpr* getDataExpression ( void );
+		/// @return literal
+	TDataValueExpr* getLiteral ( void );
+
+		/// parse list of concept expressions into a new argument list
+	void parseConceptList ( void );
+		/// parse list of individuals into a new argument list
+	void parseIndividualList ( void );
+		/// parse list of object role expressions into a new argument list
+	void parseORoleList ( void );
+		/// parse list of data role expressions into a new argument list
+	void parseDRoleList ( void );
+
+		/// parse a declaration
+	void parseDeclaration ( void );
+		/// parse a single axiom (or skip it if it is not supported)
+	void parseAxiom ( void );
+		/// parse the arguments of an axiom with a constructor WORD and tell it to the kernel
+	void parseAxiomBody ( const std::string& word );
+		/// parse the body of the ontology
+	void parseOntology ( void );
+
+public:		// interface
+		/// init c'tor: read from IN to KERNEL
+	TOWLFunctionalParser ( ReasoningKernel& kernel, std::istream& in );
+		/// empty d'tor
+	~TOWLFunctionalParser ( void ) {}
+
+		/// parse the whole input; @return the number of axioms told
+	size_t Parse ( void );
+		/// @return the number of axioms told
+	size_t getAxiomNumber ( void ) const { return nAxioms; }
+		/// @return the number of unsupported axioms and imports that were skipped
+	size_t getSkippedNumber ( void ) const { return nSkipped; }
+		/// @return the unknown datatypes that made the axioms skipped
+	const IRISet& getUnsupportedDataTypes ( void ) const { return UnsupportedDataTypes; }
+}; // TOWLFunctionalParser
+
+#endif
@@ -20,6 +20,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #define TONTOLOGY_H
 
 #include <vector>
+#include <algorithm>
 #include "tDLAxiom.h"
 #include "tExpressionManager.h"
 #include "tSplitVars.h"
@@ -42,6 +43,8 @@ protected:	// members
 	unsigned int axiomId;
 		/// index of the 1st unprocessed axiom
 	size_t axiomToProcess;
+		/// version of the axiom set; changes with every addition or retraction of axioms
+	unsigned long Version;
 		/// true iff ontology was changed
 	bool changed;
 
@@ -50,12 +53,14 @@ public:
 
 public:		// interface
 		/// empty c'tor
-	TOntology ( void ) : axiomId(0), axiomToProcess(0), changed(false) {}
+	TOntology ( void ) : axiomId(0), axiomToProcess(0), Version(0), changed(false) {}
 		/// d'tor
 	~TOntology ( void ) { clear(); }
 
 		/// @return true iff the ontology was changed since its last load
 	bool isChanged ( void ) const { return changed; }
+		/// @return the version of the axiom set
+	unsigned long getVersion ( void ) const { return Version; }
 		/// set the processed marker to the end of the ontology
 	void setProcessed ( void ) { axiomToProcess = Axioms.size(); Retracted.clear(); changed = false; }
 
@@ -64,8 +69,23 @@ public:		// interface
 	{
 		p->setId(++axiomId);
 		Axioms.push_back(p);
+		++Version;
 		changed = true;
 		return p;
+	}
+		/// add an axiom owned by another ontology and keep its ID; remove it by safeClear() before the ontology is cleared
+	void addShared ( TDLAxiom* p )
+	{
+		Axioms.push_back(p);
+		++Version;
+		changed = true;
+	}
+		/// replace all the axioms by the AXIOMS owned by another ontology; remove them by safeClear() before the ontology is cleared
+	void setShared ( const AxiomVec& axioms )
+	{
+		Axioms = axioms;
+		++Version;
+		changed = true;
 	}
 		/// retract given axiom to the ontology
 	void retract ( TDLAxiom* p )
@@ -73,6 +93,7 @@ public:		// interface
 //		if ( p->getId() <= Axioms.size() && Axioms[p->getId()-1] == p )
 		{
 			changed = true;
+			++Version;
 			p->setUsed(false);
 			Retracted.push_back(p);
 		}
@@ -82,6 +103,14 @@ public:		// interface
 	{
 		for ( iterator p = Axioms.begin(), p_end = Axioms.end(); p < p_end; ++p )
 			(*p)->setInModule(false);
+	}
+		/// bring back the retracted axiom P
+	void unretract ( TDLAxiom* p )
+	{
+		changed = true;
+		++Version;
+		p->setUsed(true);
+		Retracted.erase ( std::remove ( Retracted.begin(), Retracted.end(), p ), Retracted.end() );
 	}
 		/// safe clear the ontology (do not remove axioms)
 	void safeClear ( void ) { Axioms.clear(); }
@@ -99,6 +128,7 @@ public:		// interface
 		Retracted.clear();
 		EManager.clear();
 		axiomToProcess = 0;
+		++Version;
 		changed = false;
 	}
 
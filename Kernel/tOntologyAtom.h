@@ -78,8 +78,13 @@ protected:	// methods
 public:		// interface
 		/// empty c'tor
 	TOntologyAtom ( void ) : Id(0) {}
-		/// d'tor
-	~TOntologyAtom ( void ) {}
+		/// d'tor: the atom's axioms do not belong to any atom anymore
+	~TOntologyAtom ( void )
+	{
+		for ( AxiomSet::iterator p = AtomAxioms.begin(), p_end = AtomAxioms.end(); p != p_end; ++p )
+			if ( (*p)->getAtom() == this )
+				(*p)->setAtom(NULL);
+	}
 
 	// fill in the sets
 
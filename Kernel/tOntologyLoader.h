@@ -394,6 +394,9 @@ public:		// interface
 		/// empty d'tor
 	virtual ~TOntologyLoader ( void ) {}
 
+		/// set whether the named entities should remember their KB entries
+	void setBindEntities ( bool value ) { ETrans.setBindEntities(value); }
+
 		/// load ontology to a given KB
 	virtual void visitOntology ( TOntology& ontology )
 	{
@@ -0,0 +1,197 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TQUERYRESULTCACHE_H
+#define TQUERYRESULTCACHE_H
+
+#include <list>
+#include <map>
+#include <iostream>
+
+#include "tDLExpression.h"
+#include "taxVertex.h"
+
+/// bounded LRU cache for the results of complex concept queries. Expressions are
+/// compared by pointers, which is exact as the expression manager interns them.
+class TQueryResultCache
+{
+public:		// types
+		/// concept expression
+	typedef const TDLConceptExpression TConceptExpr;
+		/// query key: (C,NULL) for queries about C; (C,D) for queries about a pair
+	typedef std::pair<TConceptExpr*, TConceptExpr*> KeyType;
+		/// answer of a boolean query
+	enum Answer { qaUnknown, qaFalse, qaTrue };
+
+protected:	// types
+		/// cached results for a single key
+	struct Entry
+	{
+			/// the key of an entry
+		KeyType Key;
+			/// satisfiability of C for (C,NULL); C [= D for (C,D)
+		Answer Value;
+			/// classified position of C, if known
+		TaxonomyVertex* Vertex;
+			/// whether the vertex is a copy owned by the cache
+		bool ownVertex;
+
+			/// init c'tor
+		Entry ( const KeyType& key ) : Key(key), Value(qaUnknown), Vertex(NULL), ownVertex(false) {}
+	}; // Entry
+		/// entries, most recently used first
+	typedef std::list<Entry> EntryList;
+		/// index of the entries
+	typedef std::map<KeyType, EntryList::iterator> IndexMap;
+
+protected:	// members
+		/// all the entries
+	EntryList Entries;
+		/// key -> entry map
+	IndexMap Index;
+		/// max number of entries; 0 means no caching
+	size_t maxSize;
+		/// number of queries answered from the cache
+	unsigned long nHits;
+		/// number of queries that were not found in the cache
+	unsigned long nMisses;
+
+private:	// no copy
+		/// no copy c'tor
+	TQueryResultCache ( const TQueryResultCache& );
+		/// no assignment
+	TQueryResultCache& operator = ( const TQueryResultCache& );
+
+protected:	// methods
+		/// release resources of an entry E
+	static void clearEntry ( Entry& e )
+	{
+		if ( e.ownVertex )
+			delete e.Vertex;
+		e.Vertex = NULL;
+		e.ownVertex = false;
+	}
+		/// remove least recently used entries until there are at most SIZE of them
+	void shrink ( size_t size )
+	{
+		while ( Entries.size() > size )
+		{
+			clearEntry(Entries.back());
+			Index.erase(Entries.back().Key);
+			Entries.pop_back();
+		}
+	}
+		/// @return an entry for KEY (marking it as recently used), or NULL if there is none
+	Entry* find ( const KeyType& key )
+	{
+		IndexMap::iterator p = Index.find(key);
+		if ( p == Index.end() )
+			return NULL;
+		Entries.splice ( Entries.begin(), Entries, p->second );
+		return &Entries.front();
+	}
+		/// @return an entry for KEY, creating it if necessary
+	Entry& get ( const KeyType& key )
+	{
+		if ( Entry* e = find(key) )
+			return *e;
+		shrink(maxSize-1);
+		Entries.push_front(Entry(key));
+		Index[key] = Entries.begin();
+		return Entries.front();
+	}
+		/// update the hit/miss statistics wrt FOUND; @return FOUND
+	bool count ( bool found )
+	{
+		if ( found )
+			++nHits;
+		else
+			++nMisses;
+		return found;
+	}
+
+public:		// interface
+		/// empty c'tor
+	TQueryResultCache ( void ) : maxSize(0), nHits(0), nMisses(0) {}
+		/// d'tor
+	~TQueryResultCache ( void ) { clear(); }
+
+		/// set the max number of cached queries to SIZE
+	void setMaxSize ( size_t size ) { maxSize = size; shrink(size); }
+		/// @return max number of cached queries
+	size_t getMaxSize ( void ) const { return maxSize; }
+		/// @return true iff the results are cached
+	bool isActive ( void ) const { return maxSize > 0; }
+		/// remove all the cached entries (e.g., when the KB is changed)
+	void clear ( void ) { shrink(0); }
+
+	// boolean answers
+
+		/// @return cached answer of the query about C (or about C and D)
+	Answer getAnswer ( TConceptExpr* C, TConceptExpr* D = NULL )
+	{
+		if ( !isActive() )
+			return qaUnknown;
+		Entry* e = find(KeyType(C,D));
+		return count ( e != NULL && e->Value != qaUnknown ) ? e->Value : qaUnknown;
+	}
+		/// remember the answer VALUE of the query about C (or about C and D)
+	void setAnswer ( TConceptExpr* C, TConceptExpr* D, bool value )
+	{
+		if ( isActive() )
+			get(KeyType(C,D)).Value = value ? qaTrue : qaFalse;
+	}
+
+	// taxonomy positions
+
+		/// @return cached taxonomy position of C or NULL if it is unknown
+	TaxonomyVertex* getPosition ( TConceptExpr* C )
+	{
+		if ( !isActive() )
+			return NULL;
+		Entry* e = find(KeyType(C,NULL));
+		return count ( e != NULL && e->Vertex != NULL ) ? e->Vertex : NULL;
+	}
+		/// remember the taxonomy position V of C; the vertex is copied if it is TEMPorary
+	void setPosition ( TConceptExpr* C, TaxonomyVertex* v, bool temp )
+	{
+		if ( !isActive() )
+			return;
+		Entry& e = get(KeyType(C,NULL));
+		clearEntry(e);
+		e.Vertex = temp ? new TaxonomyVertex(*v) : v;
+		e.ownVertex = temp;
+	}
+
+	// statistics
+
+		/// @return number of cache hits
+	unsigned long getHits ( void ) const { return nHits; }
+		/// @return number of cache misses
+	unsigned long getMisses ( void ) const { return nMisses; }
+		/// reset hit/miss statistics
+	void resetStat ( void ) { nHits = nMisses = 0; }
+		/// print cache statistics
+	void PrintStat ( std::ostream& o ) const
+	{
+		o << "Query result cache: " << Entries.size() << " of " << maxSize << " entries used, "
+		  << nHits << " hits, " << nMisses << " misses\n";
+	}
+}; // TQueryResultCache
+
+#endif
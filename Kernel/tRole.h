@@ -200,7 +200,7 @@ protected:	// methods
 
 public:		// interface
 		/// the only c'tor
-	TRole ( const std::string& name );
+	TRole ( const TNameRef& name );
 		/// d'tor
 	virtual ~TRole ( void );
 
@@ -525,7 +525,7 @@ inline TRole* resolveRole ( const DLTree* t ) { return resolveSynonym(resolveRol
 //--------------------------------------------------
 //	TRole implementation
 //--------------------------------------------------
-inline TRole :: TRole ( const std::string& name )
+inline TRole :: TRole ( const TNameRef& name )
 	: ClassifiableEntry(name)
 	, Inverse(NULL)
 	, pDomain(NULL)
@@ -0,0 +1,149 @@
+/* This file is part of the FaCT++ DL reasoner
+Copyright (C) 2026 by Dmitry Tsarkov
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef TSCHEMATAXONOMY_H
+#define TSCHEMATAXONOMY_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "tConcept.h"
+#include "taxVertex.h"
+
+/// classification of the concept names of a schema (an ontology without individuals).
+/// It is built once and then shared read-only by kernels that load the same schema
+/// together with their own ABoxes: in a consistent KB the ABox does not change
+/// subsumptions between the schema concepts, so they need not be re-tested.
+/// Only the classification is shared: every kernel still loads and preprocesses its own TBox,
+/// as the TBox, the DAG and the taxonomy are changed during the reasoning about the kernel's ABox.
+/// It is also used to keep the subsumers of the names found by classifying their modules
+/// (see ModularClassifier); then the subsumers of some names might be unknown.
+class TSchemaTaxonomy
+{
+public:		// types
+		/// schema of an ontology: sorted LISP forms of its schema axioms and the names of the universal and empty roles
+	typedef std::vector<std::string> SchemaAxioms;
+
+protected:	// types
+		/// concept name -> node map
+	typedef std::map<std::string, unsigned int> NameMap;
+		/// sorted set of nodes
+	typedef std::vector<unsigned int> NodeSet;
+		/// taxonomy vertex -> node map (used during construction)
+	typedef std::map<const TaxonomyVertex*, unsigned int> VertexMap;
+
+protected:	// members
+		/// node for every concept name; equivalent concepts share a node
+	NameMap Nodes;
+		/// all the subsumers of every node, including the node itself
+	std::vector<NodeSet> Subsumers;
+		/// schema the classification was built for
+	SchemaAxioms Axioms;
+
+private:	// no copy
+		/// no copy c'tor
+	TSchemaTaxonomy ( const TSchemaTaxonomy& );
+		/// no assignment
+	TSchemaTaxonomy& operator = ( const TSchemaTaxonomy& );
+
+protected:	// methods
+		/// @return node corresponding to a vertex V; fill its subsumers if necessary
+	unsigned int getNode ( const TaxonomyVertex* v, VertexMap& map )
+	{
+		VertexMap::iterator p = map.find(v);
+		if ( p != map.end() )
+			return p->second;
+
+		// gather subsumers of all the parents
+		NodeSet subs;
+		for ( TaxonomyVertex::const_iterator q = v->begin(/*upDirection=*/true), q_end = v->end(/*upDirection=*/true); q != q_end; ++q )
+		{
+			unsigned int parent = getNode ( *q, map );
+			subs.insert ( subs.end(), Subsumers[parent].begin(), Subsumers[parent].end() );
+		}
+
+		unsigned int node = Subsumers.size();
+		map[v] = node;
+		subs.push_back(node);
+		std::sort ( subs.begin(), subs.end() );
+		subs.erase ( std::unique ( subs.begin(), subs.end() ), subs.end() );
+		Subsumers.push_back(subs);
+		return node;
+	}
+
+public:		// interface
+		/// build the classification of the schema AXIOMS using classified concepts [BEG,END)
+	template<class Iterator>
+	TSchemaTaxonomy ( Iterator beg, Iterator end, const SchemaAxioms& axioms )
+		: Axioms(axioms)
+	{
+		VertexMap map;
+		for ( ; beg != end; ++beg )
+			if ( (*beg)->isClassified() )
+				Nodes[(*beg)->getName()] = getNode ( (*beg)->getTaxVertex(), map );
+	}
+		/// empty c'tor: the subsumers of the names are set one by one (e.g., from the classification of their modules)
+	TSchemaTaxonomy ( void ) {}
+		/// empty d'tor
+	~TSchemaTaxonomy ( void ) {}
+
+		/// add a concept NAME with unknown subsumers; @return its node
+	unsigned int addName ( const std::string& name )
+	{
+		NameMap::iterator p = Nodes.find(name);
+		if ( p != Nodes.end() )
+			return p->second;
+		unsigned int node = Subsumers.size();
+		Nodes[name] = node;
+		Subsumers.push_back(NodeSet());
+		return node;
+	}
+		/// set the subsumers of a concept NAME to the names SUBS (the NAME itself is added)
+	void setSubsumers ( const std::string& name, const std::vector<std::string>& subs )
+	{
+		unsigned int node = addName(name);
+		NodeSet set(1,node);
+		for ( std::vector<std::string>::const_iterator p = subs.begin(), p_end = subs.end(); p != p_end; ++p )
+			set.push_back(addName(*p));
+		std::sort ( set.begin(), set.end() );
+		set.erase ( std::unique ( set.begin(), set.end() ), set.end() );
+		Subsumers[node].swap(set);
+	}
+
+		/// @return true iff the classification was built for the schema AXIOMS
+	bool isSchemaOf ( const SchemaAxioms& axioms ) const { return Axioms == axioms; }
+		/// @return number of the named concepts in the schema
+	size_t size ( void ) const { return Nodes.size(); }
+		/// @return true iff the schema knows the subsumption between C and D; put the answer into RESULT
+	bool isSubsumedBy ( const TConcept* C, const TConcept* D, bool& result ) const
+	{
+		NameMap::const_iterator c = Nodes.find(C->getName()), d = Nodes.find(D->getName());
+		if ( c == Nodes.end() || d == Nodes.end() )
+			return false;
+		const NodeSet& subs = Subsumers[c->second];
+		// every known node subsumes itself, so empty set means that C was not classified
+		if ( subs.empty() )
+			return false;
+		result = std::binary_search ( subs.begin(), subs.end(), d->second );
+		return true;
+	}
+}; // TSchemaTaxonomy
+
+#endif
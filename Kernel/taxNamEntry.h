@@ -36,10 +36,16 @@ public:		// type definitions
 	typedef linkSet::iterator iterator;
 		/// told subsumers RO iterator
 	typedef linkSet::const_iterator const_iterator;
+		/// type for the set of taxonomy parents of an entry kept outside of the taxonomy graph
+	typedef std::vector<TaxonomyVertex*> parentSet;
+		/// taxonomy parents RO iterator
+	typedef parentSet::const_iterator parent_iterator;
 
 protected:	// members
 		/// link to taxonomy entry for current entry
 	TaxonomyVertex* taxVertex;
+		/// direct parents in taxonomy of an entry that is kept in their instance buckets rather than in a vertex
+	parentSet taxParents;
 		/// links to 'told subsumers' (entryes that are direct super-entries for current)
 	linkSet toldSubsumers;
 		/// pointer to synonym (entry which contains whole information the same as current)
@@ -55,7 +61,7 @@ private:	// no copy
 
 public:		// interface
 		/// C'tor
-	ClassifiableEntry ( const std::string& name )
+	ClassifiableEntry ( const TNameRef& name )
 		: TNamedEntry ( name )
 		, taxVertex (NULL)
 		, pSynonym (NULL)
@@ -67,12 +73,25 @@ public:		// interface
 	// taxonomy entry access
 
 		/// is current entry classified
-	bool isClassified ( void ) const { return ( taxVertex != NULL ); }
+	bool isClassified ( void ) const { return ( taxVertex != NULL || isTaxInstance() ); }
 		/// set up given entry
 	void setTaxVertex ( TaxonomyVertex* vertex ) { taxVertex = vertex; }
 		/// get taxonomy vertex of the entry
 	TaxonomyVertex* getTaxVertex ( void ) const { return taxVertex; }
 
+	// instance bucket interface
+
+		/// @return true iff the entry is kept in the instance buckets of its taxonomy parents
+	bool isTaxInstance ( void ) const { return !taxParents.empty(); }
+		/// add direct PARENT of the entry kept in the instance buckets
+	void addTaxParent ( TaxonomyVertex* parent ) { taxParents.push_back(parent); }
+		/// clear all the taxonomy parents of the entry
+	void clearTaxParents ( void ) { taxParents.clear(); }
+		/// begin of the taxonomy parents
+	parent_iterator parent_begin ( void ) const { return taxParents.begin(); }
+		/// end of the taxonomy parents
+	parent_iterator parent_end ( void ) const { return taxParents.end(); }
+
 	// completely defined interface
 
 		/// register a Completely Defined flag